@@ -0,0 +1,90 @@
+/**
+ * arch/x86_64/core_set_simd.c
+ *
+ * x86_64 core set word kernels
+ *
+ * PURPOSE:
+ *   Override core_set_combine_words() with an AVX2 kernel (four words,
+ *   256 cores, per step) and core_set_select_bit() with BMI2 PDEP.
+ *
+ * GUARANTEES:
+ *   - Results are identical to the scalar references in domains/core_set.c
+ *   - Falls back to the scalar references when AVX2 / BMI2 is unavailable
+ *   - ISA selection uses CPU state, not compile flags
+ */
+
+#include "../../domains/domain_contract.h"
+#include <immintrin.h>
+
+/* ========================================================================
+ * AVX2 COMBINE (4 words per step)
+ * ======================================================================== */
+
+__attribute__((target("avx2,popcnt")))
+static uint32_t combine_words_avx2(
+    uint64_t *out,
+    const uint64_t *a,
+    const uint64_t *b,
+    uint32_t words,
+    core_set_op_t op
+) {
+    uint32_t count = 0;
+    uint32_t i = 0;
+
+    for (; i + 4 <= words; i += 4) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        __m256i vr;
+
+        switch (op) {
+            case CORE_SET_OP_UNION:     vr = _mm256_or_si256(va, vb);    break;
+            case CORE_SET_OP_INTERSECT: vr = _mm256_and_si256(va, vb);   break;
+            default:                    vr = _mm256_andnot_si256(vb, va); break;
+        }
+
+        _mm256_storeu_si256((__m256i *)(out + i), vr);
+
+        /* No 64-bit lane popcount in AVX2; popcnt per lane is cheaper
+         * than a nibble-table reduction for four words */
+        count += (uint32_t)__builtin_popcountll((uint64_t)_mm256_extract_epi64(vr, 0));
+        count += (uint32_t)__builtin_popcountll((uint64_t)_mm256_extract_epi64(vr, 1));
+        count += (uint32_t)__builtin_popcountll((uint64_t)_mm256_extract_epi64(vr, 2));
+        count += (uint32_t)__builtin_popcountll((uint64_t)_mm256_extract_epi64(vr, 3));
+    }
+
+    return count + core_set_combine_words_scalar(out + i, a + i, b + i, words - i, op);
+}
+
+/* ========================================================================
+ * BMI2 SELECT
+ * ======================================================================== */
+
+__attribute__((target("bmi,bmi2")))
+static uint32_t select_bit_bmi2(uint64_t word, uint32_t n) {
+    /* Deposit bit n into the n-th set position of word */
+    return (uint32_t)_tzcnt_u64(_pdep_u64(1ULL << n, word));
+}
+
+/* ========================================================================
+ * DISPATCH (overrides weak defaults in domains/core_set.c)
+ * ======================================================================== */
+
+uint32_t core_set_combine_words(
+    uint64_t *out,
+    const uint64_t *a,
+    const uint64_t *b,
+    uint32_t words,
+    core_set_op_t op
+) {
+    if (words >= 4 && __builtin_cpu_supports("avx2")) {
+        return combine_words_avx2(out, a, b, words, op);
+    }
+    return core_set_combine_words_scalar(out, a, b, words, op);
+}
+
+uint32_t core_set_select_bit(uint64_t word, uint32_t n) {
+    if (__builtin_cpu_supports("bmi2")) {
+        return select_bit_bmi2(word, n);
+    }
+    return core_set_select_bit_scalar(word, n);
+}
@@ -0,0 +1,169 @@
+/**
+ * arch/x86_64/isolation_row.c
+ *
+ * x86_64 vectorized cache isolation matrix rows
+ *
+ * PURPOSE:
+ *   Override topology_build_isolation_row() with AVX-512 / AVX2 kernels.
+ *   Each row is three 32-bit compare streams over the cache domain
+ *   columns, folded into isolation levels with blends and narrowed to
+ *   one byte per pair.
+ *
+ * GUARANTEES:
+ *   - Output is byte-identical to topology_build_isolation_row_scalar()
+ *   - Falls back to the scalar reference when AVX2 is unavailable
+ *   - ISA selection uses CPU and OS state (XSAVE), not compile flags
+ */
+
+#include "../../topology/topology_contract.h"
+#include <immintrin.h>
+
+/* ========================================================================
+ * AVX-512 KERNEL (16 pairs per step)
+ * ======================================================================== */
+
+__attribute__((target("avx512f")))
+static void isolation_row_avx512(
+    const cache_domain_t *l1,
+    const cache_domain_t *l2,
+    const cache_domain_t *l3,
+    uint32_t core_count,
+    uint32_t row,
+    uint8_t *out_row
+) {
+    const __m512i row_l1 = _mm512_set1_epi32((int)l1[row]);
+    const __m512i row_l2 = _mm512_set1_epi32((int)l2[row]);
+    const __m512i row_l3 = _mm512_set1_epi32((int)l3[row]);
+
+    const __m512i level_full = _mm512_set1_epi32(CACHE_ISOLATED_FULL);
+    const __m512i level_l3   = _mm512_set1_epi32(CACHE_ISOLATED_L3);
+    const __m512i level_l2   = _mm512_set1_epi32(CACHE_ISOLATED_L2);
+    const __m512i level_l1   = _mm512_set1_epi32(CACHE_ISOLATED_L1);
+
+    uint32_t j = 0;
+    for (; j + 16 <= core_count; j += 16) {
+        __mmask16 shares_l1 = _mm512_cmpeq_epi32_mask(
+            _mm512_loadu_si512((const void *)(l1 + j)), row_l1);
+        __mmask16 shares_l2 = _mm512_cmpeq_epi32_mask(
+            _mm512_loadu_si512((const void *)(l2 + j)), row_l2);
+        __mmask16 shares_l3 = _mm512_cmpeq_epi32_mask(
+            _mm512_loadu_si512((const void *)(l3 + j)), row_l3);
+
+        __m512i level = _mm512_mask_blend_epi32(shares_l3, level_full, level_l3);
+        level = _mm512_mask_blend_epi32(shares_l2, level, level_l2);
+        level = _mm512_mask_blend_epi32(shares_l1, level, level_l1);
+
+        _mm_storeu_si128((__m128i *)(out_row + j), _mm512_cvtepi32_epi8(level));
+    }
+
+    /* Tail (and self entry) via scalar reference rule */
+    for (; j < core_count; j++) {
+        uint8_t level = CACHE_ISOLATED_FULL;
+        if (l3[j] == l3[row]) level = CACHE_ISOLATED_L3;
+        if (l2[j] == l2[row]) level = CACHE_ISOLATED_L2;
+        if (l1[j] == l1[row]) level = CACHE_ISOLATED_L1;
+        out_row[j] = level;
+    }
+
+    out_row[row] = CACHE_ISOLATED_FULL;
+}
+
+/* ========================================================================
+ * AVX2 KERNEL (32 pairs per step)
+ * ======================================================================== */
+
+__attribute__((target("avx2")))
+static inline __m256i isolation_levels_avx2(
+    const cache_domain_t *l1,
+    const cache_domain_t *l2,
+    const cache_domain_t *l3,
+    __m256i row_l1,
+    __m256i row_l2,
+    __m256i row_l3
+) {
+    __m256i shares_l1 = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256((const __m256i *)l1), row_l1);
+    __m256i shares_l2 = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256((const __m256i *)l2), row_l2);
+    __m256i shares_l3 = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256((const __m256i *)l3), row_l3);
+
+    __m256i level = _mm256_blendv_epi8(
+        _mm256_set1_epi32(CACHE_ISOLATED_FULL),
+        _mm256_set1_epi32(CACHE_ISOLATED_L3), shares_l3);
+    level = _mm256_blendv_epi8(
+        level, _mm256_set1_epi32(CACHE_ISOLATED_L2), shares_l2);
+    level = _mm256_blendv_epi8(
+        level, _mm256_set1_epi32(CACHE_ISOLATED_L1), shares_l1);
+
+    return level;
+}
+
+__attribute__((target("avx2")))
+static void isolation_row_avx2(
+    const cache_domain_t *l1,
+    const cache_domain_t *l2,
+    const cache_domain_t *l3,
+    uint32_t core_count,
+    uint32_t row,
+    uint8_t *out_row
+) {
+    const __m256i row_l1 = _mm256_set1_epi32((int)l1[row]);
+    const __m256i row_l2 = _mm256_set1_epi32((int)l2[row]);
+    const __m256i row_l3 = _mm256_set1_epi32((int)l3[row]);
+
+    /* Undo the per-lane interleave left by packs/packus */
+    const __m256i lane_order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    uint32_t j = 0;
+    for (; j + 32 <= core_count; j += 32) {
+        __m256i a = isolation_levels_avx2(
+            l1 + j,      l2 + j,      l3 + j,      row_l1, row_l2, row_l3);
+        __m256i b = isolation_levels_avx2(
+            l1 + j + 8,  l2 + j + 8,  l3 + j + 8,  row_l1, row_l2, row_l3);
+        __m256i c = isolation_levels_avx2(
+            l1 + j + 16, l2 + j + 16, l3 + j + 16, row_l1, row_l2, row_l3);
+        __m256i d = isolation_levels_avx2(
+            l1 + j + 24, l2 + j + 24, l3 + j + 24, row_l1, row_l2, row_l3);
+
+        /* 32-bit -> 16-bit -> 8-bit (values are 1..4, no saturation) */
+        __m256i ab = _mm256_packs_epi32(a, b);
+        __m256i cd = _mm256_packs_epi32(c, d);
+        __m256i bytes = _mm256_packus_epi16(ab, cd);
+        bytes = _mm256_permutevar8x32_epi32(bytes, lane_order);
+
+        _mm256_storeu_si256((__m256i *)(out_row + j), bytes);
+    }
+
+    /* Tail (and self entry) via scalar reference rule */
+    for (; j < core_count; j++) {
+        uint8_t level = CACHE_ISOLATED_FULL;
+        if (l3[j] == l3[row]) level = CACHE_ISOLATED_L3;
+        if (l2[j] == l2[row]) level = CACHE_ISOLATED_L2;
+        if (l1[j] == l1[row]) level = CACHE_ISOLATED_L1;
+        out_row[j] = level;
+    }
+
+    out_row[row] = CACHE_ISOLATED_FULL;
+}
+
+/* ========================================================================
+ * DISPATCH (overrides weak default in topology/isolation_rules.c)
+ * ======================================================================== */
+
+void topology_build_isolation_row(
+    const cache_domain_t *l1,
+    const cache_domain_t *l2,
+    const cache_domain_t *l3,
+    uint32_t core_count,
+    uint32_t row,
+    uint8_t *out_row
+) {
+    if (__builtin_cpu_supports("avx512f")) {
+        isolation_row_avx512(l1, l2, l3, core_count, row, out_row);
+    } else if (__builtin_cpu_supports("avx2")) {
+        isolation_row_avx2(l1, l2, l3, core_count, row, out_row);
+    } else {
+        topology_build_isolation_row_scalar(l1, l2, l3, core_count, row, out_row);
+    }
+}
@@ -0,0 +1,349 @@
+/**
+ * arch/x86_64/topology_probe.c
+ *
+ * x86_64 per-core topology measurements
+ *
+ * PURPOSE:
+ *   Override the topology measurement hooks with pinned measurements:
+ *   - topology_measure_core_frequency(): a fixed dependent-ALU loop
+ *     timed against the TSC, plus APERF/MPERF deltas when readable
+ *   - topology_measure_core_noise(): a tight TSC sampling loop that
+ *     records every interruption gap
+ *
+ * APERF/MPERF SOURCES (first that opens wins):
+ *   - /dev/cpu/N/msr (root + msr module)
+ *   - perf_event "msr" PMU (aperf/mperf events, no msr module needed;
+ *     subject to perf_event_paranoid)
+ *
+ * GUARANTEES:
+ *   - Caller's CPU affinity is restored after every measurement
+ *   - Counter access is optional; absence is not an error
+ *   - TSC rate is calibrated once against CLOCK_MONOTONIC
+ */
+
+#define _GNU_SOURCE
+#include "../../topology/topology_contract.h"
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <x86intrin.h>
+
+#define MSR_IA32_MPERF  0xE7
+#define MSR_IA32_APERF  0xE8
+
+/* perf "msr" PMU event encodings (sysfs events/aperf, events/mperf) */
+#define PERF_MSR_PMU_TYPE   "/sys/bus/event_source/devices/msr/type"
+#define PERF_MSR_APERF      0x01
+#define PERF_MSR_MPERF      0x02
+
+#define TSC_CALIBRATION_NS  20000000ULL   /* 20 ms */
+#define ADDS_PER_ITERATION  4
+
+/* ========================================================================
+ * TIME SOURCES
+ * ======================================================================== */
+
+static inline uint64_t read_tsc(void) {
+    _mm_lfence();
+    uint64_t tsc = __rdtsc();
+    _mm_lfence();
+    return tsc;
+}
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* TSC ticks per microsecond (invariant TSC: same on every core) */
+static uint64_t tsc_mhz(void) {
+    static uint64_t cached = 0;
+
+    if (cached == 0) {
+        uint64_t ns_start = monotonic_ns();
+        uint64_t tsc_start = read_tsc();
+
+        while (monotonic_ns() - ns_start < TSC_CALIBRATION_NS) {
+            /* spin */
+        }
+
+        uint64_t tsc_end = read_tsc();
+        uint64_t ns_end = monotonic_ns();
+
+        cached = (tsc_end - tsc_start) * 1000 / (ns_end - ns_start);
+    }
+
+    return cached;
+}
+
+/* ========================================================================
+ * MEASUREMENT LOOP
+ * ======================================================================== */
+
+/*
+ * Each iteration is ADDS_PER_ITERATION single-cycle adds on one register,
+ * so the loop takes exactly that many core cycles per iteration
+ * regardless of issue width. Register-register adds are used because
+ * newer cores can fold add-immediate chains at rename.
+ */
+static inline void dependent_add_loop(uint64_t iterations) {
+    uint64_t acc = 1;
+
+    __asm__ volatile(
+        "1:\n\t"
+        "add %0, %0\n\t"
+        "add %0, %0\n\t"
+        "add %0, %0\n\t"
+        "add %0, %0\n\t"
+        "dec %1\n\t"
+        "jnz 1b\n\t"
+        : "+r"(acc), "+r"(iterations)
+        :
+        : "cc");
+}
+
+/* ========================================================================
+ * CPU PINNING
+ * ======================================================================== */
+
+static bool pin_to_cpu(core_id_t cpu, cpu_set_t *saved) {
+    cpu_set_t target;
+
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+
+    if (sched_getaffinity(0, sizeof(*saved), saved) != 0) {
+        return false;
+    }
+
+    CPU_ZERO(&target);
+    CPU_SET(cpu, &target);
+
+    return sched_setaffinity(0, sizeof(target), &target) == 0;
+}
+
+static void restore_affinity(const cpu_set_t *saved) {
+    sched_setaffinity(0, sizeof(*saved), saved);
+}
+
+/* ========================================================================
+ * APERF/MPERF COUNTERS
+ * ======================================================================== */
+
+typedef struct {
+    int msr_fd;       /* /dev/cpu/N/msr, or -1 */
+    int aperf_fd;     /* perf_event fallback, or -1 */
+    int mperf_fd;
+} perf_counters_t;
+
+static bool read_msr(int fd, uint32_t msr, uint64_t *value) {
+    return pread(fd, value, sizeof(*value), msr) == (ssize_t)sizeof(*value);
+}
+
+/* Dynamic PMU type of the perf "msr" PMU (-1 if absent) */
+static int perf_msr_pmu_type(void) {
+    static int cached = -2;
+
+    if (cached == -2) {
+        FILE *file = fopen(PERF_MSR_PMU_TYPE, "r");
+        cached = -1;
+
+        if (file) {
+            int type;
+            if (fscanf(file, "%d", &type) == 1 && type >= 0) {
+                cached = type;
+            }
+            fclose(file);
+        }
+    }
+
+    return cached;
+}
+
+/* Count one msr PMU event for this thread while it runs on cpu */
+static int perf_open_counter(int pmu_type, uint64_t event, core_id_t cpu) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+
+    attr.size = sizeof(attr);
+    attr.type = (uint32_t)pmu_type;
+    attr.config = event;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, (int)cpu, -1, 0);
+}
+
+static bool perf_read_counter(int fd, uint64_t *value) {
+    return read(fd, value, sizeof(*value)) == (ssize_t)sizeof(*value);
+}
+
+static void counters_close(perf_counters_t *counters) {
+    if (counters->msr_fd >= 0) close(counters->msr_fd);
+    if (counters->aperf_fd >= 0) close(counters->aperf_fd);
+    if (counters->mperf_fd >= 0) close(counters->mperf_fd);
+
+    counters->msr_fd = counters->aperf_fd = counters->mperf_fd = -1;
+}
+
+/* Open the MSR device, falling back to perf_event (false if neither) */
+static bool counters_open(core_id_t cpu, perf_counters_t *counters) {
+    char path[32];
+    snprintf(path, sizeof(path), "/dev/cpu/%u/msr", cpu);
+
+    counters->msr_fd = open(path, O_RDONLY);
+    counters->aperf_fd = counters->mperf_fd = -1;
+
+    if (counters->msr_fd >= 0) {
+        return true;
+    }
+
+    int pmu_type = perf_msr_pmu_type();
+    if (pmu_type < 0) {
+        return false;
+    }
+
+    counters->aperf_fd = perf_open_counter(pmu_type, PERF_MSR_APERF, cpu);
+    counters->mperf_fd = perf_open_counter(pmu_type, PERF_MSR_MPERF, cpu);
+
+    if (counters->aperf_fd < 0 || counters->mperf_fd < 0) {
+        counters_close(counters);
+        return false;
+    }
+
+    return true;
+}
+
+static bool counters_read(
+    const perf_counters_t *counters,
+    uint64_t *aperf,
+    uint64_t *mperf
+) {
+    if (counters->msr_fd >= 0) {
+        return read_msr(counters->msr_fd, MSR_IA32_APERF, aperf) &&
+               read_msr(counters->msr_fd, MSR_IA32_MPERF, mperf);
+    }
+
+    return perf_read_counter(counters->aperf_fd, aperf) &&
+           perf_read_counter(counters->mperf_fd, mperf);
+}
+
+/* ========================================================================
+ * FREQUENCY MEASUREMENT (overrides weak default in topology/frequency.c)
+ * ======================================================================== */
+
+bool topology_measure_core_frequency(
+    core_id_t cpu,
+    uint32_t loop_iterations,
+    core_frequency_sample_t *sample
+) {
+    if (!sample || loop_iterations == 0) {
+        return false;
+    }
+
+    uint64_t tsc_rate = tsc_mhz();
+    if (tsc_rate == 0) {
+        return false;
+    }
+
+    cpu_set_t saved;
+    if (!pin_to_cpu(cpu, &saved)) {
+        return false;
+    }
+
+    /* APERF/MPERF (optional) */
+    perf_counters_t sources;
+    bool opened = counters_open(cpu, &sources);
+
+    uint64_t aperf_start = 0, mperf_start = 0;
+    bool counters = opened && counters_read(&sources, &aperf_start, &mperf_start);
+
+    /* Warm up so the core leaves any idle state before timing */
+    dependent_add_loop(loop_iterations / 8 + 1);
+
+    uint64_t tsc_start = read_tsc();
+    dependent_add_loop(loop_iterations);
+    uint64_t tsc_end = read_tsc();
+
+    uint64_t aperf_end = 0, mperf_end = 0;
+    if (counters) {
+        counters = counters_read(&sources, &aperf_end, &mperf_end);
+    }
+
+    if (opened) {
+        counters_close(&sources);
+    }
+
+    restore_affinity(&saved);
+
+    uint64_t ticks = tsc_end - tsc_start;
+    if (ticks == 0) {
+        return false;
+    }
+
+    /* cycles / microseconds, where microseconds = ticks / tsc_rate */
+    uint64_t cycles = (uint64_t)loop_iterations * ADDS_PER_ITERATION;
+    sample->effective_mhz = (uint32_t)(cycles * tsc_rate / ticks);
+
+    /* MPERF ticks at the TSC rate; APERF at the actual core clock */
+    sample->counter_mhz = 0;
+    if (counters && mperf_end > mperf_start) {
+        sample->counter_mhz = (uint32_t)(
+            (aperf_end - aperf_start) * tsc_rate / (mperf_end - mperf_start));
+    }
+
+    return true;
+}
+
+/* ========================================================================
+ * NOISE MEASUREMENT (overrides weak default in topology/noise.c)
+ * ======================================================================== */
+
+topology_measure_result_t topology_measure_core_noise(
+    core_id_t cpu,
+    uint32_t window_us,
+    uint32_t gap_threshold_ns,
+    core_noise_t *noise
+) {
+    if (!noise || window_us == 0) {
+        return TOPOLOGY_MEASURE_FAILED;
+    }
+
+    uint64_t tsc_rate = tsc_mhz();
+    if (tsc_rate == 0) {
+        return TOPOLOGY_MEASURE_UNSUPPORTED;
+    }
+
+    cpu_set_t saved;
+    if (!pin_to_cpu(cpu, &saved)) {
+        return TOPOLOGY_MEASURE_FAILED;
+    }
+
+    uint64_t window_ticks = (uint64_t)window_us * tsc_rate;
+    uint64_t gap_ticks = (uint64_t)gap_threshold_ns * tsc_rate / 1000;
+
+    /* Unserialized reads: the loop must be as tight as possible */
+    uint64_t start = __rdtsc();
+    uint64_t prev = start;
+    uint64_t now = start;
+
+    while (now - start < window_ticks) {
+        now = __rdtsc();
+
+        if (now - prev > gap_ticks) {
+            core_noise_record_gap(noise, (now - prev) * 1000 / tsc_rate);
+        }
+
+        prev = now;
+    }
+
+    restore_affinity(&saved);
+
+    noise->window_ns = (now - start) * 1000 / tsc_rate;
+    return TOPOLOGY_MEASURE_OK;
+}
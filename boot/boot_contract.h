@@ -28,7 +28,16 @@
  * CORE TYPES
  * ======================================================================== */
 
-#define MAX_CPU_COUNT        256
+/*
+ * Build-time CPU width. Every per-CPU array, core mask and N x N matrix
+ * is sized from this; override with -DUCQCF_MAX_CPUS=512 (or 1024) for
+ * large multi-socket machines. Must be a multiple of 64.
+ */
+#ifndef UCQCF_MAX_CPUS
+#define UCQCF_MAX_CPUS       256
+#endif
+
+#define MAX_CPU_COUNT        UCQCF_MAX_CPUS
 #define MAX_NUMA_NODES_BOOT  8
 #define MAX_CACHE_LEVELS     4
 
@@ -156,7 +165,7 @@ typedef struct {
 typedef struct {
     /* CPU topology (counts only) */
     uint32_t            cpu_count;
-    uint32_t            numa_nodes;
+    uint32_t            numa_nodes;        /* Nodes with CPUs */
     bool                smt_enabled;
     uint32_t            threads_per_core;  /* 1 if SMT disabled, 2+ if enabled */
     
@@ -208,6 +217,7 @@ typedef enum {
     
     /* Insufficient hardware */
     BOOT_ERROR_TOO_FEW_CORES,
+    BOOT_ERROR_TOO_MANY_CORES,
     BOOT_ERROR_NO_CACHE,
     BOOT_ERROR_NO_NUMA,
     
@@ -406,10 +416,28 @@ bool boot_probe_smt_enabled(void);
 /* Get total memory size */
 uint64_t boot_probe_total_memory_mb(void);
 
+/* Get logical CPU count */
+uint32_t boot_probe_cpu_count(void);
+
+/* Get NUMA node count */
+uint32_t boot_probe_numa_node_count(void);
+
+/* Get hardware threads per physical core */
+uint32_t boot_probe_threads_per_core(void);
+
+/* Check if booted via UEFI */
+bool boot_probe_uefi_boot(void);
+
+/* Check if Secure Boot enabled */
+bool boot_probe_secure_boot_enabled(void);
+
 /* ========================================================================
  * COMPILE-TIME GUARANTEES
  * ======================================================================== */
 
+_Static_assert(MAX_CPU_COUNT > 0 && MAX_CPU_COUNT % 64 == 0,
+    "UCQCF_MAX_CPUS must be a positive multiple of 64 (whole bitmap words)");
+
 _Static_assert(sizeof(boot_facts_t) < 4096,
     "boot_facts_t should fit in single page for cache efficiency");
 
@@ -228,6 +228,14 @@ boot_validation_result_t boot_validate(
         printf("[BOOT] FAIL: Too few cores (%u < 2)\n", facts->cpu_count);
     }
     
+    /* Validate core count fits the build-time width */
+    if (facts->cpu_count > MAX_CPU_COUNT) {
+        boot_validation_context_add_error(
+            ctx, BOOT_ERROR_TOO_MANY_CORES, BOOT_VALIDATION_HARD_FAIL);
+        printf("[BOOT] FAIL: Too many cores (%u > %u, rebuild with "
+               "UCQCF_MAX_CPUS)\n", facts->cpu_count, MAX_CPU_COUNT);
+    }
+    
     /* Validate cache detection */
     if (facts->cache_topology.level_count == 0) {
         boot_validation_context_add_error(
@@ -319,6 +327,8 @@ const char* boot_error_string(boot_error_t error) {
             return "NUMA detection failed";
         case BOOT_ERROR_TOO_FEW_CORES:
             return "Too few cores for Phase-1";
+        case BOOT_ERROR_TOO_MANY_CORES:
+            return "More cores than UCQCF_MAX_CPUS";
         case BOOT_ERROR_NO_CACHE:
             return "No cache hierarchy detected";
         case BOOT_ERROR_NO_NUMA:
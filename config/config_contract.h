@@ -0,0 +1,425 @@
+/**
+ * config/config_contract.h
+ *
+ * UCQCF Phase-1 Configuration Contract
+ *
+ * PURPOSE:
+ *   Turn config/domain_layout.yaml into security_domain_t records and
+ *   back. The configuration layer only transcribes and places: every
+ *   rule about what a valid domain is stays in domains/ validation.
+ *
+ * GUARANTEES:
+ *   - A field is marked explicit only if it appears in the file
+ *   - Unknown or repeated keys are errors (no silent defaults)
+ *   - Errors carry line and column
+ *   - No dynamic allocation
+ *
+ * SUPPORTED YAML SUBSET:
+ *   Block mappings and block sequences by indentation, plain and
+ *   double-quoted scalars, flow sequences of integers ([1, 2]) and
+ *   '#' comments. Top-level sections other than "domains" are skipped.
+ *
+ * PLACEMENT:
+ *   A domain may give "core_count" and "smt" instead of "cores". The
+ *   offline solver (config/placement.c) picks concrete cores on a sealed
+ *   topology and config_emit_domains() writes the explicit layout back
+ *   out, so boot only ever validates hand-checkable core lists.
+ *
+ * BINARY IMAGES:
+ *   config_binary_encode() writes a graph as a versioned image of
+ *   fixed-size records (core bitmaps, dependency bitsets, checksum).
+ *   config_binary_load() checks the header and copies records into a
+ *   graph with range checks only, no text parsing. The image is what
+ *   tools/convert_layout ships and diffs; YAML stays the source.
+ */
+
+#ifndef UCQCF_CONFIG_CONTRACT_H
+#define UCQCF_CONFIG_CONTRACT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../domains/domain_contract.h"
+
+/* ========================================================================
+ * PARSE OUTCOMES
+ * ======================================================================== */
+
+typedef enum {
+    CONFIG_ERROR_NONE = 0,
+    CONFIG_ERROR_SYNTAX,                /* Not a mapping or sequence line */
+    CONFIG_ERROR_UNKNOWN_KEY,           /* Key not in the domain schema */
+    CONFIG_ERROR_DUPLICATE_KEY,         /* Key repeated within one domain */
+    CONFIG_ERROR_INVALID_VALUE,         /* Wrong type or out of range */
+    CONFIG_ERROR_TOO_MANY_DOMAINS,      /* Above MAX_DOMAINS */
+    CONFIG_ERROR_TOO_MANY_DEPENDENCIES, /* Above MAX_DEPENDENCIES */
+    CONFIG_ERROR_GRAPH_SEALED           /* Target graph already sealed */
+} config_error_t;
+
+/**
+ * Parse status
+ *
+ * line/column are 1-based and point at the offending token
+ * (0 when error is CONFIG_ERROR_NONE).
+ */
+typedef struct {
+    config_error_t error;
+    uint32_t       line;
+    uint32_t       column;
+    uint32_t       domain_count;   /* Domains added to the graph */
+} config_parse_status_t;
+
+/* ========================================================================
+ * PARSING API
+ * ======================================================================== */
+
+/**
+ * Parse domain layout into a graph
+ *
+ * REQUIRES: graph initialized (domain_graph_init) and not sealed
+ * ENSURES:  Each "domains:" entry is appended to graph as written;
+ *           *_explicit flags reflect presence in the text
+ * RETURNS:  false (status set) on the first error; domains parsed
+ *           before the error remain in graph
+ *
+ * Validation is NOT performed: run domain_graph_validate() next.
+ */
+bool config_parse_domains(
+    const char *text,
+    size_t length,
+    domain_graph_t *graph,
+    config_parse_status_t *status
+);
+
+/**
+ * Convert error code to string
+ */
+const char* config_error_string(config_error_t error);
+
+/* ========================================================================
+ * PLACEMENT (offline)
+ * ======================================================================== */
+
+typedef enum {
+    PLACEMENT_ERROR_NONE = 0,
+    PLACEMENT_ERROR_TOPOLOGY_NOT_SEALED, /* Solver needs the proximity index */
+    PLACEMENT_ERROR_GRAPH_SEALED,        /* Domains can no longer change */
+    PLACEMENT_ERROR_REQUEST_CONFLICT,    /* Both "cores" and "core_count" */
+    PLACEMENT_ERROR_REQUEST_INCOMPLETE,  /* No cores, or isolation/smt unset */
+    PLACEMENT_ERROR_UNSATISFIABLE        /* No free cores meet the request */
+} placement_error_t;
+
+/**
+ * Placement status
+ *
+ * domain is the ID of the offending domain (DOMAIN_ID_INVALID when
+ * error is PLACEMENT_ERROR_NONE or not domain-specific).
+ */
+typedef struct {
+    placement_error_t error;
+    domain_id_t       domain;
+    uint32_t          placed;        /* Domains given cores by the solver */
+    uint64_t          placed_mask;   /* Their graph positions (bit i = domains[i]) */
+    uint64_t          cost;          /* Sum of chosen placement costs */
+} placement_status_t;
+
+_Static_assert(MAX_DOMAINS <= 64, "placed_mask needs one bit per domain");
+
+/**
+ * Assign cores to every domain that requests a core_count
+ *
+ * REQUIRES: graph not sealed; topology sealed
+ * ENSURES:  On success every domain has explicit cores, requests are
+ *           cleared (core_count = 0), placed domains do not overlap any
+ *           other domain and meet their cache_isolation, numa_local,
+ *           memory_tier and smt requests
+ * RETURNS:  false (status set) on the first domain that cannot be
+ *           placed; graph is then partially placed and must be discarded
+ *
+ * Placement is greedy (most constrained domain first, cheapest seed
+ * core per domain) and does not backtrack: a false result means this
+ * order found no assignment, not that none exists.
+ * Validation is NOT performed: run domain_graph_validate() next.
+ */
+bool config_place_domains(
+    domain_graph_t *graph,
+    const topology_state_t *topology,
+    placement_status_t *status
+);
+
+/**
+ * Convert placement error code to string
+ */
+const char* placement_error_string(placement_error_t error);
+
+/* ========================================================================
+ * DEPENDENCY-AWARE REFINEMENT (offline)
+ * ======================================================================== */
+
+#define PLACEMENT_MAX_SWAPS 64
+
+/**
+ * One applied move: domain gave up core `from` for core `to`.
+ * other is the domain that owned `to` and received `from` in exchange,
+ * or DOMAIN_ID_INVALID when `to` was free.
+ */
+typedef struct {
+    domain_id_t domain;
+    core_id_t   from;
+    core_id_t   to;
+    domain_id_t other;
+} placement_swap_t;
+
+/**
+ * Refinement report
+ *
+ * Dependency cost is the sum over dependency edges of the mean pair
+ * cost between the two domains' cores, in thousandths: nanoseconds of
+ * measured core-to-core latency when the topology has it, otherwise
+ * NUMA distance units.
+ */
+typedef struct {
+    uint64_t         cost_before;
+    uint64_t         cost_after;
+    bool             latency_measured;
+    uint32_t         edge_count;
+    uint32_t         swap_count;    /* Moves applied (may exceed the log) */
+    placement_swap_t swaps[PLACEMENT_MAX_SWAPS];
+} placement_refinement_t;
+
+/**
+ * Move cores of movable domains to shorten dependency edges
+ *
+ * REQUIRES: topology sealed; graph not sealed; every dependency resolves
+ * ENSURES:  Only domains whose bit is set in movable (graph positions,
+ *           e.g. placement_status_t.placed_mask) change cores; each
+ *           applied move strictly lowers the dependency cost and keeps
+ *           both domains' cache_isolation, numa_local, memory_tier and
+ *           smt requests met; domain core counts are unchanged and no
+ *           domain gains a housekeeping (non-isolated) core
+ * RETURNS:  false if the topology is not sealed, graph is sealed or
+ *           two domains overlap (graph unchanged)
+ *
+ * Steepest descent: each round applies the single best move (to a free
+ * core, or a swap with another movable domain) until none improves.
+ */
+bool config_refine_placement(
+    domain_graph_t *graph,
+    const topology_state_t *topology,
+    uint64_t movable,
+    placement_refinement_t *report
+);
+
+/* ========================================================================
+ * EMITTER API
+ * ======================================================================== */
+
+/**
+ * Write graph domains out as domain_layout.yaml text
+ *
+ * ENSURES:  Only fields that are set are written (undefined enums and
+ *           non-explicit fields stay absent, so validation still
+ *           rejects what the input left out)
+ * RETURNS:  Length of the full text; text is written only if it fits
+ *           in capacity (with NUL), so callers can size a buffer by
+ *           calling with capacity 0 first
+ */
+size_t config_emit_domains(
+    const domain_graph_t *graph,
+    char *out,
+    size_t capacity
+);
+
+/* ========================================================================
+ * LAYOUT COMPILER (build time)
+ * ======================================================================== */
+
+/**
+ * Write graph as a C header of pre-validated static tables
+ *
+ * REQUIRES: domain_graph_validate_structure(graph) did not HARD_FAIL
+ *           (its startup_order is emitted)
+ * ENSURES:  Header defines domain_layout_table[DOMAIN_LAYOUT_COUNT] and
+ *           domain_layout_startup_order[] for
+ *           domain_graph_validate_compiled(), plus _Static_asserts that
+ *           re-prove fields set, unique IDs, disjoint cores and
+ *           dependency order from the emitted constants
+ * RETURNS:  Length of the full text (same capacity rule as
+ *           config_emit_domains)
+ *
+ * source is only quoted in the header comment.
+ */
+size_t config_compile_domains(
+    const domain_graph_t *graph,
+    const char *source,
+    char *out,
+    size_t capacity
+);
+
+/* ========================================================================
+ * BINARY IMAGE FORMAT
+ *
+ * [header][record 0]...[record domain_count - 1], little-endian, no
+ * padding. Records keep graph order. A dependency is a bit over record
+ * positions, so dependency lists come back in position order.
+ * ======================================================================== */
+
+#define CONFIG_BINARY_MAGIC    "UCQCFDG"   /* 8 bytes with the NUL */
+#define CONFIG_BINARY_VERSION  1
+
+/* Record flags: which optional fields were explicit in the source */
+#define CONFIG_BINARY_NAME_EXPLICIT         (1u << 0)
+#define CONFIG_BINARY_CORES_EXPLICIT        (1u << 1)
+#define CONFIG_BINARY_NUMA_LOCAL_EXPLICIT   (1u << 2)
+#define CONFIG_BINARY_MEMORY_TIER_EXPLICIT  (1u << 3)
+#define CONFIG_BINARY_DEPS_EXPLICIT         (1u << 4)
+#define CONFIG_BINARY_FLAGS_ALL             0x1Fu
+
+typedef struct {
+    char     magic[8];
+    uint32_t version;
+    uint32_t header_size;    /* sizeof(config_binary_header_t) */
+    uint32_t record_size;    /* sizeof(config_binary_record_t) */
+    uint32_t core_words;     /* CORE_SET_WORDS of the writer */
+    uint32_t domain_count;
+    uint32_t checksum;       /* config_binary_checksum() of the image */
+} config_binary_header_t;
+
+typedef struct {
+    domain_id_t id;
+    uint32_t    core_count;
+    uint8_t     security_level;
+    uint8_t     preemption;
+    uint8_t     cache_isolation;
+    uint8_t     memory_type;
+    uint8_t     memory_tier;
+    uint8_t     smt;
+    uint8_t     numa_local;
+    uint8_t     flags;                   /* CONFIG_BINARY_*_EXPLICIT */
+    char        name[64];                /* NUL-padded */
+    uint64_t    depends_on;              /* Bit p = depends on record p */
+    uint64_t    cores[CORE_SET_WORDS];
+} config_binary_record_t;
+
+_Static_assert(sizeof(config_binary_header_t) == 32,
+    "binary header layout is part of the format");
+_Static_assert(sizeof(config_binary_record_t) == 88 + 8 * CORE_SET_WORDS,
+    "binary records must not contain padding");
+_Static_assert(MAX_DOMAINS <= 64, "depends_on needs one bit per record");
+_Static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+    "binary images are little-endian and copied without byte swaps");
+
+/* Largest image: size static load buffers with this */
+#define CONFIG_BINARY_MAX_SIZE \
+    (sizeof(config_binary_header_t) + MAX_DOMAINS * sizeof(config_binary_record_t))
+
+typedef enum {
+    CONFIG_BINARY_ERROR_NONE = 0,
+    CONFIG_BINARY_ERROR_SIZE,            /* Size disagrees with the header */
+    CONFIG_BINARY_ERROR_MAGIC,           /* Not a domain graph image */
+    CONFIG_BINARY_ERROR_VERSION,         /* Unsupported format version */
+    CONFIG_BINARY_ERROR_LAYOUT,          /* Record size / core words differ */
+    CONFIG_BINARY_ERROR_TOO_MANY_DOMAINS,/* Above MAX_DOMAINS */
+    CONFIG_BINARY_ERROR_CHECKSUM,        /* Image corrupted */
+    CONFIG_BINARY_ERROR_INVALID_RECORD,  /* Field out of range */
+    CONFIG_BINARY_ERROR_UNRESOLVED_DEPENDENCY, /* Encode: ID not in graph */
+    CONFIG_BINARY_ERROR_GRAPH_SEALED     /* Target graph already sealed */
+} config_binary_error_t;
+
+/**
+ * Binary status
+ *
+ * record is the position of the offending record (UINT32_MAX when the
+ * error is not record-specific).
+ */
+typedef struct {
+    config_binary_error_t error;
+    uint32_t              record;
+} config_binary_status_t;
+
+/* ========================================================================
+ * BINARY IMAGE API
+ * ======================================================================== */
+
+/**
+ * Write graph as a binary image
+ *
+ * REQUIRES: Domain IDs unique (domain_graph_validate_structure passed)
+ * ENSURES:  Same graph, same bytes (names and unused bits zeroed)
+ * RETURNS:  Image size, written only if it fits in capacity; 0 (status
+ *           set) if a dependency names an ID that is not in the graph
+ */
+size_t config_binary_encode(
+    const domain_graph_t *graph,
+    void *out,
+    size_t capacity,
+    config_binary_status_t *status
+);
+
+/**
+ * Load a binary image into a graph
+ *
+ * REQUIRES: graph initialized (domain_graph_init) and not sealed; image
+ *           may be unaligned (e.g. inside a larger mapping)
+ * ENSURES:  On success graph holds exactly the image's domains, as
+ *           config_parse_domains() would have produced them
+ * RETURNS:  false (status set) on any header, checksum or range error;
+ *           graph then holds no domains
+ *
+ * The checksum catches corruption, not tampering. Validation is NOT
+ * performed: run domain_graph_validate() next, as after parsing.
+ */
+bool config_binary_load(
+    const void *image,
+    size_t size,
+    domain_graph_t *graph,
+    config_binary_status_t *status
+);
+
+/**
+ * Checksum of an image as stored in its header
+ *
+ * REQUIRES: size >= sizeof(config_binary_header_t)
+ * RETURNS:  FNV-1a (64-bit words, folded to 32 bits) over image with
+ *           the header's checksum field taken as zero
+ */
+uint32_t config_binary_checksum(const void *image, size_t size);
+
+/**
+ * Convert binary error code to string
+ */
+const char* config_binary_error_string(config_binary_error_t error);
+
+/* ========================================================================
+ * LAYOUT FILES
+ * ======================================================================== */
+
+typedef enum {
+    CONFIG_FILE_OK = 0,
+    CONFIG_FILE_ERROR_OPEN,           /* Missing or not readable */
+    CONFIG_FILE_ERROR_READ,           /* I/O error while reading */
+    CONFIG_FILE_ERROR_TOO_LARGE       /* Longer than the buffer */
+} config_file_error_t;
+
+/**
+ * Read a whole layout file (YAML or binary image) into a fixed buffer
+ *
+ * ENSURES: On CONFIG_FILE_OK buffer[0..*size) holds the file; a file of
+ *          exactly capacity bytes fits (a MAX_DOMAINS image is exactly
+ *          CONFIG_BINARY_MAX_SIZE). Otherwise *size is 0.
+ *
+ * Boot's loader: no allocation, the caller owns the buffer.
+ */
+config_file_error_t config_read_file(
+    const char *path,
+    void *buffer,
+    size_t capacity,
+    size_t *size
+);
+
+/**
+ * Convert file error code to string
+ */
+const char* config_file_error_string(config_file_error_t error);
+
+#endif /* UCQCF_CONFIG_CONTRACT_H */
@@ -0,0 +1,351 @@
+/**
+ * config/domain_binary.c
+ *
+ * Binary domain graph images
+ *
+ * APPROACH:
+ *   One fixed-size record per domain, in graph order. Enums are stored
+ *   as bytes, cores as the raw core_set_t bitmap and dependencies as a
+ *   bitset over record positions, so loading is a bounds-checked copy
+ *   per record plus range checks: there is nothing to tokenize.
+ *
+ * GUARANTEES:
+ *   - No dynamic allocation
+ *   - Identical graphs encode to identical bytes (diffable artifacts)
+ *   - A rejected image leaves the graph empty
+ */
+
+#include "config_contract.h"
+#include <string.h>
+
+/* ========================================================================
+ * CHECKSUM
+ * ======================================================================== */
+
+#define FNV64_OFFSET 0xcbf29ce484222325ULL
+#define FNV64_PRIME  0x100000001b3ULL
+
+/* FNV-1a over 64-bit words: one multiply per 8 bytes instead of per
+ * byte. Header and record sizes are multiples of 8, so only a damaged
+ * image has a byte tail. Each step is a bijection, so any single
+ * changed word changes the result. */
+static uint64_t fnv1a_words(uint64_t hash, const uint8_t *data, size_t length) {
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * FNV64_PRIME;
+    }
+    for (; i < length; i++) {
+        hash = (hash ^ data[i]) * FNV64_PRIME;
+    }
+
+    return hash;
+}
+
+uint32_t config_binary_checksum(const void *image, size_t size) {
+    const uint8_t *bytes = image;
+    config_binary_header_t header;
+
+    /* Hash the header as if its checksum field were zero */
+    memcpy(&header, bytes, sizeof(header));
+    header.checksum = 0;
+
+    uint64_t hash = fnv1a_words(FNV64_OFFSET, (const uint8_t *)&header, sizeof(header));
+    hash = fnv1a_words(hash, bytes + sizeof(header), size - sizeof(header));
+    return (uint32_t)(hash ^ (hash >> 32));
+}
+
+/* ========================================================================
+ * ENCODE
+ * ======================================================================== */
+
+static bool find_position(const domain_graph_t *graph, domain_id_t id, uint32_t *position) {
+    for (uint32_t p = 0; p < graph->domain_count; p++) {
+        if (graph->domains[p].id == id) {
+            *position = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool encode_record(
+    const domain_graph_t *graph,
+    const security_domain_t *domain,
+    config_binary_record_t *record
+) {
+    memset(record, 0, sizeof(*record));
+
+    record->id = domain->id;
+    record->core_count = domain->core_count;
+    record->security_level = (uint8_t)domain->security_level;
+    record->preemption = (uint8_t)domain->preemption;
+    record->cache_isolation = (uint8_t)domain->cache_isolation;
+    record->memory_type = (uint8_t)domain->memory_type;
+    record->memory_tier = (uint8_t)domain->memory_tier;
+    record->smt = (uint8_t)domain->smt;
+    record->numa_local = domain->numa_local ? 1 : 0;
+
+    record->flags = (domain->name_explicit ? CONFIG_BINARY_NAME_EXPLICIT : 0) |
+                    (domain->cores.explicit ? CONFIG_BINARY_CORES_EXPLICIT : 0) |
+                    (domain->numa_local_explicit ? CONFIG_BINARY_NUMA_LOCAL_EXPLICIT : 0) |
+                    (domain->memory_tier_explicit ? CONFIG_BINARY_MEMORY_TIER_EXPLICIT : 0) |
+                    (domain->dependencies.explicit ? CONFIG_BINARY_DEPS_EXPLICIT : 0);
+
+    /* name[] is not trusted to be terminated: stop at the record's limit */
+    size_t name_max = sizeof(record->name) - 1;
+    const char *end = memchr(domain->name, '\0', name_max);
+    memcpy(record->name, domain->name,
+           end != NULL ? (size_t)(end - domain->name) : name_max);
+    memcpy(record->cores, domain->cores.bitmap, sizeof(record->cores));
+
+    for (uint32_t i = 0; i < domain->dependencies.count; i++) {
+        uint32_t position;
+        if (!find_position(graph, domain->dependencies.depends_on[i], &position)) {
+            return false;
+        }
+        record->depends_on |= 1ULL << position;
+    }
+
+    return true;
+}
+
+size_t config_binary_encode(
+    const domain_graph_t *graph,
+    void *out,
+    size_t capacity,
+    config_binary_status_t *status
+) {
+    size_t size = sizeof(config_binary_header_t) +
+                  graph->domain_count * sizeof(config_binary_record_t);
+    uint8_t *bytes = out;
+
+    status->error = CONFIG_BINARY_ERROR_NONE;
+    status->record = UINT32_MAX;
+
+    config_binary_header_t header = {
+        .magic        = CONFIG_BINARY_MAGIC,
+        .version      = CONFIG_BINARY_VERSION,
+        .header_size  = sizeof(config_binary_header_t),
+        .record_size  = sizeof(config_binary_record_t),
+        .core_words   = CORE_SET_WORDS,
+        .domain_count = graph->domain_count,
+    };
+
+    /* Records are resolved even when they will not be written, so a
+     * sizing call reports unresolved dependencies too */
+    for (uint32_t p = 0; p < graph->domain_count; p++) {
+        config_binary_record_t record;
+
+        if (!encode_record(graph, &graph->domains[p], &record)) {
+            status->error = CONFIG_BINARY_ERROR_UNRESOLVED_DEPENDENCY;
+            status->record = p;
+            return 0;
+        }
+
+        if (size <= capacity) {
+            memcpy(bytes + sizeof(header) + p * sizeof(record), &record, sizeof(record));
+        }
+    }
+
+    if (size <= capacity) {
+        memcpy(bytes, &header, sizeof(header));
+        header.checksum = config_binary_checksum(bytes, size);
+        memcpy(bytes + offsetof(config_binary_header_t, checksum), &header.checksum,
+               sizeof(header.checksum));
+    }
+
+    return size;
+}
+
+/* ========================================================================
+ * LOAD
+ * ======================================================================== */
+
+static bool binary_fail(config_binary_status_t *status, config_binary_error_t error,
+                        uint32_t record) {
+    status->error = error;
+    status->record = record;
+    return false;
+}
+
+static bool check_header(const config_binary_header_t *header, size_t size,
+                         config_binary_status_t *status) {
+    if (memcmp(header->magic, CONFIG_BINARY_MAGIC, sizeof(header->magic)) != 0) {
+        return binary_fail(status, CONFIG_BINARY_ERROR_MAGIC, UINT32_MAX);
+    }
+
+    if (header->version != CONFIG_BINARY_VERSION) {
+        return binary_fail(status, CONFIG_BINARY_ERROR_VERSION, UINT32_MAX);
+    }
+
+    if (header->header_size != sizeof(config_binary_header_t) ||
+        header->record_size != sizeof(config_binary_record_t) ||
+        header->core_words != CORE_SET_WORDS) {
+        return binary_fail(status, CONFIG_BINARY_ERROR_LAYOUT, UINT32_MAX);
+    }
+
+    if (header->domain_count > MAX_DOMAINS) {
+        return binary_fail(status, CONFIG_BINARY_ERROR_TOO_MANY_DOMAINS, UINT32_MAX);
+    }
+
+    if (size != sizeof(config_binary_header_t) +
+                (size_t)header->domain_count * sizeof(config_binary_record_t)) {
+        return binary_fail(status, CONFIG_BINARY_ERROR_SIZE, UINT32_MAX);
+    }
+
+    return true;
+}
+
+/* Ranges mirror what config_parse_domains() can produce */
+static bool record_is_valid(const config_binary_record_t *record, uint32_t count) {
+    uint64_t positions = count == 64 ? ~0ULL : (1ULL << count) - 1;
+
+    return record->id != DOMAIN_ID_INVALID &&
+           record->core_count <= MAX_DOMAIN_CORES &&
+           record->security_level <= SECURITY_LEVEL_MAX &&
+           record->preemption <= PREEMPTION_BY_ANY &&
+           record->cache_isolation <= CACHE_ISOLATION_FULL &&
+           record->memory_type <= MEMORY_DOMAIN_SHARED_WRITE &&
+           record->memory_tier <= MEMORY_TIER_FAR &&
+           record->smt <= SMT_POLICY_EXCLUSIVE &&
+           record->numa_local <= 1 &&
+           (record->flags & ~CONFIG_BINARY_FLAGS_ALL) == 0 &&
+           record->name[sizeof(record->name) - 1] == '\0' &&
+           (record->depends_on & ~positions) == 0 &&
+           __builtin_popcountll(record->depends_on) <= MAX_DEPENDENCIES;
+}
+
+static void load_record(
+    const config_binary_record_t *record,
+    const uint8_t *records,
+    security_domain_t *domain
+) {
+    /* Same starting state as a parsed domain (unused slots invalid) */
+    memset(domain, 0, sizeof(*domain));
+    core_set_clear(&domain->cores);
+    dependency_set_clear(&domain->dependencies);
+
+    domain->id = record->id;
+    memcpy(domain->name, record->name, sizeof(domain->name));
+    domain->name_explicit = (record->flags & CONFIG_BINARY_NAME_EXPLICIT) != 0;
+
+    domain->security_level = (security_level_t)record->security_level;
+    domain->preemption = (preemption_policy_t)record->preemption;
+    domain->cache_isolation = (cache_isolation_t)record->cache_isolation;
+    domain->core_count = record->core_count;
+    domain->smt = (smt_policy_t)record->smt;
+    domain->memory_type = (memory_domain_type_t)record->memory_type;
+    domain->numa_local = record->numa_local != 0;
+    domain->numa_local_explicit = (record->flags & CONFIG_BINARY_NUMA_LOCAL_EXPLICIT) != 0;
+    domain->memory_tier = (memory_tier_t)record->memory_tier;
+    domain->memory_tier_explicit = (record->flags & CONFIG_BINARY_MEMORY_TIER_EXPLICIT) != 0;
+
+    /* Raw bitmap; words and count are derived, never stored */
+    uint32_t count = 0;
+    uint32_t words = 0;
+    for (uint32_t w = 0; w < CORE_SET_WORDS; w++) {
+        domain->cores.bitmap[w] = record->cores[w];
+        if (record->cores[w] != 0) {
+            count += (uint32_t)__builtin_popcountll(record->cores[w]);
+            words = w + 1;
+        }
+    }
+    domain->cores.words = words;
+    domain->cores.count = count;
+    domain->cores.explicit = (record->flags & CONFIG_BINARY_CORES_EXPLICIT) != 0;
+
+    /* Dependency IDs come from the referenced records, already in the image */
+    for (uint64_t deps = record->depends_on; deps != 0; deps &= deps - 1) {
+        uint32_t position = (uint32_t)__builtin_ctzll(deps);
+        domain_id_t id;
+
+        memcpy(&id, records + position * sizeof(config_binary_record_t) +
+                    offsetof(config_binary_record_t, id), sizeof(id));
+        domain->dependencies.depends_on[domain->dependencies.count++] = id;
+    }
+    domain->dependencies.explicit = (record->flags & CONFIG_BINARY_DEPS_EXPLICIT) != 0;
+}
+
+bool config_binary_load(
+    const void *image,
+    size_t size,
+    domain_graph_t *graph,
+    config_binary_status_t *status
+) {
+    const uint8_t *bytes = image;
+    config_binary_header_t header;
+
+    status->error = CONFIG_BINARY_ERROR_NONE;
+    status->record = UINT32_MAX;
+
+    if (graph->sealed) {
+        return binary_fail(status, CONFIG_BINARY_ERROR_GRAPH_SEALED, UINT32_MAX);
+    }
+
+    graph->domain_count = 0;
+    graph->validated = false;
+
+    if (size < sizeof(header)) {
+        return binary_fail(status, CONFIG_BINARY_ERROR_SIZE, UINT32_MAX);
+    }
+
+    memcpy(&header, bytes, sizeof(header));
+    if (!check_header(&header, size, status)) {
+        return false;
+    }
+
+    if (config_binary_checksum(bytes, size) != header.checksum) {
+        return binary_fail(status, CONFIG_BINARY_ERROR_CHECKSUM, UINT32_MAX);
+    }
+
+    const uint8_t *records = bytes + sizeof(header);
+
+    for (uint32_t p = 0; p < header.domain_count; p++) {
+        config_binary_record_t record;
+        memcpy(&record, records + p * sizeof(record), sizeof(record));
+
+        if (!record_is_valid(&record, header.domain_count)) {
+            graph->domain_count = 0;
+            return binary_fail(status, CONFIG_BINARY_ERROR_INVALID_RECORD, p);
+        }
+
+        load_record(&record, records, &graph->domains[p]);
+        graph->domain_count = p + 1;
+    }
+
+    return true;
+}
+
+/* ========================================================================
+ * ERROR REPORTING
+ * ======================================================================== */
+
+const char* config_binary_error_string(config_binary_error_t error) {
+    switch (error) {
+        case CONFIG_BINARY_ERROR_NONE:
+            return "No error";
+        case CONFIG_BINARY_ERROR_SIZE:
+            return "Image size does not match header";
+        case CONFIG_BINARY_ERROR_MAGIC:
+            return "Not a domain graph image";
+        case CONFIG_BINARY_ERROR_VERSION:
+            return "Unsupported image version";
+        case CONFIG_BINARY_ERROR_LAYOUT:
+            return "Record layout differs from this build (UCQCF_MAX_CPUS?)";
+        case CONFIG_BINARY_ERROR_TOO_MANY_DOMAINS:
+            return "Too many domains";
+        case CONFIG_BINARY_ERROR_CHECKSUM:
+            return "Checksum mismatch";
+        case CONFIG_BINARY_ERROR_INVALID_RECORD:
+            return "Record field out of range";
+        case CONFIG_BINARY_ERROR_UNRESOLVED_DEPENDENCY:
+            return "Dependency names a domain not in the graph";
+        case CONFIG_BINARY_ERROR_GRAPH_SEALED:
+            return "Domain graph already sealed";
+        default:
+            return "Unknown error";
+    }
+}
@@ -0,0 +1,1113 @@
+/**
+ * config/domain_config.c
+ *
+ * Domain layout parser, emitter and compiler
+ *
+ * APPROACH:
+ *   One pass over the text, one line at a time. Indentation selects
+ *   the structure ("domains:" at column 1, "- " starts a domain, deeper
+ *   "key: value" lines fill it); values are decoded in place straight
+ *   into graph->domains[]. Nothing is copied except domain names.
+ *
+ *   The emitter and compiler write through a bounded writer that keeps
+ *   counting past capacity, so callers can size a buffer with a first
+ *   call and fill it with a second.
+ *
+ * GUARANTEES:
+ *   - No dynamic allocation, no recursion
+ *   - Text need not be NUL-terminated
+ *   - First error stops parsing and is reported with line and column
+ *   - Same graph, same text
+ */
+
+#include "config_contract.h"
+#include <string.h>
+
+/* ========================================================================
+ * TOKENS
+ * ======================================================================== */
+
+typedef struct {
+    const char *text;
+    uint32_t    length;
+    uint32_t    column;   /* 1-based */
+} config_token_t;
+
+typedef struct {
+    config_parse_status_t *status;
+    uint32_t               line;
+} config_parser_t;
+
+static bool parse_fail(config_parser_t *parser, config_error_t error, uint32_t column) {
+    parser->status->error = error;
+    parser->status->line = parser->line;
+    parser->status->column = column;
+    return false;
+}
+
+static bool token_equals(const config_token_t *token, const char *word) {
+    size_t length = strlen(word);
+    return token->length == length && memcmp(token->text, word, length) == 0;
+}
+
+static void token_trim(config_token_t *token) {
+    while (token->length > 0 && (token->text[0] == ' ' || token->text[0] == '\t')) {
+        token->text++;
+        token->length--;
+        token->column++;
+    }
+    while (token->length > 0 && (token->text[token->length - 1] == ' ' ||
+                                 token->text[token->length - 1] == '\t' ||
+                                 token->text[token->length - 1] == '\r')) {
+        token->length--;
+    }
+}
+
+/* Split "key: value" (value may be empty) */
+static bool split_key_value(
+    config_parser_t *parser,
+    const config_token_t *line,
+    config_token_t *key,
+    config_token_t *value
+) {
+    uint32_t i = 0;
+
+    while (i < line->length &&
+           ((line->text[i] >= 'a' && line->text[i] <= 'z') ||
+            (line->text[i] >= 'A' && line->text[i] <= 'Z') ||
+            (line->text[i] >= '0' && line->text[i] <= '9') ||
+            line->text[i] == '_')) {
+        i++;
+    }
+
+    if (i == 0 || i >= line->length || line->text[i] != ':' ||
+        (i + 1 < line->length && line->text[i + 1] != ' ')) {
+        return parse_fail(parser, CONFIG_ERROR_SYNTAX, line->column);
+    }
+
+    *key = (config_token_t){ line->text, i, line->column };
+    *value = (config_token_t){ line->text + i + 1, line->length - i - 1,
+                               line->column + i + 1 };
+    token_trim(value);
+    return true;
+}
+
+/* ========================================================================
+ * SCALARS
+ * ======================================================================== */
+
+static bool parse_uint(const config_token_t *token, uint32_t *value) {
+    uint64_t v = 0;
+
+    if (token->length == 0 || token->length > 10) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < token->length; i++) {
+        if (token->text[i] < '0' || token->text[i] > '9') {
+            return false;
+        }
+        v = v * 10 + (uint64_t)(token->text[i] - '0');
+    }
+
+    if (v > UINT32_MAX) {
+        return false;
+    }
+
+    *value = (uint32_t)v;
+    return true;
+}
+
+typedef struct {
+    const char *word;
+    uint32_t    length;   /* Compared first: most misses cost no memcmp */
+    uint32_t    value;
+} config_word_t;
+
+#define WORD(text, value) { (text), sizeof(text) - 1, (value) }
+
+static bool parse_word(
+    const config_token_t *token,
+    const config_word_t *words,
+    uint32_t count,
+    uint32_t *value
+) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (token->length == words[i].length &&
+            memcmp(token->text, words[i].word, words[i].length) == 0) {
+            *value = words[i].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static const config_word_t preemption_words[] = {
+    WORD("never",     PREEMPTION_NEVER),
+    WORD("by_higher", PREEMPTION_BY_HIGHER),
+    WORD("by_same",   PREEMPTION_BY_SAME),
+    WORD("by_any",    PREEMPTION_BY_ANY),
+};
+
+static const config_word_t cache_isolation_words[] = {
+    WORD("none", CACHE_ISOLATION_NONE),
+    WORD("l1",   CACHE_ISOLATION_L1),
+    WORD("l2",   CACHE_ISOLATION_L2),
+    WORD("l3",   CACHE_ISOLATION_L3),
+    WORD("full", CACHE_ISOLATION_FULL),
+};
+
+static const config_word_t memory_type_words[] = {
+    WORD("isolated",     MEMORY_DOMAIN_ISOLATED),
+    WORD("shared_read",  MEMORY_DOMAIN_SHARED_READ),
+    WORD("shared_write", MEMORY_DOMAIN_SHARED_WRITE),
+};
+
+static const config_word_t memory_tier_words[] = {
+    WORD("local", MEMORY_TIER_LOCAL),
+    WORD("hbm",   MEMORY_TIER_HBM),
+    WORD("far",   MEMORY_TIER_FAR),
+};
+
+static const config_word_t smt_words[] = {
+    WORD("shared",    SMT_POLICY_SHARED),
+    WORD("exclusive", SMT_POLICY_EXCLUSIVE),
+};
+
+static const config_word_t bool_words[] = {
+    WORD("true",  1),
+    WORD("false", 0),
+};
+
+#define WORDS(table) (table), (uint32_t)(sizeof(table) / sizeof((table)[0]))
+
+/* ========================================================================
+ * FLOW SEQUENCES ([1, 2, 3])
+ * ======================================================================== */
+
+typedef bool (*config_item_fn)(
+    config_parser_t *parser, security_domain_t *domain,
+    const config_token_t *item, uint32_t value);
+
+static bool parse_flow_sequence(
+    config_parser_t *parser,
+    security_domain_t *domain,
+    const config_token_t *value,
+    config_item_fn add
+) {
+    if (value->length < 2 || value->text[0] != '[' ||
+        value->text[value->length - 1] != ']') {
+        return parse_fail(parser, CONFIG_ERROR_INVALID_VALUE, value->column);
+    }
+
+    config_token_t rest = { value->text + 1, value->length - 2, value->column + 1 };
+    token_trim(&rest);
+
+    while (rest.length > 0) {
+        uint32_t i = 0;
+        while (i < rest.length && rest.text[i] != ',') {
+            i++;
+        }
+
+        config_token_t item = { rest.text, i, rest.column };
+        token_trim(&item);
+
+        uint32_t number;
+        if (!parse_uint(&item, &number)) {
+            return parse_fail(parser, CONFIG_ERROR_INVALID_VALUE, item.column);
+        }
+
+        if (!add(parser, domain, &item, number)) {
+            return false;
+        }
+
+        if (i == rest.length) {
+            break;
+        }
+
+        rest = (config_token_t){ rest.text + i + 1, rest.length - i - 1,
+                                 rest.column + i + 1 };
+        token_trim(&rest);
+
+        if (rest.length == 0) {
+            return parse_fail(parser, CONFIG_ERROR_INVALID_VALUE, rest.column);
+        }
+    }
+
+    return true;
+}
+
+static bool add_core(
+    config_parser_t *parser,
+    security_domain_t *domain,
+    const config_token_t *item,
+    uint32_t core
+) {
+    if (core >= MAX_DOMAIN_CORES) {
+        return parse_fail(parser, CONFIG_ERROR_INVALID_VALUE, item->column);
+    }
+
+    core_set_add(&domain->cores, core);
+    return true;
+}
+
+static bool add_dependency(
+    config_parser_t *parser,
+    security_domain_t *domain,
+    const config_token_t *item,
+    uint32_t id
+) {
+    if (domain->dependencies.count >= MAX_DEPENDENCIES) {
+        return parse_fail(parser, CONFIG_ERROR_TOO_MANY_DEPENDENCIES, item->column);
+    }
+
+    dependency_set_add(&domain->dependencies, id);
+    return true;
+}
+
+/* ========================================================================
+ * DOMAIN FIELDS
+ * ======================================================================== */
+
+typedef enum {
+    FIELD_ID = 0,
+    FIELD_NAME,
+    FIELD_SECURITY_LEVEL,
+    FIELD_PREEMPTION,
+    FIELD_CORES,
+    FIELD_CACHE_ISOLATION,
+    FIELD_MEMORY_TYPE,
+    FIELD_NUMA_LOCAL,
+    FIELD_MEMORY_TIER,
+    FIELD_DEPENDENCIES,
+    FIELD_CORE_COUNT,
+    FIELD_SMT,
+    FIELD_COUNT
+} config_field_t;
+
+static const config_word_t field_words[FIELD_COUNT] = {
+    [FIELD_ID]              = WORD("id", FIELD_ID),
+    [FIELD_NAME]            = WORD("name", FIELD_NAME),
+    [FIELD_SECURITY_LEVEL]  = WORD("security_level", FIELD_SECURITY_LEVEL),
+    [FIELD_PREEMPTION]      = WORD("preemption", FIELD_PREEMPTION),
+    [FIELD_CORES]           = WORD("cores", FIELD_CORES),
+    [FIELD_CACHE_ISOLATION] = WORD("cache_isolation", FIELD_CACHE_ISOLATION),
+    [FIELD_MEMORY_TYPE]     = WORD("memory_type", FIELD_MEMORY_TYPE),
+    [FIELD_NUMA_LOCAL]      = WORD("numa_local", FIELD_NUMA_LOCAL),
+    [FIELD_MEMORY_TIER]     = WORD("memory_tier", FIELD_MEMORY_TIER),
+    [FIELD_DEPENDENCIES]    = WORD("dependencies", FIELD_DEPENDENCIES),
+    [FIELD_CORE_COUNT]      = WORD("core_count", FIELD_CORE_COUNT),
+    [FIELD_SMT]             = WORD("smt", FIELD_SMT),
+};
+
+static bool parse_name(
+    config_parser_t *parser,
+    security_domain_t *domain,
+    const config_token_t *value
+) {
+    config_token_t name = *value;
+
+    if (name.length > 0 && name.text[0] == '"') {
+        if (name.length < 2 || name.text[name.length - 1] != '"') {
+            return parse_fail(parser, CONFIG_ERROR_INVALID_VALUE, value->column);
+        }
+        name.text++;
+        name.length -= 2;
+    }
+
+    /* Escapes are not part of the subset */
+    if (name.length >= sizeof(domain->name) || memchr(name.text, '\\', name.length)) {
+        return parse_fail(parser, CONFIG_ERROR_INVALID_VALUE, value->column);
+    }
+
+    memcpy(domain->name, name.text, name.length);
+    domain->name[name.length] = '\0';
+    domain->name_explicit = true;
+    return true;
+}
+
+static bool apply_field(
+    config_parser_t *parser,
+    security_domain_t *domain,
+    uint32_t *seen,
+    const config_token_t *key,
+    const config_token_t *value
+) {
+    uint32_t field;
+    if (!parse_word(key, WORDS(field_words), &field)) {
+        return parse_fail(parser, CONFIG_ERROR_UNKNOWN_KEY, key->column);
+    }
+
+    if (*seen & (1u << field)) {
+        return parse_fail(parser, CONFIG_ERROR_DUPLICATE_KEY, key->column);
+    }
+    *seen |= 1u << field;
+
+    uint32_t v = 0;
+    bool ok = true;
+
+    switch ((config_field_t)field) {
+        case FIELD_ID:
+            ok = parse_uint(value, &v) && v != DOMAIN_ID_INVALID;
+            domain->id = v;
+            break;
+
+        case FIELD_NAME:
+            return parse_name(parser, domain, value);
+
+        case FIELD_SECURITY_LEVEL:
+            /* Levels 0..7 map onto SECURITY_LEVEL_0..SECURITY_LEVEL_7 */
+            ok = parse_uint(value, &v) &&
+                 v <= SECURITY_LEVEL_MAX - SECURITY_LEVEL_0;
+            domain->security_level = (security_level_t)(SECURITY_LEVEL_0 + v);
+            break;
+
+        case FIELD_PREEMPTION:
+            ok = parse_word(value, WORDS(preemption_words), &v);
+            domain->preemption = (preemption_policy_t)v;
+            break;
+
+        case FIELD_CORES:
+            if (!parse_flow_sequence(parser, domain, value, add_core)) {
+                return false;
+            }
+            domain->cores.explicit = true;
+            break;
+
+        case FIELD_CACHE_ISOLATION:
+            ok = parse_word(value, WORDS(cache_isolation_words), &v);
+            domain->cache_isolation = (cache_isolation_t)v;
+            break;
+
+        case FIELD_MEMORY_TYPE:
+            ok = parse_word(value, WORDS(memory_type_words), &v);
+            domain->memory_type = (memory_domain_type_t)v;
+            break;
+
+        case FIELD_NUMA_LOCAL:
+            ok = parse_word(value, WORDS(bool_words), &v);
+            domain->numa_local = v != 0;
+            domain->numa_local_explicit = ok;
+            break;
+
+        case FIELD_MEMORY_TIER:
+            ok = parse_word(value, WORDS(memory_tier_words), &v);
+            domain->memory_tier = (memory_tier_t)v;
+            domain->memory_tier_explicit = ok;
+            break;
+
+        case FIELD_DEPENDENCIES:
+            if (!parse_flow_sequence(parser, domain, value, add_dependency)) {
+                return false;
+            }
+            domain->dependencies.explicit = true;
+            break;
+
+        case FIELD_CORE_COUNT:
+            ok = parse_uint(value, &v) && v > 0 && v <= MAX_DOMAIN_CORES;
+            domain->core_count = v;
+            break;
+
+        case FIELD_SMT:
+            ok = parse_word(value, WORDS(smt_words), &v);
+            domain->smt = (smt_policy_t)v;
+            break;
+
+        default:
+            break;
+    }
+
+    if (!ok) {
+        return parse_fail(parser, CONFIG_ERROR_INVALID_VALUE, value->column);
+    }
+
+    return true;
+}
+
+/* ========================================================================
+ * DOCUMENT
+ * ======================================================================== */
+
+/* Line content with indentation and trailing comment removed */
+static bool scan_line(
+    config_parser_t *parser,
+    const char *start,
+    const char *end,
+    config_token_t *content,
+    uint32_t *indent
+) {
+    const char *p = start;
+
+    while (p < end && *p == ' ') {
+        p++;
+    }
+
+    if (p < end && *p == '\t') {
+        return parse_fail(parser, CONFIG_ERROR_SYNTAX, (uint32_t)(p - start) + 1);
+    }
+
+    *indent = (uint32_t)(p - start);
+
+    /* '#' starts a comment at line start or after whitespace, outside quotes */
+    const char *q = p;
+    bool quoted = false;
+
+    while (q < end) {
+        if (*q == '"') {
+            quoted = !quoted;
+        } else if (*q == '#' && !quoted && (q == p || q[-1] == ' ' || q[-1] == '\t')) {
+            break;
+        }
+        q++;
+    }
+
+    *content = (config_token_t){ p, (uint32_t)(q - p), *indent + 1 };
+    token_trim(content);
+    return true;
+}
+
+static security_domain_t* begin_domain(config_parser_t *parser, domain_graph_t *graph,
+                                       uint32_t column) {
+    if (graph->domain_count >= MAX_DOMAINS) {
+        parse_fail(parser, CONFIG_ERROR_TOO_MANY_DOMAINS, column);
+        return NULL;
+    }
+
+    security_domain_t *domain = &graph->domains[graph->domain_count++];
+    memset(domain, 0, sizeof(*domain));
+    core_set_clear(&domain->cores);
+    dependency_set_clear(&domain->dependencies);
+
+    graph->validated = false;
+    parser->status->domain_count = graph->domain_count;
+    return domain;
+}
+
+bool config_parse_domains(
+    const char *text,
+    size_t length,
+    domain_graph_t *graph,
+    config_parse_status_t *status
+) {
+    config_parser_t parser = { .status = status, .line = 0 };
+    memset(status, 0, sizeof(*status));
+
+    if (graph->sealed) {
+        return parse_fail(&parser, CONFIG_ERROR_GRAPH_SEALED, 0);
+    }
+
+    const char *end = text + length;
+    bool in_domains = false;
+    security_domain_t *domain = NULL;
+    uint32_t item_indent = 0;
+    uint32_t seen = 0;
+
+    for (const char *line = text; line < end; ) {
+        const char *eol = memchr(line, '\n', (size_t)(end - line));
+        if (!eol) {
+            eol = end;
+        }
+
+        parser.line++;
+
+        config_token_t content, key, value;
+        uint32_t indent;
+
+        if (!scan_line(&parser, line, eol, &content, &indent)) {
+            return false;
+        }
+
+        line = eol + 1;
+
+        if (content.length == 0) {
+            continue;
+        }
+
+        /* Top-level section */
+        if (indent == 0) {
+            if (!split_key_value(&parser, &content, &key, &value)) {
+                return false;
+            }
+
+            in_domains = token_equals(&key, "domains");
+            domain = NULL;
+
+            if (in_domains && value.length > 0 && !token_equals(&value, "[]")) {
+                return parse_fail(&parser, CONFIG_ERROR_SYNTAX, value.column);
+            }
+            continue;
+        }
+
+        if (!in_domains) {
+            continue;
+        }
+
+        /* "- " starts a domain; the rest of the line is its first field */
+        if (content.text[0] == '-' &&
+            (content.length == 1 || content.text[1] == ' ')) {
+            domain = begin_domain(&parser, graph, content.column);
+            if (!domain) {
+                return false;
+            }
+
+            item_indent = indent;
+            seen = 0;
+
+            content = (config_token_t){ content.text + 1, content.length - 1,
+                                        content.column + 1 };
+            token_trim(&content);
+            if (content.length == 0) {
+                continue;
+            }
+        } else if (!domain || indent <= item_indent) {
+            return parse_fail(&parser, CONFIG_ERROR_SYNTAX, content.column);
+        }
+
+        if (!split_key_value(&parser, &content, &key, &value) ||
+            !apply_field(&parser, domain, &seen, &key, &value)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* ========================================================================
+ * EMITTER
+ * ======================================================================== */
+
+typedef struct {
+    char   *out;
+    size_t  capacity;
+    size_t  length;     /* Full length, even past capacity */
+} config_writer_t;
+
+static void emit_text(config_writer_t *writer, const char *text, size_t length) {
+    if (writer->length + length < writer->capacity) {
+        memcpy(writer->out + writer->length, text, length);
+    }
+    writer->length += length;
+}
+
+static void emit_str(config_writer_t *writer, const char *text) {
+    emit_text(writer, text, strlen(text));
+}
+
+static void emit_uint(config_writer_t *writer, uint32_t value) {
+    char digits[10];
+    uint32_t n = 0;
+
+    do {
+        digits[sizeof(digits) - 1 - n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    emit_text(writer, digits + sizeof(digits) - n, n);
+}
+
+static void emit_key(config_writer_t *writer, config_field_t field) {
+    emit_str(writer, "    ");
+    emit_str(writer, field_words[field].word);
+    emit_str(writer, ": ");
+}
+
+/* Fields whose value is not in the table (UNDEFINED) are left out */
+static void emit_word(
+    config_writer_t *writer,
+    config_field_t field,
+    const config_word_t *words,
+    uint32_t count,
+    uint32_t value
+) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (words[i].value == value) {
+            emit_key(writer, field);
+            emit_str(writer, words[i].word);
+            emit_str(writer, "\n");
+            return;
+        }
+    }
+}
+
+static void emit_domain(config_writer_t *writer, const security_domain_t *domain) {
+    emit_str(writer, "  - id: ");
+    emit_uint(writer, domain->id);
+    emit_str(writer, "\n");
+
+    if (domain->name_explicit) {
+        emit_key(writer, FIELD_NAME);
+        emit_str(writer, "\"");
+        emit_str(writer, domain->name);
+        emit_str(writer, "\"\n");
+    }
+
+    if (domain->security_level >= SECURITY_LEVEL_0 &&
+        domain->security_level <= SECURITY_LEVEL_MAX) {
+        emit_key(writer, FIELD_SECURITY_LEVEL);
+        emit_uint(writer, (uint32_t)(domain->security_level - SECURITY_LEVEL_0));
+        emit_str(writer, "\n");
+    }
+
+    emit_word(writer, FIELD_PREEMPTION, WORDS(preemption_words), domain->preemption);
+
+    if (domain->cores.explicit) {
+        const char *separator = "";
+        core_id_t core;
+
+        emit_key(writer, FIELD_CORES);
+        emit_str(writer, "[");
+        CORE_SET_FOR_EACH(core, &domain->cores) {
+            emit_str(writer, separator);
+            emit_uint(writer, core);
+            separator = ", ";
+        }
+        emit_str(writer, "]\n");
+    }
+
+    if (domain->core_count > 0) {
+        emit_key(writer, FIELD_CORE_COUNT);
+        emit_uint(writer, domain->core_count);
+        emit_str(writer, "\n");
+    }
+
+    emit_word(writer, FIELD_SMT, WORDS(smt_words), domain->smt);
+    emit_word(writer, FIELD_CACHE_ISOLATION, WORDS(cache_isolation_words),
+              domain->cache_isolation);
+    emit_word(writer, FIELD_MEMORY_TYPE, WORDS(memory_type_words), domain->memory_type);
+
+    if (domain->numa_local_explicit) {
+        emit_word(writer, FIELD_NUMA_LOCAL, WORDS(bool_words), domain->numa_local);
+    }
+
+    if (domain->memory_tier_explicit) {
+        emit_word(writer, FIELD_MEMORY_TIER, WORDS(memory_tier_words),
+                  domain->memory_tier);
+    }
+
+    if (domain->dependencies.explicit) {
+        emit_key(writer, FIELD_DEPENDENCIES);
+        emit_str(writer, "[");
+        for (uint32_t i = 0; i < domain->dependencies.count; i++) {
+            emit_str(writer, i ? ", " : "");
+            emit_uint(writer, domain->dependencies.depends_on[i]);
+        }
+        emit_str(writer, "]\n");
+    }
+}
+
+size_t config_emit_domains(
+    const domain_graph_t *graph,
+    char *out,
+    size_t capacity
+) {
+    config_writer_t writer = { .out = out, .capacity = capacity, .length = 0 };
+
+    emit_str(&writer, "domains:\n");
+    for (uint32_t i = 0; i < graph->domain_count; i++) {
+        emit_domain(&writer, &graph->domains[i]);
+    }
+
+    if (writer.length < capacity) {
+        out[writer.length] = '\0';
+    }
+    return writer.length;
+}
+
+/* ========================================================================
+ * LAYOUT COMPILER (C header)
+ *
+ * Every structural value the asserts read is a DOMAIN_LAYOUT_<pos>_*
+ * macro that the table initializer also uses, so a hand edit to the
+ * header cannot change the table without re-running the asserts.
+ * ======================================================================== */
+
+#define SYMBOL(name) [name] = #name
+
+static const char *const security_level_symbols[] = {
+    SYMBOL(SECURITY_LEVEL_UNDEFINED),
+    SYMBOL(SECURITY_LEVEL_0), SYMBOL(SECURITY_LEVEL_1),
+    SYMBOL(SECURITY_LEVEL_2), SYMBOL(SECURITY_LEVEL_3),
+    SYMBOL(SECURITY_LEVEL_4), SYMBOL(SECURITY_LEVEL_5),
+    SYMBOL(SECURITY_LEVEL_6), SYMBOL(SECURITY_LEVEL_7),
+};
+
+static const char *const preemption_symbols[] = {
+    SYMBOL(PREEMPTION_UNDEFINED), SYMBOL(PREEMPTION_NEVER),
+    SYMBOL(PREEMPTION_BY_HIGHER), SYMBOL(PREEMPTION_BY_SAME),
+    SYMBOL(PREEMPTION_BY_ANY),
+};
+
+static const char *const cache_isolation_symbols[] = {
+    SYMBOL(CACHE_ISOLATION_UNDEFINED), SYMBOL(CACHE_ISOLATION_NONE),
+    SYMBOL(CACHE_ISOLATION_L1), SYMBOL(CACHE_ISOLATION_L2),
+    SYMBOL(CACHE_ISOLATION_L3), SYMBOL(CACHE_ISOLATION_FULL),
+};
+
+static const char *const memory_type_symbols[] = {
+    SYMBOL(MEMORY_DOMAIN_UNDEFINED), SYMBOL(MEMORY_DOMAIN_ISOLATED),
+    SYMBOL(MEMORY_DOMAIN_SHARED_READ), SYMBOL(MEMORY_DOMAIN_SHARED_WRITE),
+};
+
+static const char *const memory_tier_symbols[] = {
+    SYMBOL(MEMORY_TIER_LOCAL), SYMBOL(MEMORY_TIER_HBM), SYMBOL(MEMORY_TIER_FAR),
+};
+
+static const char *const smt_symbols[] = {
+    SYMBOL(SMT_POLICY_UNDEFINED), SYMBOL(SMT_POLICY_SHARED),
+    SYMBOL(SMT_POLICY_EXCLUSIVE),
+};
+
+#define SYMBOLS(table) (table), (uint32_t)(sizeof(table) / sizeof((table)[0]))
+
+static void emit_symbol(
+    config_writer_t *writer,
+    const char *const *symbols,
+    uint32_t count,
+    uint32_t value
+) {
+    if (value < count && symbols[value]) {
+        emit_str(writer, symbols[value]);
+    } else {
+        emit_uint(writer, value);   /* Not a known enumerator */
+    }
+}
+
+static void emit_hex64(config_writer_t *writer, uint64_t value) {
+    static const char hex[] = "0123456789abcdef";
+    char digits[16];
+
+    for (uint32_t i = 0; i < 16; i++) {
+        digits[i] = hex[(value >> (60 - 4 * i)) & 0xF];
+    }
+
+    emit_str(writer, "0x");
+    emit_text(writer, digits, sizeof(digits));
+    emit_str(writer, "ULL");
+}
+
+/* DOMAIN_LAYOUT_<position>_<suffix> */
+static void emit_layout_name(config_writer_t *writer, uint32_t position, const char *suffix) {
+    emit_str(writer, "DOMAIN_LAYOUT_");
+    emit_uint(writer, position);
+    emit_str(writer, "_");
+    emit_str(writer, suffix);
+}
+
+static void emit_define(config_writer_t *writer, uint32_t position, const char *suffix) {
+    emit_str(writer, "#define ");
+    emit_layout_name(writer, position, suffix);
+    emit_str(writer, " ");
+}
+
+static void emit_core_word(config_writer_t *writer, uint32_t position, uint32_t word) {
+    emit_layout_name(writer, position, "CORES_");
+    emit_uint(writer, word);
+}
+
+static void emit_layout_defines(
+    config_writer_t *writer,
+    const domain_graph_t *graph,
+    uint32_t position,
+    uint32_t rank,
+    uint32_t words
+) {
+    const security_domain_t *domain = &graph->domains[position];
+
+    emit_str(writer, "/* Position ");
+    emit_uint(writer, position);
+    emit_str(writer, ": ");
+    for (const char *c = domain->name; *c; c++) {
+        if (*c == '/' && c != domain->name && c[-1] == '*') {
+            emit_str(writer, " ");   /* A name must not close the comment */
+        }
+        emit_text(writer, c, 1);
+    }
+    emit_str(writer, " */\n");
+
+    emit_define(writer, position, "ID");
+    emit_uint(writer, domain->id);
+    emit_str(writer, "u\n");
+
+    emit_define(writer, position, "RANK");
+    emit_uint(writer, rank);
+    emit_str(writer, "u\n");
+
+    emit_define(writer, position, "SECURITY_LEVEL");
+    emit_symbol(writer, SYMBOLS(security_level_symbols), domain->security_level);
+    emit_str(writer, "\n");
+
+    emit_define(writer, position, "PREEMPTION");
+    emit_symbol(writer, SYMBOLS(preemption_symbols), domain->preemption);
+    emit_str(writer, "\n");
+
+    emit_define(writer, position, "CACHE_ISOLATION");
+    emit_symbol(writer, SYMBOLS(cache_isolation_symbols), domain->cache_isolation);
+    emit_str(writer, "\n");
+
+    emit_define(writer, position, "MEMORY_TYPE");
+    emit_symbol(writer, SYMBOLS(memory_type_symbols), domain->memory_type);
+    emit_str(writer, "\n");
+
+    for (uint32_t w = 0; w < words; w++) {
+        emit_str(writer, "#define ");
+        emit_core_word(writer, position, w);
+        emit_str(writer, " ");
+        emit_hex64(writer, w < domain->cores.words ? domain->cores.bitmap[w] : 0);
+        emit_str(writer, "\n");
+    }
+
+    emit_str(writer, "\n");
+}
+
+static void emit_layout_entry(
+    config_writer_t *writer,
+    const domain_graph_t *graph,
+    uint32_t position,
+    uint32_t words
+) {
+    const security_domain_t *domain = &graph->domains[position];
+
+    emit_str(writer, "    {\n        .id = ");
+    emit_layout_name(writer, position, "ID");
+
+    emit_str(writer, ",\n        .name = \"");
+    for (const char *c = domain->name; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            emit_str(writer, "\\");
+        }
+        emit_text(writer, c, 1);
+    }
+    emit_str(writer, "\",\n        .name_explicit = ");
+    emit_str(writer, domain->name_explicit ? "true" : "false");
+
+    emit_str(writer, ",\n        .security_level = ");
+    emit_layout_name(writer, position, "SECURITY_LEVEL");
+    emit_str(writer, ",\n        .preemption = ");
+    emit_layout_name(writer, position, "PREEMPTION");
+
+    emit_str(writer, ",\n        .cores = {\n            .bitmap = { ");
+    for (uint32_t w = 0; w < words; w++) {
+        emit_str(writer, w ? ", " : "");
+        emit_core_word(writer, position, w);
+    }
+    emit_str(writer, " },\n            .words = ");
+    emit_uint(writer, domain->cores.words);
+    emit_str(writer, ",\n            .count = ");
+    emit_uint(writer, domain->cores.count);
+    emit_str(writer, ",\n            .explicit = ");
+    emit_str(writer, domain->cores.explicit ? "true" : "false");
+
+    emit_str(writer, ",\n        },\n        .cache_isolation = ");
+    emit_layout_name(writer, position, "CACHE_ISOLATION");
+    emit_str(writer, ",\n        .smt = ");
+    emit_symbol(writer, SYMBOLS(smt_symbols), domain->smt);
+    emit_str(writer, ",\n        .memory_type = ");
+    emit_layout_name(writer, position, "MEMORY_TYPE");
+    emit_str(writer, ",\n        .numa_local = ");
+    emit_str(writer, domain->numa_local ? "true" : "false");
+    emit_str(writer, ",\n        .numa_local_explicit = ");
+    emit_str(writer, domain->numa_local_explicit ? "true" : "false");
+    emit_str(writer, ",\n        .memory_tier = ");
+    emit_symbol(writer, SYMBOLS(memory_tier_symbols), domain->memory_tier);
+    emit_str(writer, ",\n        .memory_tier_explicit = ");
+    emit_str(writer, domain->memory_tier_explicit ? "true" : "false");
+
+    /* Empty initializer lists are not C11: leave depends_on zeroed */
+    emit_str(writer, ",\n        .dependencies = {\n");
+    for (uint32_t d = 0; d < domain->dependencies.count; d++) {
+        emit_str(writer, d ? ", " : "            .depends_on = { ");
+        emit_layout_name(writer,
+            domain_graph_index_of(graph, domain->dependencies.depends_on[d]), "ID");
+    }
+    if (domain->dependencies.count > 0) {
+        emit_str(writer, " },\n");
+    }
+    emit_str(writer, "            .count = ");
+    emit_uint(writer, domain->dependencies.count);
+    emit_str(writer, ",\n            .explicit = ");
+    emit_str(writer, domain->dependencies.explicit ? "true" : "false");
+    emit_str(writer, ",\n        },\n    },\n");
+}
+
+static void emit_layout_asserts(
+    config_writer_t *writer,
+    const domain_graph_t *graph,
+    uint32_t position,
+    uint32_t words
+) {
+    const security_domain_t *domain = &graph->domains[position];
+
+    /* Fields set */
+    emit_str(writer, "_Static_assert(");
+    emit_layout_name(writer, position, "ID");
+    emit_str(writer, " != DOMAIN_ID_INVALID &&\n    ");
+    emit_layout_name(writer, position, "SECURITY_LEVEL");
+    emit_str(writer, " != SECURITY_LEVEL_UNDEFINED &&\n    ");
+    emit_layout_name(writer, position, "PREEMPTION");
+    emit_str(writer, " != PREEMPTION_UNDEFINED &&\n    ");
+    emit_layout_name(writer, position, "CACHE_ISOLATION");
+    emit_str(writer, " != CACHE_ISOLATION_UNDEFINED &&\n    ");
+    emit_layout_name(writer, position, "MEMORY_TYPE");
+    emit_str(writer, " != MEMORY_DOMAIN_UNDEFINED &&\n    (");
+    for (uint32_t w = 0; w < words; w++) {
+        emit_str(writer, w ? " | " : "");
+        emit_core_word(writer, position, w);
+    }
+    emit_str(writer, ") != 0,\n    \"position ");
+    emit_uint(writer, position);
+    emit_str(writer, ": required field not set\");\n");
+
+    /* Unique IDs and disjoint cores, against every later position */
+    for (uint32_t other = position + 1; other < graph->domain_count; other++) {
+        emit_str(writer, "_Static_assert(");
+        emit_layout_name(writer, position, "ID");
+        emit_str(writer, " != ");
+        emit_layout_name(writer, other, "ID");
+        emit_str(writer, ", \"positions ");
+        emit_uint(writer, position);
+        emit_str(writer, " and ");
+        emit_uint(writer, other);
+        emit_str(writer, ": duplicate domain ID\");\n");
+
+        emit_str(writer, "_Static_assert((");
+        for (uint32_t w = 0; w < words; w++) {
+            emit_str(writer, w ? " | (" : "(");
+            emit_core_word(writer, position, w);
+            emit_str(writer, " & ");
+            emit_core_word(writer, other, w);
+            emit_str(writer, ")");
+        }
+        emit_str(writer, ") == 0, \"positions ");
+        emit_uint(writer, position);
+        emit_str(writer, " and ");
+        emit_uint(writer, other);
+        emit_str(writer, ": cores overlap\");\n");
+    }
+
+    /* Every dependency starts strictly first: acyclic, and never self */
+    for (uint32_t d = 0; d < domain->dependencies.count; d++) {
+        uint32_t target = domain_graph_index_of(graph, domain->dependencies.depends_on[d]);
+
+        emit_str(writer, "_Static_assert(");
+        emit_layout_name(writer, target, "RANK");
+        emit_str(writer, " < ");
+        emit_layout_name(writer, position, "RANK");
+        emit_str(writer, ", \"position ");
+        emit_uint(writer, position);
+        emit_str(writer, " must start after its dependency at position ");
+        emit_uint(writer, target);
+        emit_str(writer, "\");\n");
+    }
+}
+
+size_t config_compile_domains(
+    const domain_graph_t *graph,
+    const char *source,
+    char *out,
+    size_t capacity
+) {
+    config_writer_t writer = { .out = out, .capacity = capacity, .length = 0 };
+    uint32_t count = graph->domain_count;
+    uint32_t rank[MAX_DOMAINS];
+    uint32_t words = 1;
+
+    for (uint32_t k = 0; k < count; k++) {
+        rank[graph->startup_order[k]] = k;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (graph->domains[i].cores.words > words) {
+            words = graph->domains[i].cores.words;
+        }
+    }
+
+    emit_str(&writer,
+        "/**\n"
+        " * Compiled domain layout\n"
+        " *\n"
+        " * GENERATED by config_compile_domains() from ");
+    emit_str(&writer, source);
+    emit_str(&writer,
+        ".\n"
+        " * Do not edit: regenerate from the layout instead.\n"
+        " *\n"
+        " * Structural invariants (fields set, unique IDs, disjoint cores,\n"
+        " * acyclic dependencies) are _Static_asserts over the constants the\n"
+        " * table is built from. Load with domain_graph_validate_compiled(),\n"
+        " * which runs only the hardware-dependent checks.\n"
+        " *\n"
+        " * REQUIRES: domains/domain_contract.h included first\n"
+        " */\n\n"
+        "#ifndef UCQCF_DOMAIN_LAYOUT_TABLE_H\n"
+        "#define UCQCF_DOMAIN_LAYOUT_TABLE_H\n\n"
+        "#ifndef UCQCF_DOMAIN_CONTRACT_H\n"
+        "#error \"include domains/domain_contract.h before the compiled layout\"\n"
+        "#endif\n\n"
+        "#define DOMAIN_LAYOUT_COUNT ");
+    emit_uint(&writer, count);
+    emit_str(&writer, "u\n\n_Static_assert(CORE_SET_WORDS >= ");
+    emit_uint(&writer, words);
+    emit_str(&writer, ", \"layout needs UCQCF_MAX_CPUS >= ");
+    emit_uint(&writer, words * 64);
+    emit_str(&writer, "\");\n\n");
+
+    for (uint32_t i = 0; i < count; i++) {
+        emit_layout_defines(&writer, graph, i, rank[i], words);
+    }
+
+    emit_str(&writer, "static const security_domain_t domain_layout_table[");
+    emit_str(&writer, count ? "DOMAIN_LAYOUT_COUNT" : "1");
+    emit_str(&writer, "] = {\n");
+    for (uint32_t i = 0; i < count; i++) {
+        emit_layout_entry(&writer, graph, i, words);
+    }
+    emit_str(&writer, count ? "};\n\n" : "    { 0 },\n};\n\n");
+
+    emit_str(&writer, "/* Positions, dependencies first */\n"
+                      "static const uint8_t domain_layout_startup_order[");
+    emit_str(&writer, count ? "DOMAIN_LAYOUT_COUNT" : "1");
+    emit_str(&writer, "] = { ");
+    for (uint32_t k = 0; k < count; k++) {
+        emit_str(&writer, k ? ", " : "");
+        emit_uint(&writer, graph->startup_order[k]);
+    }
+    emit_str(&writer, count ? " };\n\n" : "0 };\n\n");
+    emit_str(&writer, "/* Structural invariants */\n");
+
+    for (uint32_t i = 0; i < count; i++) {
+        emit_layout_asserts(&writer, graph, i, words);
+    }
+
+    emit_str(&writer, "\n#endif /* UCQCF_DOMAIN_LAYOUT_TABLE_H */\n");
+
+    if (writer.length < capacity) {
+        out[writer.length] = '\0';
+    }
+    return writer.length;
+}
+
+/* ========================================================================
+ * ERROR REPORTING
+ * ======================================================================== */
+
+const char* config_error_string(config_error_t error) {
+    switch (error) {
+        case CONFIG_ERROR_NONE:
+            return "No error";
+        case CONFIG_ERROR_SYNTAX:
+            return "Syntax error";
+        case CONFIG_ERROR_UNKNOWN_KEY:
+            return "Unknown domain field";
+        case CONFIG_ERROR_DUPLICATE_KEY:
+            return "Domain field set twice";
+        case CONFIG_ERROR_INVALID_VALUE:
+            return "Invalid value";
+        case CONFIG_ERROR_TOO_MANY_DOMAINS:
+            return "Too many domains";
+        case CONFIG_ERROR_TOO_MANY_DEPENDENCIES:
+            return "Too many dependencies";
+        case CONFIG_ERROR_GRAPH_SEALED:
+            return "Domain graph already sealed";
+        default:
+            return "Unknown error";
+    }
+}
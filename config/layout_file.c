@@ -0,0 +1,61 @@
+/**
+ * config/layout_file.c
+ *
+ * Layout file loading for boot
+ *
+ * APPROACH:
+ *   One fread of up to capacity bytes into the caller's buffer. A file
+ *   that exactly fills the buffer does not set EOF, so a short probe
+ *   read for one more byte tells "fits exactly" from "too large".
+ *
+ * GUARANTEES:
+ *   - No dynamic allocation
+ *   - A file of exactly capacity bytes loads
+ */
+
+#include "config_contract.h"
+#include <stdio.h>
+
+config_file_error_t config_read_file(
+    const char *path,
+    void *buffer,
+    size_t capacity,
+    size_t *size
+) {
+    *size = 0;
+
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return CONFIG_FILE_ERROR_OPEN;
+    }
+
+    size_t length = fread(buffer, 1, capacity, file);
+    bool too_large = length == capacity && fgetc(file) != EOF;
+    bool failed = ferror(file) != 0;
+    fclose(file);
+
+    if (failed) {
+        return CONFIG_FILE_ERROR_READ;
+    }
+    if (too_large) {
+        return CONFIG_FILE_ERROR_TOO_LARGE;
+    }
+
+    *size = length;
+    return CONFIG_FILE_OK;
+}
+
+const char* config_file_error_string(config_file_error_t error) {
+    switch (error) {
+        case CONFIG_FILE_OK:
+            return "No error";
+        case CONFIG_FILE_ERROR_OPEN:
+            return "Cannot open domain configuration";
+        case CONFIG_FILE_ERROR_READ:
+            return "Cannot read domain configuration";
+        case CONFIG_FILE_ERROR_TOO_LARGE:
+            return "Domain configuration larger than its load buffer";
+        default:
+            return "Unknown error";
+    }
+}
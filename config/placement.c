@@ -0,0 +1,584 @@
+/**
+ * config/placement.c
+ *
+ * Offline core placement solver
+ *
+ * PURPOSE:
+ *   Turn "core_count: N" requests into explicit core lists on a sealed
+ *   topology, so layouts are derived from the machine instead of being
+ *   guessed per SKU and then checked.
+ *
+ * APPROACH:
+ *   - Domains with explicit cores are fixed and claimed first
+ *   - Requests are placed most constrained first (isolation level,
+ *     numa_local, SMT exclusivity, core count)
+ *   - For each free seed core, grow greedily along the seed's proximity
+ *     row (topology_nearest_cores), which already starts at the
+ *     required isolation level and is ordered nearest first; keep a
+ *     candidate only if it is isolated from every member chosen so far
+ *   - Score each complete candidate set, keep the cheapest seed
+ *   - Optionally refine: move or swap cores between solver-placed
+ *     domains while that shortens dependency edges (refinement below)
+ *
+ * COST (lower is better, compared per domain):
+ *   Sum over members of the seed's isolation level to that member and
+ *   the NUMA distance to it, plus a penalty per core that is not
+ *   kernel-isolated. Sharing the lowest cache the request allows is
+ *   the locality being maximised.
+ *
+ * GUARANTEES:
+ *   - Deterministic (fixed order, lowest core ID wins ties)
+ *   - No dynamic allocation
+ *   - Never edits fixed domains
+ */
+
+#include "config_contract.h"
+#include <string.h>
+
+/* Cost weights: isolation level dominates distance, housekeeping
+ * (non-isolated) cores are used only when nothing else fits */
+#define COST_LEVEL_WEIGHT        1024u
+#define COST_HOUSEKEEPING_CORE   (1u << 20)
+
+/* ========================================================================
+ * CORE ELIGIBILITY
+ * ======================================================================== */
+
+typedef struct {
+    const topology_state_t *topology;
+    core_mask_t             taken;   /* Owned, or withheld as SMT sibling */
+} placement_state_t;
+
+/* Claim a core; EXCLUSIVE also withholds its SMT siblings */
+static void claim_core(placement_state_t *state, core_id_t core, smt_policy_t smt) {
+    core_mask_set(&state->taken, core);
+
+    if (smt != SMT_POLICY_EXCLUSIVE) {
+        return;
+    }
+
+    topology_cpu_range_t siblings =
+        topology_cpu_siblings(state->topology, core, TOPOLOGY_LEVEL_CORE);
+    for (uint32_t i = 0; i < siblings.count; i++) {
+        core_mask_set(&state->taken, siblings.cpus[i]);
+    }
+}
+
+/* An EXCLUSIVE domain may not sit next to another domain's thread */
+static bool siblings_free(
+    const placement_state_t *state,
+    core_id_t core,
+    const core_id_t *members,
+    uint32_t member_count
+) {
+    topology_cpu_range_t siblings =
+        topology_cpu_siblings(state->topology, core, TOPOLOGY_LEVEL_CORE);
+
+    for (uint32_t i = 0; i < siblings.count; i++) {
+        core_id_t sibling = siblings.cpus[i];
+        if (sibling == core || !core_mask_test(&state->taken, sibling)) {
+            continue;
+        }
+
+        bool own = false;
+        for (uint32_t m = 0; m < member_count && !own; m++) {
+            own = members[m] == sibling;
+        }
+        if (!own) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Per-core part of the request (everything except pairwise isolation) */
+static bool core_eligible(
+    const placement_state_t *state,
+    const security_domain_t *domain,
+    core_id_t core,
+    numa_node_t node
+) {
+    const topology_state_t *topology = state->topology;
+
+    if (core >= topology->core_count || !topology->cores[core].online ||
+        core_mask_test(&state->taken, core)) {
+        return false;
+    }
+
+    if (domain->numa_local && topology_get_numa_node(topology, core) != node) {
+        return false;
+    }
+
+    if (domain->memory_tier != MEMORY_TIER_LOCAL) {
+        numa_memory_tier_t tier = (domain->memory_tier == MEMORY_TIER_HBM)
+            ? NUMA_TIER_HBM : NUMA_TIER_FAR;
+        if (topology_nearest_memory_node(topology, core, tier) == NUMA_NODE_INVALID) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* ========================================================================
+ * GREEDY GROWTH FROM ONE SEED
+ * ======================================================================== */
+
+/*
+ * Fill members[0..count) starting at seed.
+ * RETURNS: cost, or UINT64_MAX if the request cannot be met from seed
+ */
+static uint64_t grow_from_seed(
+    const placement_state_t *state,
+    const security_domain_t *domain,
+    core_id_t seed,
+    core_id_t *members
+) {
+    const topology_state_t *topology = state->topology;
+    cache_isolation_level_t level = domain_required_isolation(domain->cache_isolation);
+    numa_node_t node = topology_get_numa_node(topology, seed);
+    bool exclusive = domain->smt == SMT_POLICY_EXCLUSIVE;
+
+    if (!core_eligible(state, domain, seed, node) ||
+        (exclusive && !siblings_free(state, seed, NULL, 0))) {
+        return UINT64_MAX;
+    }
+
+    members[0] = seed;
+    uint32_t count = 1;
+    uint64_t cost = topology->cores[seed].isolated ? 0 : COST_HOUSEKEEPING_CORE;
+
+    core_id_t candidates[MAX_CORES];
+    uint32_t candidate_count = (domain->core_count > 1)
+        ? topology_nearest_cores(topology, seed, level, &state->taken,
+                                 candidates, MAX_CORES)
+        : 0;
+
+    for (uint32_t i = 0; i < candidate_count && count < domain->core_count; i++) {
+        core_id_t core = candidates[i];
+
+        if (!core_eligible(state, domain, core, node) ||
+            (exclusive && !siblings_free(state, core, members, count))) {
+            continue;
+        }
+
+        /* Row order only guarantees isolation from the seed */
+        bool isolated = true;
+        for (uint32_t m = 1; m < count && isolated; m++) {
+            isolated = topology_get_cache_isolation(topology, members[m], core) >= level;
+        }
+        if (!isolated) {
+            continue;
+        }
+
+        members[count++] = core;
+        cost += (uint64_t)topology_get_cache_isolation(topology, seed, core) *
+                    COST_LEVEL_WEIGHT +
+                topology_get_numa_distance(topology, seed, core) +
+                (topology->cores[core].isolated ? 0 : COST_HOUSEKEEPING_CORE);
+    }
+
+    return (count == domain->core_count) ? cost : UINT64_MAX;
+}
+
+/* ========================================================================
+ * PLACEMENT ORDER
+ * ======================================================================== */
+
+/* Higher = harder to place, so placed earlier */
+static uint64_t constraint_rank(const security_domain_t *domain) {
+    return ((uint64_t)domain_required_isolation(domain->cache_isolation) << 48) |
+           ((uint64_t)domain->numa_local << 40) |
+           ((uint64_t)(domain->memory_tier != MEMORY_TIER_LOCAL) << 39) |
+           ((uint64_t)(domain->smt == SMT_POLICY_EXCLUSIVE) << 32) |
+           domain->core_count;
+}
+
+static bool placement_fail(
+    placement_status_t *status,
+    placement_error_t error,
+    const security_domain_t *domain
+) {
+    status->error = error;
+    status->domain = domain ? domain->id : DOMAIN_ID_INVALID;
+    return false;
+}
+
+/* ========================================================================
+ * SOLVER
+ * ======================================================================== */
+
+bool config_place_domains(
+    domain_graph_t *graph,
+    const topology_state_t *topology,
+    placement_status_t *status
+) {
+    memset(status, 0, sizeof(*status));
+    status->domain = DOMAIN_ID_INVALID;
+
+    if (!topology || !topology->sealed || !topology->proximity.computed) {
+        return placement_fail(status, PLACEMENT_ERROR_TOPOLOGY_NOT_SEALED, NULL);
+    }
+
+    if (graph->sealed) {
+        return placement_fail(status, PLACEMENT_ERROR_GRAPH_SEALED, NULL);
+    }
+
+    placement_state_t state = { .topology = topology };
+    uint32_t order[MAX_DOMAINS];
+    uint32_t pending = 0;
+
+    /* Check requests, claim fixed cores */
+    for (uint32_t i = 0; i < graph->domain_count; i++) {
+        const security_domain_t *domain = &graph->domains[i];
+
+        if (domain->core_count == 0) {
+            if (!domain->cores.explicit) {
+                return placement_fail(status, PLACEMENT_ERROR_REQUEST_INCOMPLETE, domain);
+            }
+
+            core_id_t core;
+            CORE_SET_FOR_EACH(core, &domain->cores) {
+                if (core < MAX_CORES) {
+                    claim_core(&state, core, domain->smt);
+                }
+            }
+            continue;
+        }
+
+        if (domain->cores.explicit) {
+            return placement_fail(status, PLACEMENT_ERROR_REQUEST_CONFLICT, domain);
+        }
+
+        if (domain->cache_isolation == CACHE_ISOLATION_UNDEFINED ||
+            domain->smt == SMT_POLICY_UNDEFINED) {
+            return placement_fail(status, PLACEMENT_ERROR_REQUEST_INCOMPLETE, domain);
+        }
+
+        /* Insertion sort, stable: equal ranks keep file order */
+        uint32_t pos = pending++;
+        while (pos > 0 &&
+               constraint_rank(&graph->domains[order[pos - 1]]) < constraint_rank(domain)) {
+            order[pos] = order[pos - 1];
+            pos--;
+        }
+        order[pos] = i;
+    }
+
+    core_id_t best[MAX_CORES];
+    core_id_t trial[MAX_CORES];
+
+    for (uint32_t p = 0; p < pending; p++) {
+        security_domain_t *domain = &graph->domains[order[p]];
+        uint64_t best_cost = UINT64_MAX;
+
+        if (domain->core_count > topology->core_count) {
+            return placement_fail(status, PLACEMENT_ERROR_UNSATISFIABLE, domain);
+        }
+
+        for (core_id_t seed = 0; seed < topology->core_count; seed++) {
+            uint64_t cost = grow_from_seed(&state, domain, seed, trial);
+            if (cost < best_cost) {
+                best_cost = cost;
+                memcpy(best, trial, domain->core_count * sizeof(best[0]));
+            }
+        }
+
+        if (best_cost == UINT64_MAX) {
+            return placement_fail(status, PLACEMENT_ERROR_UNSATISFIABLE, domain);
+        }
+
+        core_set_clear(&domain->cores);
+        for (uint32_t m = 0; m < domain->core_count; m++) {
+            core_set_add(&domain->cores, best[m]);
+            claim_core(&state, best[m], domain->smt);
+        }
+        domain->cores.explicit = true;
+        domain->core_count = 0;
+
+        status->placed++;
+        status->placed_mask |= 1ULL << order[p];
+        status->cost += best_cost;
+    }
+
+    graph->validated = false;
+    return true;
+}
+
+/* ========================================================================
+ * DEPENDENCY-AWARE REFINEMENT
+ *
+ * Scores every dependency edge by the mean pair cost between the two
+ * domains' cores and descends by single moves. Each candidate move is
+ * applied in place, checked, scored on the edges it touches, and undone.
+ * ======================================================================== */
+
+#define OWNER_NONE          0xFFu
+#define REFINE_MAX_ROUNDS   4096u
+
+typedef struct {
+    uint8_t from;       /* Graph position of the dependent domain */
+    uint8_t to;         /* Graph position of the dependency */
+} placement_edge_t;
+
+typedef struct {
+    domain_graph_t         *graph;
+    const topology_state_t *topology;
+    uint8_t                 owner[MAX_CORES];   /* Graph position or OWNER_NONE */
+    placement_edge_t        edges[MAX_DOMAINS * MAX_DEPENDENCIES];
+    uint32_t                edge_count;
+} refine_state_t;
+
+static uint64_t pair_cost(const topology_state_t *topology, core_id_t a, core_id_t b) {
+    if (topology->core_latency.measured) {
+        return topology->core_latency.latency_ns[a][b];
+    }
+    return topology_get_numa_distance(topology, a, b);
+}
+
+/* Mean pair cost between two domains, in thousandths */
+static uint64_t edge_cost(const refine_state_t *state, const placement_edge_t *edge) {
+    const core_set_t *a = &state->graph->domains[edge->from].cores;
+    const core_set_t *b = &state->graph->domains[edge->to].cores;
+
+    if (a->count == 0 || b->count == 0) {
+        return 0;
+    }
+
+    uint64_t sum = 0;
+    core_id_t x, y;
+    CORE_SET_FOR_EACH(x, a) {
+        CORE_SET_FOR_EACH(y, b) {
+            sum += pair_cost(state->topology, x, y);
+        }
+    }
+    return sum * 1000 / ((uint64_t)a->count * b->count);
+}
+
+/* Edges with an endpoint in {a, b} (b may be OWNER_NONE) */
+static uint64_t local_cost(const refine_state_t *state, uint32_t a, uint32_t b) {
+    uint64_t cost = 0;
+
+    for (uint32_t e = 0; e < state->edge_count; e++) {
+        const placement_edge_t *edge = &state->edges[e];
+        if (edge->from == a || edge->to == a || edge->from == b || edge->to == b) {
+            cost += edge_cost(state, edge);
+        }
+    }
+    return cost;
+}
+
+static uint64_t total_cost(const refine_state_t *state) {
+    uint64_t cost = 0;
+
+    for (uint32_t e = 0; e < state->edge_count; e++) {
+        cost += edge_cost(state, &state->edges[e]);
+    }
+    return cost;
+}
+
+/* Same requests the solver enforces, on the domain's current cores */
+static bool domain_satisfied(const refine_state_t *state, uint32_t position) {
+    const topology_state_t *topology = state->topology;
+    const security_domain_t *domain = &state->graph->domains[position];
+
+    core_mask_t mask;
+    core_set_to_mask(&domain->cores, &mask);
+
+    if (domain->cache_isolation >= CACHE_ISOLATION_L1 &&
+        !topology_core_mask_isolated(topology, &mask,
+            domain_required_isolation(domain->cache_isolation))) {
+        return false;
+    }
+
+    if (domain->numa_local &&
+        topology_core_mask_numa_node(topology, &mask) == NUMA_NODE_INVALID) {
+        return false;
+    }
+
+    core_id_t core;
+    CORE_SET_FOR_EACH(core, &domain->cores) {
+        if (domain->memory_tier != MEMORY_TIER_LOCAL) {
+            numa_memory_tier_t tier = (domain->memory_tier == MEMORY_TIER_HBM)
+                ? NUMA_TIER_HBM : NUMA_TIER_FAR;
+            if (topology_nearest_memory_node(topology, core, tier) == NUMA_NODE_INVALID) {
+                return false;
+            }
+        }
+
+        /* No SMT sharing with another domain if either side is EXCLUSIVE */
+        topology_cpu_range_t siblings =
+            topology_cpu_siblings(topology, core, TOPOLOGY_LEVEL_CORE);
+        for (uint32_t i = 0; i < siblings.count; i++) {
+            uint32_t other = state->owner[siblings.cpus[i]];
+            if (other != OWNER_NONE && other != position &&
+                (domain->smt == SMT_POLICY_EXCLUSIVE ||
+                 state->graph->domains[other].smt == SMT_POLICY_EXCLUSIVE)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/* Domain at position a takes core to (owned by b or free) for core from */
+static void exchange_cores(refine_state_t *state, uint32_t a, core_id_t from, core_id_t to) {
+    uint32_t b = state->owner[to];
+
+    core_set_remove(&state->graph->domains[a].cores, from);
+    core_set_add(&state->graph->domains[a].cores, to);
+    state->owner[to] = (uint8_t)a;
+    state->owner[from] = (uint8_t)b;
+
+    if (b != OWNER_NONE) {
+        core_set_remove(&state->graph->domains[b].cores, to);
+        core_set_add(&state->graph->domains[b].cores, from);
+    }
+}
+
+bool config_refine_placement(
+    domain_graph_t *graph,
+    const topology_state_t *topology,
+    uint64_t movable,
+    placement_refinement_t *report
+) {
+    memset(report, 0, sizeof(*report));
+
+    if (!topology || !topology->sealed || graph->sealed) {
+        return false;
+    }
+
+    refine_state_t state = { .graph = graph, .topology = topology };
+    memset(state.owner, OWNER_NONE, sizeof(state.owner));
+
+    for (uint32_t i = 0; i < graph->domain_count; i++) {
+        const security_domain_t *domain = &graph->domains[i];
+
+        core_id_t core;
+        CORE_SET_FOR_EACH(core, &domain->cores) {
+            if (core >= MAX_CORES || state.owner[core] != OWNER_NONE) {
+                return false;   /* Overlap: left for validation to report */
+            }
+            state.owner[core] = (uint8_t)i;
+        }
+
+        for (uint32_t d = 0; d < domain->dependencies.count; d++) {
+            uint32_t target = domain_graph_index_of(graph,
+                                                    domain->dependencies.depends_on[d]);
+            if (target != DOMAIN_INDEX_NONE && target != i) {
+                state.edges[state.edge_count++] =
+                    (placement_edge_t){ (uint8_t)i, (uint8_t)target };
+            }
+        }
+    }
+
+    report->latency_measured = topology->core_latency.measured;
+    report->edge_count = state.edge_count;
+    report->cost_before = total_cost(&state);
+
+    core_id_t members[MAX_CORES];
+
+    for (uint32_t round = 0; round < REFINE_MAX_ROUNDS; round++) {
+        uint64_t best_gain = 0;
+        uint32_t best_domain = OWNER_NONE;
+        core_id_t best_from = CORE_ID_INVALID;
+        core_id_t best_to = CORE_ID_INVALID;
+
+        for (uint32_t a = 0; a < graph->domain_count; a++) {
+            if (!(movable & (1ULL << a))) {
+                continue;
+            }
+
+            /* Snapshot: the set is edited while candidates are tried */
+            uint32_t member_count = 0;
+            core_id_t core;
+            CORE_SET_FOR_EACH(core, &graph->domains[a].cores) {
+                members[member_count++] = core;
+            }
+
+            for (uint32_t m = 0; m < member_count; m++) {
+                core_id_t from = members[m];
+
+                for (core_id_t to = 0; to < topology->core_count; to++) {
+                    uint32_t b = state.owner[to];
+
+                    if (b == a || !topology->cores[to].online ||
+                        (b != OWNER_NONE && !(movable & (1ULL << b)))) {
+                        continue;
+                    }
+
+                    /* Neither side may gain a housekeeping core: the
+                     * solver only uses those when nothing else fits */
+                    bool from_isolated = topology->cores[from].isolated;
+                    bool to_isolated = topology->cores[to].isolated;
+                    if ((from_isolated && !to_isolated) ||
+                        (b != OWNER_NONE && !from_isolated && to_isolated)) {
+                        continue;
+                    }
+
+                    uint64_t before = local_cost(&state, a, b);
+                    exchange_cores(&state, a, from, to);
+
+                    bool ok = domain_satisfied(&state, a) &&
+                              (b == OWNER_NONE || domain_satisfied(&state, b));
+                    uint64_t after = ok ? local_cost(&state, a, b) : before;
+
+                    exchange_cores(&state, a, to, from);
+
+                    if (after < before && before - after > best_gain) {
+                        best_gain = before - after;
+                        best_domain = a;
+                        best_from = from;
+                        best_to = to;
+                    }
+                }
+            }
+        }
+
+        if (best_gain == 0) {
+            break;
+        }
+
+        uint32_t other = state.owner[best_to];
+        exchange_cores(&state, best_domain, best_from, best_to);
+
+        if (report->swap_count < PLACEMENT_MAX_SWAPS) {
+            report->swaps[report->swap_count] = (placement_swap_t){
+                .domain = graph->domains[best_domain].id,
+                .from = best_from,
+                .to = best_to,
+                .other = (other == OWNER_NONE) ? DOMAIN_ID_INVALID
+                                               : graph->domains[other].id,
+            };
+        }
+        report->swap_count++;
+    }
+
+    report->cost_after = total_cost(&state);
+    graph->validated = false;
+    return true;
+}
+
+/* ========================================================================
+ * ERROR REPORTING
+ * ======================================================================== */
+
+const char* placement_error_string(placement_error_t error) {
+    switch (error) {
+        case PLACEMENT_ERROR_NONE:
+            return "No error";
+        case PLACEMENT_ERROR_TOPOLOGY_NOT_SEALED:
+            return "Topology not sealed";
+        case PLACEMENT_ERROR_GRAPH_SEALED:
+            return "Domain graph already sealed";
+        case PLACEMENT_ERROR_REQUEST_CONFLICT:
+            return "Domain gives both cores and core_count";
+        case PLACEMENT_ERROR_REQUEST_INCOMPLETE:
+            return "Domain placement request incomplete";
+        case PLACEMENT_ERROR_UNSATISFIABLE:
+            return "No free cores satisfy the domain request";
+        default:
+            return "Unknown error";
+    }
+}
@@ -0,0 +1,321 @@
+/**
+ * domains/core_set.c
+ *
+ * Core set library
+ *
+ * PURPOSE:
+ *   Membership, algebra and iteration over core_set_t without visiting
+ *   every possible core ID. Loops are bounded by set->words and by the
+ *   number of members, never by MAX_DOMAIN_CORES.
+ *
+ * APPROACH:
+ *   - Bulk operations combine whole words, then recompute words/count
+ *     with popcount (count is a cache, never maintained by hand there)
+ *   - n-th member skips whole words by popcount, then selects within
+ *     one word (PDEP on x86_64 via the arch hook)
+ *
+ * GUARANTEES:
+ *   - INVARIANT bitmap[words..CORE_SET_WORDS) == 0 holds after every call
+ *   - Deterministic, no allocation
+ */
+
+#include "domain_contract.h"
+#include <string.h>
+
+/* ========================================================================
+ * INTERNAL HELPERS
+ * ======================================================================== */
+
+/* Recompute words and count after bits changed in bitmap[0..limit) */
+static void core_set_normalize(core_set_t *set, uint32_t limit, uint32_t count) {
+    uint32_t words = limit;
+    while (words > 0 && set->bitmap[words - 1] == 0) {
+        words--;
+    }
+
+    /* Only out's old words can hold bits past the combined range */
+    for (uint32_t w = limit; w < set->words; w++) {
+        set->bitmap[w] = 0;
+    }
+
+    set->words = words;
+    set->count = count;
+}
+
+static uint32_t max_u32(uint32_t a, uint32_t b) {
+    return a > b ? a : b;
+}
+
+static uint32_t min_u32(uint32_t a, uint32_t b) {
+    return a < b ? a : b;
+}
+
+/* ========================================================================
+ * MEMBERSHIP
+ * ======================================================================== */
+
+bool core_set_is_empty(const core_set_t *set) {
+    for (uint32_t i = 0; i < set->words; i++) {
+        if (set->bitmap[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool core_set_contains(const core_set_t *set, core_id_t core) {
+    if (core >= core_set_end(set)) {
+        return false;
+    }
+
+    uint32_t word = core / 64;
+    uint32_t bit = core % 64;
+
+    return (set->bitmap[word] & (1ULL << bit)) != 0;
+}
+
+bool core_set_overlaps(const core_set_t *a, const core_set_t *b) {
+    uint32_t words = min_u32(a->words, b->words);
+
+    for (uint32_t i = 0; i < words; i++) {
+        if ((a->bitmap[i] & b->bitmap[i]) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool core_set_is_subset(const core_set_t *subset, const core_set_t *superset) {
+    if (subset->words > superset->words) {
+        return false;   /* subset's top word is non-empty */
+    }
+
+    for (uint32_t i = 0; i < subset->words; i++) {
+        if ((subset->bitmap[i] & ~superset->bitmap[i]) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool core_set_is_valid(const core_set_t *set, const boot_facts_t *boot) {
+    /* Highest member must exist in hardware */
+    for (uint32_t i = set->words; i-- > 0;) {
+        if (set->bitmap[i] != 0) {
+            core_id_t highest = i * 64 + 63 - (core_id_t)__builtin_clzll(set->bitmap[i]);
+            return highest < boot->cpu_count;
+        }
+    }
+    return true;
+}
+
+/* ========================================================================
+ * MUTATION
+ * ======================================================================== */
+
+void core_set_add(core_set_t *set, core_id_t core) {
+    if (core >= MAX_DOMAIN_CORES) {
+        return;
+    }
+
+    uint32_t word = core / 64;
+    uint64_t bit = 1ULL << (core % 64);
+
+    if (!(set->bitmap[word] & bit)) {
+        set->bitmap[word] |= bit;
+        set->count++;
+    }
+
+    if (word >= set->words) {
+        set->words = word + 1;
+    }
+    set->explicit = true;
+}
+
+void core_set_remove(core_set_t *set, core_id_t core) {
+    if (!core_set_contains(set, core)) {
+        return;
+    }
+
+    set->bitmap[core / 64] &= ~(1ULL << (core % 64));
+    set->count--;
+
+    while (set->words > 0 && set->bitmap[set->words - 1] == 0) {
+        set->words--;
+    }
+}
+
+void core_set_clear(core_set_t *set) {
+    memset(set->bitmap, 0, sizeof(set->bitmap));
+    set->words = 0;
+    set->count = 0;
+    set->explicit = false;
+}
+
+void core_set_from_range(core_set_t *set, core_id_t first, uint32_t count) {
+    core_set_clear(set);
+    set->explicit = true;
+
+    if (first >= MAX_DOMAIN_CORES || count == 0) {
+        return;
+    }
+
+    core_id_t end = (count > MAX_DOMAIN_CORES - first) ? MAX_DOMAIN_CORES
+                                                        : first + count;
+
+    /* Whole words at once: mask the partial first and last words */
+    for (uint32_t w = first / 64; w * 64 < end; w++) {
+        uint64_t bits = ~0ULL;
+
+        if (w == first / 64) {
+            bits &= ~0ULL << (first % 64);
+        }
+        if (end < (w + 1) * 64) {
+            bits &= ~0ULL >> (64 - end % 64);
+        }
+
+        set->bitmap[w] = bits;
+        set->words = w + 1;
+    }
+
+    set->count = end - first;
+}
+
+/* ========================================================================
+ * SET ALGEBRA
+ * ======================================================================== */
+
+void core_set_union(core_set_t *out, const core_set_t *a, const core_set_t *b) {
+    uint32_t words = max_u32(a->words, b->words);
+    bool explicit = a->explicit;
+
+    uint32_t count = core_set_combine_words(out->bitmap, a->bitmap, b->bitmap,
+                                            words, CORE_SET_OP_UNION);
+    core_set_normalize(out, words, count);
+    out->explicit = explicit;
+}
+
+void core_set_intersect(core_set_t *out, const core_set_t *a, const core_set_t *b) {
+    uint32_t words = min_u32(a->words, b->words);
+    bool explicit = a->explicit;
+
+    uint32_t count = core_set_combine_words(out->bitmap, a->bitmap, b->bitmap,
+                                            words, CORE_SET_OP_INTERSECT);
+    core_set_normalize(out, words, count);
+    out->explicit = explicit;
+}
+
+void core_set_difference(core_set_t *out, const core_set_t *a, const core_set_t *b) {
+    uint32_t words = a->words;
+    bool explicit = a->explicit;
+
+    uint32_t count = core_set_combine_words(out->bitmap, a->bitmap, b->bitmap,
+                                            words, CORE_SET_OP_DIFFERENCE);
+    core_set_normalize(out, words, count);
+    out->explicit = explicit;
+}
+
+/* ========================================================================
+ * MEMBER LOOKUP
+ * ======================================================================== */
+
+/* Lowest member >= start */
+static core_id_t core_set_scan(const core_set_t *set, core_id_t start) {
+    uint32_t w = start / 64;
+    if (w >= set->words) {
+        return CORE_ID_INVALID;
+    }
+
+    uint64_t bits = set->bitmap[w] & (~0ULL << (start % 64));
+
+    while (bits == 0) {
+        if (++w >= set->words) {
+            return CORE_ID_INVALID;
+        }
+        bits = set->bitmap[w];
+    }
+
+    return w * 64 + (core_id_t)__builtin_ctzll(bits);
+}
+
+core_id_t core_set_first(const core_set_t *set) {
+    return core_set_scan(set, 0);
+}
+
+core_id_t core_set_next(const core_set_t *set, core_id_t core) {
+    if (core >= MAX_DOMAIN_CORES - 1) {
+        return CORE_ID_INVALID;
+    }
+    return core_set_scan(set, core + 1);
+}
+
+core_id_t core_set_nth(const core_set_t *set, uint32_t n) {
+    for (uint32_t w = 0; w < set->words; w++) {
+        uint32_t members = (uint32_t)__builtin_popcountll(set->bitmap[w]);
+
+        if (n < members) {
+            return w * 64 + core_set_select_bit(set->bitmap[w], n);
+        }
+        n -= members;
+    }
+    return CORE_ID_INVALID;
+}
+
+/* ========================================================================
+ * WORD KERNELS (scalar reference)
+ * ======================================================================== */
+
+uint32_t core_set_combine_words_scalar(
+    uint64_t *out,
+    const uint64_t *a,
+    const uint64_t *b,
+    uint32_t words,
+    core_set_op_t op
+) {
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < words; i++) {
+        uint64_t word;
+
+        switch (op) {
+            case CORE_SET_OP_UNION:     word = a[i] | b[i];  break;
+            case CORE_SET_OP_INTERSECT: word = a[i] & b[i];  break;
+            default:                    word = a[i] & ~b[i]; break;
+        }
+
+        out[i] = word;
+        count += (uint32_t)__builtin_popcountll(word);
+    }
+
+    return count;
+}
+
+uint32_t core_set_select_bit_scalar(uint64_t word, uint32_t n) {
+    /* Clear the n lowest set bits, then take the lowest remaining */
+    for (uint32_t i = 0; i < n; i++) {
+        word &= word - 1;
+    }
+    return (uint32_t)__builtin_ctzll(word);
+}
+
+/* ========================================================================
+ * ARCHITECTURE HOOKS
+ *
+ * Weak defaults. Overridden by arch/ with vectorized / BMI2 versions.
+ * ======================================================================== */
+
+__attribute__((weak))
+uint32_t core_set_combine_words(
+    uint64_t *out,
+    const uint64_t *a,
+    const uint64_t *b,
+    uint32_t words,
+    core_set_op_t op
+) {
+    return core_set_combine_words_scalar(out, a, b, words, op);
+}
+
+__attribute__((weak))
+uint32_t core_set_select_bit(uint64_t word, uint32_t n) {
+    return core_set_select_bit_scalar(word, n);
+}
@@ -39,7 +39,7 @@ typedef uint32_t domain_id_t;
 #define DOMAIN_ID_INVALID  0xFFFFFFFF
 #define DOMAIN_ID_BOOT     0
 #define MAX_DOMAINS        64
-#define MAX_DOMAIN_CORES   256
+#define MAX_DOMAIN_CORES   MAX_CORES   /* UCQCF_MAX_CPUS */
 #define MAX_DEPENDENCIES   32
 
 /**
@@ -88,6 +88,20 @@ typedef enum {
     MEMORY_DOMAIN_SHARED_WRITE       /* Read-write sharing (must be explicit) */
 } memory_domain_type_t;
 
+/**
+ * Memory tier preference
+ * 
+ * Where the domain's memory should come from. LOCAL is CPU-attached
+ * DRAM; HBM and FAR select memory-only NUMA nodes (e.g. HBM, CXL) so
+ * bulk buffers can stay off local DRAM. Any tier other than LOCAL
+ * must be set explicitly and must exist in the topology.
+ */
+typedef enum {
+    MEMORY_TIER_LOCAL = 0,           /* CPU-attached DRAM */
+    MEMORY_TIER_HBM,                 /* High-bandwidth memory node */
+    MEMORY_TIER_FAR                  /* Far / CXL memory node */
+} memory_tier_t;
+
 /**
  * Preemption policy
  * 
@@ -101,30 +115,180 @@ typedef enum {
     PREEMPTION_BY_ANY                /* Any domain can preempt */
 } preemption_policy_t;
 
+/**
+ * SMT sharing policy (placement input)
+ * 
+ * Only consulted by the offline placement solver, which needs to know
+ * whether a domain's SMT siblings may be handed to other domains.
+ * Validation works on the resulting explicit core lists.
+ */
+typedef enum {
+    SMT_POLICY_UNDEFINED = 0,        /* ERROR if the solver must place */
+    SMT_POLICY_SHARED,               /* Siblings may go to other domains */
+    SMT_POLICY_EXCLUSIVE             /* Siblings stay in domain or idle */
+} smt_policy_t;
+
 /* ========================================================================
  * CORE SET (No Overlaps Allowed)
  * ======================================================================== */
 
+#define CORE_SET_WORDS     (MAX_DOMAIN_CORES / 64)
+
 /**
  * Core set representation
  * 
  * INVARIANT: No two domains may have overlapping core sets.
  * INVARIANT: All cores in set must exist in boot_facts.
+ * INVARIANT: bitmap[words..CORE_SET_WORDS) is zero.
+ * 
+ * Set operations only visit the first `words` words, so a wide build
+ * (UCQCF_MAX_CPUS=1024) costs the same as a narrow one for small sets.
  */
 typedef struct {
-    uint64_t bitmap[4];  /* Supports up to 256 cores (4 * 64 bits) */
+    uint64_t bitmap[CORE_SET_WORDS];
+    uint32_t words;      /* Highest non-empty word + 1 */
     uint32_t count;      /* Number of cores in set (cached) */
     bool     explicit;   /* true = explicitly set, false = ERROR */
 } core_set_t;
 
-/* Core set operations (validation helpers) */
+/* Exclusive upper bound on core IDs present in set */
+static inline core_id_t core_set_end(const core_set_t *set) {
+    return set->words * 64;
+}
+
+/* Topology view of a core set (for mask-based topology queries) */
+static inline void core_set_to_mask(const core_set_t *set, core_mask_t *mask) {
+    for (uint32_t w = 0; w < CORE_MASK_WORDS; w++) {
+        mask->bits[w] = (w < set->words) ? set->bitmap[w] : 0;
+    }
+}
+
+/* Core set operations (domains/core_set.c) */
 bool core_set_is_empty(const core_set_t *set);
 bool core_set_contains(const core_set_t *set, core_id_t core);
 bool core_set_overlaps(const core_set_t *a, const core_set_t *b);
+bool core_set_is_subset(const core_set_t *subset, const core_set_t *superset);
 bool core_set_is_valid(const core_set_t *set, const boot_facts_t *boot);
 void core_set_add(core_set_t *set, core_id_t core);
+void core_set_remove(core_set_t *set, core_id_t core);
 void core_set_clear(core_set_t *set);
 
+/**
+ * Set algebra
+ * 
+ * out may alias a or b and must hold a valid set (core_set_clear once
+ * before reuse): only its old words are cleared, not all CORE_SET_WORDS.
+ * out->explicit is taken from a; words and count are recomputed
+ * (popcount) from the result.
+ * 
+ *   union:      out = a | b
+ *   intersect:  out = a & b
+ *   difference: out = a & ~b
+ */
+void core_set_union(core_set_t *out, const core_set_t *a, const core_set_t *b);
+void core_set_intersect(core_set_t *out, const core_set_t *a, const core_set_t *b);
+void core_set_difference(core_set_t *out, const core_set_t *a, const core_set_t *b);
+
+/**
+ * Set to the contiguous range [first, first + count)
+ * 
+ * ENSURES: set is explicit; cores >= MAX_DOMAIN_CORES are dropped
+ */
+void core_set_from_range(core_set_t *set, core_id_t first, uint32_t count);
+
+/**
+ * Member lookup
+ * 
+ * RETURNS: Core ID, or CORE_ID_INVALID when there is no such member
+ * 
+ *   first: lowest member
+ *   next:  lowest member above core
+ *   nth:   n-th lowest member (0-based)
+ */
+core_id_t core_set_first(const core_set_t *set);
+core_id_t core_set_next(const core_set_t *set, core_id_t core);
+core_id_t core_set_nth(const core_set_t *set, uint32_t n);
+
+/**
+ * Member iteration (ascending core ID)
+ * 
+ * Visits only set bits: one count-trailing-zeros and one clear-lowest-
+ * bit per member, plus one load per word up to set->words. The set must
+ * not change during iteration.
+ * 
+ *   core_id_t core;
+ *   CORE_SET_FOR_EACH(core, &domain->cores) { ... }
+ */
+typedef struct {
+    const uint64_t *bitmap;
+    uint32_t        words;
+    uint32_t        word;
+    uint64_t        bits;     /* Members of bitmap[word] not yet visited */
+} core_set_iter_t;
+
+static inline core_set_iter_t core_set_iter(const core_set_t *set) {
+    core_set_iter_t it = { set->bitmap, set->words, 0, 0 };
+    if (set->words > 0) {
+        it.bits = set->bitmap[0];
+    }
+    return it;
+}
+
+static inline bool core_set_iter_next(core_set_iter_t *it, core_id_t *core) {
+    while (it->bits == 0) {
+        if (++it->word >= it->words) {
+            return false;
+        }
+        it->bits = it->bitmap[it->word];
+    }
+    
+    *core = it->word * 64 + (core_id_t)__builtin_ctzll(it->bits);
+    it->bits &= it->bits - 1;
+    return true;
+}
+
+#define CORE_SET_FOR_EACH(core, set) \
+    for (core_set_iter_t core##_iter = core_set_iter(set); \
+         core_set_iter_next(&core##_iter, &(core)); )
+
+/**
+ * Word-level kernels (architecture hooks)
+ * 
+ * core_set_combine_words: out[i] = a[i] OP b[i] for i < words
+ * RETURNS: popcount of out[0..words)
+ * 
+ * core_set_select_bit: position of the n-th lowest set bit of word
+ * REQUIRES: n < popcount(word)
+ * 
+ * Weak defaults in domains/core_set.c are the scalar references.
+ * arch/ overrides them (AVX2 combine, BMI2 PDEP select on x86_64)
+ * and must return identical results.
+ */
+typedef enum {
+    CORE_SET_OP_UNION = 0,
+    CORE_SET_OP_INTERSECT,
+    CORE_SET_OP_DIFFERENCE
+} core_set_op_t;
+
+uint32_t core_set_combine_words(
+    uint64_t *out,
+    const uint64_t *a,
+    const uint64_t *b,
+    uint32_t words,
+    core_set_op_t op
+);
+
+uint32_t core_set_combine_words_scalar(
+    uint64_t *out,
+    const uint64_t *a,
+    const uint64_t *b,
+    uint32_t words,
+    core_set_op_t op
+);
+
+uint32_t core_set_select_bit(uint64_t word, uint32_t n);
+uint32_t core_set_select_bit_scalar(uint64_t word, uint32_t n);
+
 /* ========================================================================
  * DEPENDENCY GRAPH (Must Be Acyclic)
  * ======================================================================== */
@@ -172,10 +336,16 @@ typedef struct {
     core_set_t          cores;
     cache_isolation_t   cache_isolation;
     
+    /* Placement request (config/placement.c turns these into cores) */
+    uint32_t            core_count;  /* 0 = cores listed explicitly */
+    smt_policy_t        smt;
+    
     /* Memory properties (enforced by memory layer) */
     memory_domain_type_t memory_type;
     bool                numa_local;  /* Require NUMA-local memory */
     bool                numa_local_explicit;
+    memory_tier_t       memory_tier;
+    bool                memory_tier_explicit;
     
     /* Dependencies (graph-validated) */
     dependency_set_t    dependencies;
@@ -190,6 +360,64 @@ typedef struct {
  * DOMAIN GRAPH (All Domains + Relationships)
  * ======================================================================== */
 
+/**
+ * Domain ID index
+ * 
+ * Open-addressed hash from domain ID to position in domains[].
+ * Twice as many slots as domains keeps probe chains short; Fibonacci
+ * hashing spreads the dense small IDs configs use over all slots.
+ * 
+ * INVARIANT: domains[0..indexed) are in the table
+ * INVARIANT: positions[s] == 0 marks an empty slot (else position + 1)
+ */
+#define DOMAIN_INDEX_BITS   7
+#define DOMAIN_INDEX_SLOTS  (1u << DOMAIN_INDEX_BITS)
+#define DOMAIN_INDEX_NONE   0xFFFFFFFF
+
+typedef struct {
+    domain_id_t ids[DOMAIN_INDEX_SLOTS];
+    uint8_t     positions[DOMAIN_INDEX_SLOTS];
+    uint32_t    indexed;
+} domain_id_index_t;
+
+_Static_assert(DOMAIN_INDEX_SLOTS >= 2 * MAX_DOMAINS,
+    "domain index load factor must stay <= 1/2");
+_Static_assert(MAX_DOMAINS < 255,
+    "domain index positions must fit uint8_t");
+
+/**
+ * Hot domain record (query path)
+ * 
+ * security_domain_t is the construction record: names, *_explicit
+ * flags, dependency lists and placement requests sit between the few
+ * fields runtime queries read. At seal each domain is packed into one
+ * of these, so scheduler and access checks touch a single cache line
+ * per domain; graph->domains[] stays as the cold side table (names,
+ * flags, diagnostics).
+ * 
+ * INVARIANT: hot[i] describes domains[i]
+ * INVARIANT: cores[core_words..CORE_SET_WORDS) == 0
+ */
+#define DOMAIN_HOT_ALIGN    64   /* Cache line */
+
+typedef struct {
+    domain_id_t id;
+    uint8_t     security_level;    /* security_level_t */
+    uint8_t     preemption;        /* preemption_policy_t */
+    uint8_t     cache_isolation;   /* cache_isolation_t */
+    uint8_t     memory_type;       /* memory_domain_type_t */
+    uint32_t    core_count;
+    uint32_t    core_words;
+    uint64_t    access_direct;     /* Bit j: depends on domains[j] */
+    uint64_t    access_reach;      /* Bit j: reaches domains[j] */
+    uint64_t    cores[CORE_SET_WORDS];
+} __attribute__((aligned(DOMAIN_HOT_ALIGN))) domain_hot_t;
+
+/* Exactly one line at the default MAX_CORES (256); larger builds grow
+ * the core bitmap, and the record, by whole lines */
+_Static_assert(CORE_SET_WORDS > 4 || sizeof(domain_hot_t) == DOMAIN_HOT_ALIGN,
+    "hot domain record must fit one cache line");
+
 /**
  * Domain graph
  * 
@@ -211,8 +439,39 @@ typedef struct {
     const boot_facts_t     *boot_facts;
     const topology_state_t *topology;
     
+    /* ID -> position (maintained by add, rebuilt by validate) */
+    domain_id_index_t       index;
+    
+    /* Access matrices by position, built at seal.
+     * Bit j of direct[i]: domains[i] depends on domains[j].
+     * Bit j of reach[i]:  domains[j] reachable from domains[i] through
+     *                     one or more dependencies (transitive closure). */
+    uint64_t                access_direct[MAX_DOMAINS];
+    uint64_t                access_reach[MAX_DOMAINS];
+    
+    /* Packed query records, built at seal (see domain_hot_t) */
+    domain_hot_t            hot[MAX_DOMAINS];
+    
+    /* Positions in startup order (dependencies first), set by validate.
+     * INVARIANT: if validated, startup_order[0..domain_count) is a
+     *            topological order of the dependency graph */
+    uint8_t                 startup_order[MAX_DOMAINS];
+    
+    /* Incremental revalidation state (built by domain_graph_validate).
+     * INVARIANT: if tracked, bit p of core_owners[c] is set iff
+     *            domains[p] claims core c; claimed / contested are the
+     *            cores with at least one / more than one owner */
+    bool                    tracked;
+    uint64_t                core_owners[MAX_DOMAIN_CORES];
+    core_set_t              claimed;
+    core_set_t              contested;
+    uint64_t                failed_domains;   /* Per-domain HARD_FAIL */
+    bool                    cyclic;
+    
 } domain_graph_t;
 
+_Static_assert(MAX_DOMAINS <= 64, "access matrix rows are one uint64_t");
+
 /* ========================================================================
  * VALIDATION OUTCOMES (No Ambiguity)
  * ======================================================================== */
@@ -252,6 +511,7 @@ typedef enum {
     VALIDATION_ERROR_CORES_OVERLAP,
     VALIDATION_ERROR_CACHE_ISOLATION_UNSATISFIABLE,
     VALIDATION_ERROR_NUMA_CONSTRAINT_VIOLATED,
+    VALIDATION_ERROR_MEMORY_TIER_UNAVAILABLE,
     
     /* Dependency errors (HARD_FAIL) */
     VALIDATION_ERROR_DEPENDENCY_NOT_EXIST,
@@ -263,6 +523,8 @@ typedef enum {
     VALIDATION_ERROR_TOO_MANY_DOMAINS,
     VALIDATION_ERROR_BOOT_FACTS_NULL,
     VALIDATION_ERROR_TOPOLOGY_NULL,
+    VALIDATION_ERROR_DOMAIN_NOT_FOUND,
+    VALIDATION_ERROR_GRAPH_SEALED,
     
     /* Warnings (WARN) */
     VALIDATION_WARN_UNUSED_CORES,
@@ -270,13 +532,29 @@ typedef enum {
     
 } validation_error_t;
 
+/**
+ * Validation error detail
+ * 
+ * Attribution for one entry in validation_context_t.errors.
+ * Fields that do not apply are DOMAIN_ID_INVALID / CORE_ID_INVALID / 0.
+ */
+typedef struct {
+    domain_id_t         domain;        /* Domain that failed */
+    domain_id_t         other;         /* Conflicting domain (overlaps) */
+    core_id_t           first_core;    /* Lowest offending core */
+    uint32_t            core_count;    /* Offending cores */
+    uint64_t            members;       /* Cycle members, bit = position */
+} validation_detail_t;
+
 /**
  * Validation context
  * 
  * Accumulates all errors during validation.
+ * INVARIANT: details[i] describes errors[i] for i < error_count
  */
 typedef struct {
     validation_error_t  errors[64];
+    validation_detail_t details[64];
     uint32_t            error_count;
     validation_result_t worst_result;  /* Highest severity seen */
 } validation_context_t;
@@ -311,6 +589,7 @@ bool domain_graph_add(domain_graph_t *graph, const security_domain_t *domain);
  * This is the CRITICAL SECURITY FUNCTION.
  * 
  * Checks:
+ *   0. Domain IDs are unique
  *   1. All fields are explicitly set (no defaults)
  *   2. No overlapping core sets
  *   3. All cores exist in boot_facts
@@ -327,11 +606,100 @@ validation_result_t domain_graph_validate(
     validation_context_t *ctx
 );
 
+/**
+ * Validate entire domain graph on a worker pool
+ * 
+ * Same checks as domain_graph_validate. The per-domain stage (fields,
+ * boot, topology, dependencies) is split into contiguous blocks, one
+ * per worker thread, each into a private context; contexts are merged
+ * in block order. Graph-level checks stay serial.
+ * 
+ * ENSURES: ctx, return value and graph state are identical to
+ *          domain_graph_validate for any worker count
+ * 
+ * workers: threads including the caller, clamped to
+ *          [1, DOMAIN_VALIDATE_MAX_WORKERS] and to the domain count
+ */
+#define DOMAIN_VALIDATE_MAX_WORKERS  16
+
+validation_result_t domain_graph_validate_parallel(
+    domain_graph_t *graph,
+    validation_context_t *ctx,
+    uint32_t workers
+);
+
+/**
+ * Validate only hardware-independent graph properties
+ * 
+ * Fields set, dependencies present and not self, IDs unique, cores
+ * disjoint, dependency graph acyclic. Needs no boot facts or topology,
+ * so it can run at build time, before config_compile_domains().
+ * 
+ * ENSURES: if not HARD_FAIL, graph->startup_order is a topological
+ *          order of domains[0..domain_count)
+ * ENSURES: graph->validated is NOT set (hardware checks still pending)
+ */
+validation_result_t domain_graph_validate_structure(
+    domain_graph_t *graph,
+    validation_context_t *ctx
+);
+
+/**
+ * Load and validate a build-time compiled layout
+ * 
+ * Boot path for tables generated by config_compile_domains(), whose
+ * _Static_asserts already proved everything
+ * domain_graph_validate_structure checks. Only hardware-dependent
+ * checks run here: cores exist (boot facts), cache isolation, NUMA
+ * locality and memory tier (sealed topology).
+ * 
+ * REQUIRES: graph initialized and empty; domains[0..count) and
+ *           startup_order[0..count) from one generated header
+ * ENSURES:  graph holds the table with index, claims and access rows
+ *           built; graph->validated unless HARD_FAIL
+ * 
+ * RETURNS: worst result of the hardware-dependent checks
+ */
+validation_result_t domain_graph_validate_compiled(
+    domain_graph_t *graph,
+    const security_domain_t *domains,
+    uint32_t count,
+    const uint8_t *startup_order,
+    validation_context_t *ctx
+);
+
+/**
+ * Revalidate one edited domain
+ * 
+ * For config editors: edit graph->domains[] in place, then recheck
+ * only what the edit can affect. Per-domain checks run for the edited
+ * domain; its old core claims are released from the owner table and
+ * its new cores re-claimed (O(claimed + members)); dependency rows,
+ * closure and startup order are rebuilt (O(D^2) word operations).
+ * 
+ * REQUIRES: the domain keeps the ID it had at the last full validation
+ * ENSURES:  ctx holds only errors involving the edited domain
+ *           (overlaps with it, cycles through it)
+ * ENSURES:  graph->validated reflects the whole graph
+ * 
+ * Falls back to domain_graph_validate when no incremental state
+ * exists yet (graph never validated, or a domain was added since).
+ * 
+ * RETURNS: worst result for the edited domain's constraints
+ */
+validation_result_t domain_graph_revalidate_domain(
+    domain_graph_t *graph,
+    domain_id_t id,
+    validation_context_t *ctx
+);
+
 /**
  * Seal domain graph (make immutable)
  * 
  * REQUIRES: domain_graph_validate returned VALIDATION_ACCEPT
  * ENSURES:  No further modifications possible
+ * ENSURES:  access_direct / access_reach built (Warshall over bit rows)
+ * ENSURES:  hot[0..domain_count) packed from domains[] and the rows
  * 
  * SECURITY: This is a one-way transition. Once sealed, the domain
  *           configuration cannot be changed without reboot.
@@ -343,15 +711,42 @@ bool domain_graph_seal(domain_graph_t *graph);
  * ======================================================================== */
 
 /**
- * Get a domain by ID
+ * Position of a domain in graph->domains[]
+ * 
+ * Constant time through the ID index. Falls back to a scan when
+ * domains[] was filled in place (config parser) and the index has not
+ * been rebuilt by domain_graph_validate yet.
+ * 
+ * RETURNS: position, or DOMAIN_INDEX_NONE if no domain has this ID.
+ *          With duplicate IDs, the first domain added wins.
+ */
+uint32_t domain_graph_index_of(const domain_graph_t *graph, domain_id_t id);
+
+/**
+ * Get a domain by ID (constant time, see domain_graph_index_of)
  */
 const security_domain_t* domain_graph_get(
     const domain_graph_t *graph,
     domain_id_t id
 );
 
+/**
+ * Get a domain's hot record by ID (constant time)
+ * 
+ * REQUIRES: graph sealed (returns NULL otherwise)
+ * RETURNS:  One cache line with everything scheduling and access
+ *           decisions read, or NULL if no domain has this ID
+ */
+const domain_hot_t* domain_graph_hot(
+    const domain_graph_t *graph,
+    domain_id_t id
+);
+
 /**
  * Check if a domain can access another (based on dependencies)
+ * 
+ * Direct dependencies only. Once sealed, a single bit test in the
+ * source domain's hot record.
  */
 bool domain_graph_can_access(
     const domain_graph_t *graph,
@@ -359,8 +754,23 @@ bool domain_graph_can_access(
     domain_id_t to
 );
 
+/**
+ * Check if a domain reaches another through a dependency chain
+ * 
+ * REQUIRES: graph sealed (returns false otherwise)
+ * RETURNS:  true if 'to' is reachable from 'from' via one or more
+ *           dependencies. A domain never reaches itself (graph acyclic).
+ */
+bool domain_graph_can_reach(
+    const domain_graph_t *graph,
+    domain_id_t from,
+    domain_id_t to
+);
+
 /**
  * Check if cores assigned to two domains are isolated
+ * 
+ * Once sealed, reads only the two hot records.
  */
 bool domain_graph_cores_isolated(
     const domain_graph_t *graph,
@@ -385,6 +795,8 @@ validation_result_t domain_validate_fields(
 /**
  * Validate domain against topology
  * 
+ * REQUIRES: topology sealed (isolation is read from its matrix)
+ * 
  * Ensures all cores exist and isolation is achievable.
  */
 validation_result_t domain_validate_topology(
@@ -404,6 +816,12 @@ validation_result_t domain_validate_boot(
     validation_context_t *ctx
 );
 
+/**
+ * Matrix isolation level a cache_isolation requirement needs between
+ * every two cores of a domain (CACHE_ISOLATED_NONE = no constraint)
+ */
+cache_isolation_level_t domain_required_isolation(cache_isolation_t isolation);
+
 /**
  * Validate dependencies
  * 
@@ -420,10 +838,30 @@ validation_result_t domain_validate_dependencies(
  * GRAPH VALIDATORS (Holistic)
  * ======================================================================== */
 
+/**
+ * Validate domain IDs are unique
+ * 
+ * REQUIRES: graph->index covers every domain
+ * ENSURES:  one VALIDATION_ERROR_DUPLICATE_ID per repeated domain,
+ *           detail = { ID, DOMAIN_ID_INVALID, -, 0 }
+ */
+validation_result_t domain_graph_validate_unique_ids(
+    const domain_graph_t *graph,
+    validation_context_t *ctx
+);
+
 /**
  * Validate no overlapping cores
  * 
  * CRITICAL: Two domains sharing cores violates isolation.
+ * 
+ * Single pass: each domain's set is intersected with the running union
+ * of earlier domains, and a per-core owner table attributes any
+ * collision. O(domains x words) plus O(members) for the owner table.
+ * 
+ * ENSURES: one VALIDATION_ERROR_CORES_OVERLAP per colliding domain pair,
+ *          detail = { later domain, earlier domain, first shared core,
+ *          shared core count }
  */
 validation_result_t domain_graph_validate_no_overlap(
     const domain_graph_t *graph,
@@ -434,6 +872,15 @@ validation_result_t domain_graph_validate_no_overlap(
  * Validate dependency graph is acyclic
  * 
  * CRITICAL: Circular dependencies create undefined security states.
+ * 
+ * Iterative Tarjan SCC over dependency bit rows, O(V + E), no recursion.
+ * Components are completed dependencies-first, so the completion order
+ * is the startup order domain_graph_validate stores in the graph.
+ * 
+ * ENSURES: one VALIDATION_ERROR_DEPENDENCY_CIRCULAR per strongly
+ *          connected component with a cycle (size > 1, or a self
+ *          dependency), detail = { member, member it depends on within
+ *          the cycle, -, 0, all member positions }
  */
 validation_result_t domain_graph_validate_acyclic(
     const domain_graph_t *graph,
@@ -14,6 +14,7 @@
  */
 
 #include "domain_contract.h"
+#include <pthread.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -25,14 +26,17 @@ static void validation_context_init(validation_context_t *ctx) {
     ctx->error_count = 0;
     ctx->worst_result = VALIDATION_ACCEPT;
     memset(ctx->errors, 0, sizeof(ctx->errors));
+    memset(ctx->details, 0, sizeof(ctx->details));
 }
 
-static void validation_context_add_error(
+static void validation_context_add_detail(
     validation_context_t *ctx,
     validation_error_t error,
-    validation_result_t severity
+    validation_result_t severity,
+    const validation_detail_t *detail
 ) {
     if (ctx->error_count < 64) {
+        ctx->details[ctx->error_count] = *detail;
         ctx->errors[ctx->error_count++] = error;
     }
     
@@ -41,72 +45,22 @@ static void validation_context_add_error(
     }
 }
 
-bool validation_context_allows_boot(const validation_context_t *ctx) {
-    return ctx->worst_result != VALIDATION_HARD_FAIL;
-}
-
-/* ========================================================================
- * CORE SET OPERATIONS
- * ======================================================================== */
-
-bool core_set_is_empty(const core_set_t *set) {
-    for (int i = 0; i < 4; i++) {
-        if (set->bitmap[i] != 0) {
-            return false;
-        }
-    }
-    return true;
-}
-
-bool core_set_contains(const core_set_t *set, core_id_t core) {
-    if (core >= MAX_DOMAIN_CORES) {
-        return false;
-    }
-    
-    uint32_t word = core / 64;
-    uint32_t bit = core % 64;
-    
-    return (set->bitmap[word] & (1ULL << bit)) != 0;
-}
-
-bool core_set_overlaps(const core_set_t *a, const core_set_t *b) {
-    for (int i = 0; i < 4; i++) {
-        if ((a->bitmap[i] & b->bitmap[i]) != 0) {
-            return true;
-        }
-    }
-    return false;
-}
-
-bool core_set_is_valid(const core_set_t *set, const boot_facts_t *boot) {
-    /* Check that all cores in set exist in hardware */
-    for (core_id_t core = 0; core < MAX_DOMAIN_CORES; core++) {
-        if (core_set_contains(set, core)) {
-            if (core >= boot->cpu_count) {
-                return false;
-            }
-        }
-    }
-    return true;
-}
-
-void core_set_add(core_set_t *set, core_id_t core) {
-    if (core >= MAX_DOMAIN_CORES) {
-        return;
-    }
-    
-    uint32_t word = core / 64;
-    uint32_t bit = core % 64;
-    
-    set->bitmap[word] |= (1ULL << bit);
-    set->count++;
-    set->explicit = true;
+static void validation_context_add_error(
+    validation_context_t *ctx,
+    validation_error_t error,
+    validation_result_t severity
+) {
+    const validation_detail_t none = {
+        .domain = DOMAIN_ID_INVALID,
+        .other = DOMAIN_ID_INVALID,
+        .first_core = CORE_ID_INVALID,
+        .core_count = 0
+    };
+    validation_context_add_detail(ctx, error, severity, &none);
 }
 
-void core_set_clear(core_set_t *set) {
-    memset(set->bitmap, 0, sizeof(set->bitmap));
-    set->count = 0;
-    set->explicit = false;
+bool validation_context_allows_boot(const validation_context_t *ctx) {
+    return ctx->worst_result != VALIDATION_HARD_FAIL;
 }
 
 /* ========================================================================
@@ -139,6 +93,65 @@ void dependency_set_clear(dependency_set_t *deps) {
     memset(deps->depends_on, 0xFF, sizeof(deps->depends_on));
 }
 
+/* ========================================================================
+ * DOMAIN ID INDEX
+ * ======================================================================== */
+
+static uint32_t domain_index_slot(domain_id_t id) {
+    /* Fibonacci hashing: top bits of id * 2^32/phi */
+    return (uint32_t)(id * 0x9E3779B1u) >> (32 - DOMAIN_INDEX_BITS);
+}
+
+/* Insert domains[position]; an ID already present keeps its first position */
+static void domain_index_insert(domain_id_index_t *index, domain_id_t id,
+                                uint32_t position) {
+    uint32_t slot = domain_index_slot(id);
+    
+    while (index->positions[slot] != 0) {
+        if (index->ids[slot] == id) {
+            return;
+        }
+        slot = (slot + 1) & (DOMAIN_INDEX_SLOTS - 1);
+    }
+    
+    index->ids[slot] = id;
+    index->positions[slot] = (uint8_t)(position + 1);
+}
+
+static void domain_index_rebuild(domain_graph_t *graph) {
+    domain_id_index_t *index = &graph->index;
+    
+    memset(index->positions, 0, sizeof(index->positions));
+    for (uint32_t i = 0; i < graph->domain_count; i++) {
+        domain_index_insert(index, graph->domains[i].id, i);
+    }
+    index->indexed = graph->domain_count;
+}
+
+uint32_t domain_graph_index_of(const domain_graph_t *graph, domain_id_t id) {
+    const domain_id_index_t *index = &graph->index;
+    
+    if (index->indexed != graph->domain_count) {
+        /* domains[] filled in place: index is stale until validate */
+        for (uint32_t i = 0; i < graph->domain_count; i++) {
+            if (graph->domains[i].id == id) {
+                return i;
+            }
+        }
+        return DOMAIN_INDEX_NONE;
+    }
+    
+    /* Load <= 1/2 guarantees an empty slot ends every probe */
+    uint32_t slot = domain_index_slot(id);
+    while (index->positions[slot] != 0) {
+        if (index->ids[slot] == id) {
+            return index->positions[slot] - 1u;
+        }
+        slot = (slot + 1) & (DOMAIN_INDEX_SLOTS - 1);
+    }
+    return DOMAIN_INDEX_NONE;
+}
+
 /* ========================================================================
  * DOMAIN GRAPH MANAGEMENT
  * ======================================================================== */
@@ -166,8 +179,15 @@ bool domain_graph_add(domain_graph_t *graph, const security_domain_t *domain) {
         return false;
     }
     
+    /* Extend the index only while it is current; else validate rebuilds */
+    if (graph->index.indexed == graph->domain_count) {
+        domain_index_insert(&graph->index, domain->id, graph->domain_count);
+        graph->index.indexed++;
+    }
+    
     graph->domains[graph->domain_count++] = *domain;
     graph->validated = false;  /* Must revalidate after changes */
+    graph->tracked = false;    /* Incremental state misses this domain */
     
     return true;
 }
@@ -176,12 +196,8 @@ const security_domain_t* domain_graph_get(
     const domain_graph_t *graph,
     domain_id_t id
 ) {
-    for (uint32_t i = 0; i < graph->domain_count; i++) {
-        if (graph->domains[i].id == id) {
-            return &graph->domains[i];
-        }
-    }
-    return NULL;
+    uint32_t position = domain_graph_index_of(graph, id);
+    return (position == DOMAIN_INDEX_NONE) ? NULL : &graph->domains[position];
 }
 
 /* ========================================================================
@@ -253,6 +269,13 @@ validation_result_t domain_validate_fields(
         result = VALIDATION_HARD_FAIL;
     }
     
+    /* Non-local memory tier must be explicit */
+    if (domain->memory_tier != MEMORY_TIER_LOCAL && !domain->memory_tier_explicit) {
+        validation_context_add_error(ctx, VALIDATION_ERROR_FIELD_NOT_SET,
+                                    VALIDATION_HARD_FAIL);
+        result = VALIDATION_HARD_FAIL;
+    }
+    
     return result;
 }
 
@@ -274,14 +297,13 @@ validation_result_t domain_validate_boot(
     }
     
     /* Verify all cores exist in hardware */
-    for (core_id_t core = 0; core < MAX_DOMAIN_CORES; core++) {
-        if (core_set_contains(&domain->cores, core)) {
-            if (core >= boot_facts->cpu_count) {
-                validation_context_add_error(ctx, 
-                                            VALIDATION_ERROR_CORE_NOT_EXIST,
-                                            VALIDATION_HARD_FAIL);
-                result = VALIDATION_HARD_FAIL;
-            }
+    core_id_t core;
+    CORE_SET_FOR_EACH(core, &domain->cores) {
+        if (core >= boot_facts->cpu_count) {
+            validation_context_add_error(ctx, 
+                                        VALIDATION_ERROR_CORE_NOT_EXIST,
+                                        VALIDATION_HARD_FAIL);
+            result = VALIDATION_HARD_FAIL;
         }
     }
     
@@ -292,6 +314,23 @@ validation_result_t domain_validate_boot(
  * TOPOLOGY VALIDATION
  * ======================================================================== */
 
+/**
+ * Matrix level a domain's isolation requirement needs between members
+ * 
+ * Requirements are CUMULATIVE (L2 = private L1 AND L2) and matrix
+ * levels name the lowest cache two cores share, so a requirement at
+ * Lk needs every pair to share nothing below L(k+1).
+ */
+cache_isolation_level_t domain_required_isolation(cache_isolation_t isolation) {
+    switch (isolation) {
+        case CACHE_ISOLATION_L1:   return CACHE_ISOLATED_L2;
+        case CACHE_ISOLATION_L2:   return CACHE_ISOLATED_L3;
+        case CACHE_ISOLATION_L3:   return CACHE_ISOLATED_FULL;
+        case CACHE_ISOLATION_FULL: return CACHE_ISOLATED_FULL;
+        default:                   return CACHE_ISOLATED_NONE;
+    }
+}
+
 validation_result_t domain_validate_topology(
     const security_domain_t *domain,
     const topology_state_t *topology,
@@ -305,110 +344,44 @@ validation_result_t domain_validate_topology(
         return VALIDATION_HARD_FAIL;
     }
     
-    /* Validate cache isolation is achievable */
-    if (domain->cache_isolation >= CACHE_ISOLATION_L1) {
-        /* Check that all cores in domain satisfy isolation requirements */
-        for (core_id_t core_a = 0; core_a < MAX_DOMAIN_CORES; core_a++) {
-            if (!core_set_contains(&domain->cores, core_a)) {
-                continue;
-            }
-            
-            for (core_id_t core_b = 0; core_b < MAX_DOMAIN_CORES; core_b++) {
-                if (core_a == core_b) continue;
-                if (!core_set_contains(&domain->cores, core_b)) {
-                    continue;
-                }
-                
-                /* Check if cores share cache at prohibited level */
-                const core_geometry_t *geom_a = 
-                    topology_get_core_geometry(topology, core_a);
-                const core_geometry_t *geom_b = 
-                    topology_get_core_geometry(topology, core_b);
-                
-                if (!geom_a || !geom_b) {
-                    validation_context_add_error(ctx,
-                        VALIDATION_ERROR_CACHE_ISOLATION_UNSATISFIABLE,
-                        VALIDATION_HARD_FAIL);
-                    result = VALIDATION_HARD_FAIL;
-                    continue;
-                }
-                
-                /* CRITICAL: Cache isolation requirements are CUMULATIVE
-                 * 
-                 * CACHE_ISOLATION_L1:   Private L1 required
-                 * CACHE_ISOLATION_L2:   Private L1 AND L2 required
-                 * CACHE_ISOLATION_L3:   Private L1, L2, AND L3 required
-                 * CACHE_ISOLATION_FULL: No shared cache at any level
-                 */
-                bool shares_prohibited_cache = false;
-                
-                switch (domain->cache_isolation) {
-                    case CACHE_ISOLATION_L1:
-                        shares_prohibited_cache = 
-                            (geom_a->l1_domain == geom_b->l1_domain);
-                        break;
-                        
-                    case CACHE_ISOLATION_L2:
-                        shares_prohibited_cache = 
-                            (geom_a->l1_domain == geom_b->l1_domain) ||
-                            (geom_a->l2_domain == geom_b->l2_domain);
-                        break;
-                        
-                    case CACHE_ISOLATION_L3:
-                        shares_prohibited_cache = 
-                            (geom_a->l1_domain == geom_b->l1_domain) ||
-                            (geom_a->l2_domain == geom_b->l2_domain) ||
-                            (geom_a->l3_domain == geom_b->l3_domain);
-                        break;
-                        
-                    case CACHE_ISOLATION_FULL:
-                        shares_prohibited_cache = 
-                            (geom_a->l1_domain == geom_b->l1_domain) ||
-                            (geom_a->l2_domain == geom_b->l2_domain) ||
-                            (geom_a->l3_domain == geom_b->l3_domain);
-                        break;
-                        
-default:
-                        break;
-                }
-                
-                if (shares_prohibited_cache) {
-                    validation_context_add_error(ctx,
-                        VALIDATION_ERROR_CACHE_ISOLATION_UNSATISFIABLE,
-                        VALIDATION_HARD_FAIL);
-                    result = VALIDATION_HARD_FAIL;
-                }
-            }
-        }
+    core_mask_t mask;
+    core_set_to_mask(&domain->cores, &mask);
+    
+    /* Validate cache isolation against the sealed matrix */
+    if (domain->cache_isolation >= CACHE_ISOLATION_L1 &&
+        !topology_core_mask_isolated(topology, &mask,
+            domain_required_isolation(domain->cache_isolation))) {
+        validation_context_add_error(ctx,
+            VALIDATION_ERROR_CACHE_ISOLATION_UNSATISFIABLE,
+            VALIDATION_HARD_FAIL);
+        result = VALIDATION_HARD_FAIL;
     }
     
     /* Validate NUMA constraints if required */
-    if (domain->numa_local) {
-        /* All cores must be on same NUMA node */
-        numa_node_t first_node = NUMA_NODE_INVALID;
+    if (domain->numa_local && !core_set_is_empty(&domain->cores)) {
+        /* All cores must be on same NUMA node: subset of one node's mask */
+        if (topology_core_mask_numa_node(topology, &mask) == NUMA_NODE_INVALID) {
+            validation_context_add_error(ctx,
+                VALIDATION_ERROR_NUMA_CONSTRAINT_VIOLATED,
+                VALIDATION_HARD_FAIL);
+            result = VALIDATION_HARD_FAIL;
+        }
+    }
+    
+    /* Validate requested memory tier exists (checked from each core) */
+    if (domain->memory_tier != MEMORY_TIER_LOCAL) {
+        numa_memory_tier_t tier = (domain->memory_tier == MEMORY_TIER_HBM)
+            ? NUMA_TIER_HBM : NUMA_TIER_FAR;
         
-        for (core_id_t core = 0; core < MAX_DOMAIN_CORES; core++) {
-            if (!core_set_contains(&domain->cores, core)) {
-                continue;
-            }
-            
-            const core_geometry_t *geom = 
-                topology_get_core_geometry(topology, core);
-            if (!geom) {
+        core_id_t core;
+        CORE_SET_FOR_EACH(core, &domain->cores) {
+            if (topology_nearest_memory_node(topology, core, tier) ==
+                NUMA_NODE_INVALID) {
                 validation_context_add_error(ctx,
-                    VALIDATION_ERROR_NUMA_CONSTRAINT_VIOLATED,
-                    VALIDATION_HARD_FAIL);
-                result = VALIDATION_HARD_FAIL;
-                continue;
-            }
-            
-            if (first_node == NUMA_NODE_INVALID) {
-                first_node = geom->numa_node;
-            } else if (geom->numa_node != first_node) {
-                validation_context_add_error(ctx,
-                    VALIDATION_ERROR_NUMA_CONSTRAINT_VIOLATED,
+                    VALIDATION_ERROR_MEMORY_TIER_UNAVAILABLE,
                     VALIDATION_HARD_FAIL);
                 result = VALIDATION_HARD_FAIL;
+                break;
             }
         }
     }
@@ -453,99 +426,233 @@ validation_result_t domain_validate_dependencies(
  * GRAPH-LEVEL VALIDATORS
  * ======================================================================== */
 
-validation_result_t domain_graph_validate_no_overlap(
+validation_result_t domain_graph_validate_unique_ids(
     const domain_graph_t *graph,
     validation_context_t *ctx
 ) {
     validation_result_t result = VALIDATION_ACCEPT;
     
-    /* Check every pair of domains for overlapping cores */
+    /* The index keeps the first position per ID; any later one repeats it */
     for (uint32_t i = 0; i < graph->domain_count; i++) {
-        for (uint32_t j = i + 1; j < graph->domain_count; j++) {
-            const security_domain_t *domain_a = &graph->domains[i];
-            const security_domain_t *domain_b = &graph->domains[j];
-            
-            if (core_set_overlaps(&domain_a->cores, &domain_b->cores)) {
-                validation_context_add_error(ctx, 
-                                            VALIDATION_ERROR_CORES_OVERLAP,
-                                            VALIDATION_HARD_FAIL);
-                result = VALIDATION_HARD_FAIL;
-            }
+        domain_id_t id = graph->domains[i].id;
+        
+        if (domain_graph_index_of(graph, id) != i) {
+            const validation_detail_t detail = {
+                .domain = id,
+                .other = DOMAIN_ID_INVALID,
+                .first_core = CORE_ID_INVALID,
+                .core_count = 0
+            };
+            validation_context_add_detail(ctx, VALIDATION_ERROR_DUPLICATE_ID,
+                                         VALIDATION_HARD_FAIL, &detail);
+            result = VALIDATION_HARD_FAIL;
         }
     }
     
     return result;
 }
 
-validation_result_t domain_graph_validate_acyclic(
+validation_result_t domain_graph_validate_no_overlap(
     const domain_graph_t *graph,
     validation_context_t *ctx
 ) {
-    /* Use depth-first search to detect cycles */
-    typedef enum {
-        VISIT_STATE_UNVISITED,
-        VISIT_STATE_VISITING,
-        VISIT_STATE_VISITED
-    } visit_state_t;
-    
-    visit_state_t states[MAX_DOMAINS];
-    for (uint32_t i = 0; i < MAX_DOMAINS; i++) {
-        states[i] = VISIT_STATE_UNVISITED;
-    }
-    
-    bool has_cycle = false;
-    
-    /* Helper: DFS visit function */
-    bool dfs_visit(domain_id_t id, visit_state_t *states, 
-                   const domain_graph_t *g) {
-        uint32_t index = 0;
-        for (uint32_t i = 0; i < g->domain_count; i++) {
-            if (g->domains[i].id == id) {
-                index = i;
-                break;
-            }
-        }
-        
-        if (states[index] == VISIT_STATE_VISITING) {
-            return true;  /* Cycle detected */
-        }
-        
-        if (states[index] == VISIT_STATE_VISITED) {
-            return false;  /* Already processed */
-        }
+    validation_result_t result = VALIDATION_ACCEPT;
+    
+    /* Cores claimed by earlier domains, and which domain claimed each.
+     * owner[] is only read for cores in claimed, so it needs no init. */
+    core_set_t claimed, shared, fresh;
+    uint8_t owner[MAX_DOMAIN_CORES];
+    core_set_clear(&claimed);
+    core_set_clear(&shared);
+    core_set_clear(&fresh);
+    
+    _Static_assert(MAX_DOMAINS <= 256, "owner table index must fit uint8_t");
+    
+    for (uint32_t i = 0; i < graph->domain_count; i++) {
+        const security_domain_t *domain = &graph->domains[i];
+        core_id_t core;
         
-        states[index] = VISIT_STATE_VISITING;
+        core_set_intersect(&shared, &domain->cores, &claimed);
         
-        const security_domain_t *domain = &g->domains[index];
-        for (uint32_t i = 0; i < domain->dependencies.count; i++) {
-            domain_id_t dep_id = domain->dependencies.depends_on[i];
-            if (dfs_visit(dep_id, states, g)) {
-                return true;  /* Cycle found in subtree */
+        if (shared.count > 0) {
+            /* Group shared cores by earlier owner: one error per pair */
+            validation_detail_t per_owner[MAX_DOMAINS];
+            uint64_t owners = 0;
+            
+            CORE_SET_FOR_EACH(core, &shared) {
+                uint32_t o = owner[core];
+                if (!(owners & (1ULL << o))) {
+                    owners |= 1ULL << o;
+                    per_owner[o] = (validation_detail_t){
+                        .domain = domain->id,
+                        .other = graph->domains[o].id,
+                        .first_core = core,
+                        .core_count = 0
+                    };
+                }
+                per_owner[o].core_count++;
+            }
+            
+            while (owners != 0) {
+                uint32_t o = (uint32_t)__builtin_ctzll(owners);
+                owners &= owners - 1;
+                validation_context_add_detail(ctx,
+                                             VALIDATION_ERROR_CORES_OVERLAP,
+                                             VALIDATION_HARD_FAIL,
+                                             &per_owner[o]);
             }
+            result = VALIDATION_HARD_FAIL;
         }
         
-        states[index] = VISIT_STATE_VISITED;
-        return false;
+        /* First claim wins: only newly claimed cores take this owner */
+        core_set_difference(&fresh, &domain->cores, &claimed);
+        CORE_SET_FOR_EACH(core, &fresh) {
+            owner[core] = (uint8_t)i;
+        }
+        core_set_union(&claimed, &claimed, &fresh);
     }
     
-    /* Check each domain as potential cycle start */
+    return result;
+}
+
+/* Dependency rows by position: bit j of rows[i] = domains[i] depends on j */
+static void domain_graph_dependency_rows(const domain_graph_t *graph,
+                                         uint64_t rows[MAX_DOMAINS]) {
     for (uint32_t i = 0; i < graph->domain_count; i++) {
-        if (states[i] == VISIT_STATE_UNVISITED) {
-            if (dfs_visit(graph->domains[i].id, states, graph)) {
-                has_cycle = true;
-                break;
+        const dependency_set_t *deps = &graph->domains[i].dependencies;
+        uint64_t row = 0;
+        
+        for (uint32_t d = 0; d < deps->count; d++) {
+            uint32_t j = domain_graph_index_of(graph, deps->depends_on[d]);
+            if (j != DOMAIN_INDEX_NONE) {
+                row |= 1ULL << j;  /* Unknown IDs: domain_validate_dependencies */
             }
         }
+        rows[i] = row;
     }
+}
+
+static void report_cycle(
+    const domain_graph_t *graph,
+    const uint64_t rows[MAX_DOMAINS],
+    uint64_t members,
+    validation_context_t *ctx
+) {
+    uint32_t first = (uint32_t)__builtin_ctzll(members);
+    uint32_t next = (uint32_t)__builtin_ctzll(rows[first] & members);
     
-    if (has_cycle) {
-        validation_context_add_error(ctx, 
-                                    VALIDATION_ERROR_DEPENDENCY_CIRCULAR,
-                                    VALIDATION_HARD_FAIL);
-        return VALIDATION_HARD_FAIL;
+    const validation_detail_t detail = {
+        .domain = graph->domains[first].id,
+        .other = graph->domains[next].id,
+        .first_core = CORE_ID_INVALID,
+        .core_count = 0,
+        .members = members
+    };
+    validation_context_add_detail(ctx, VALIDATION_ERROR_DEPENDENCY_CIRCULAR,
+                                 VALIDATION_HARD_FAIL, &detail);
+}
+
+/**
+ * Iterative Tarjan over positions
+ * 
+ * Explicit call stack of positions; pending[v] holds the dependency
+ * edges of v not yet followed, consumed lowest bit first. Writes the
+ * SCC completion order (dependencies first) to order[].
+ */
+static validation_result_t domain_graph_check_acyclic(
+    const domain_graph_t *graph,
+    validation_context_t *ctx,
+    uint8_t order[MAX_DOMAINS]
+) {
+    enum { UNVISITED = 0xFF };
+    
+    uint64_t rows[MAX_DOMAINS];
+    uint64_t pending[MAX_DOMAINS];
+    uint8_t  visit[MAX_DOMAINS];      /* Discovery index */
+    uint8_t  low[MAX_DOMAINS];        /* Lowest index reachable on stack */
+    uint8_t  calls[MAX_DOMAINS];      /* DFS path */
+    uint8_t  scc_stack[MAX_DOMAINS];
+    uint64_t on_stack = 0;
+    uint32_t depth = 0, scc_top = 0, discovered = 0, emitted = 0;
+    validation_result_t result = VALIDATION_ACCEPT;
+    
+    domain_graph_dependency_rows(graph, rows);
+    memset(visit, UNVISITED, sizeof(visit));
+    
+    for (uint32_t root = 0; root < graph->domain_count; root++) {
+        if (visit[root] != UNVISITED) {
+            continue;
+        }
+        
+        uint32_t w = root;
+        
+        for (;;) {
+            if (w != UNVISITED) {
+                /* Discover w */
+                visit[w] = low[w] = (uint8_t)discovered++;
+                pending[w] = rows[w];
+                scc_stack[scc_top++] = (uint8_t)w;
+                on_stack |= 1ULL << w;
+                calls[depth++] = (uint8_t)w;
+            }
+            
+            if (depth == 0) {
+                break;
+            }
+            
+            uint32_t v = calls[depth - 1];
+            w = UNVISITED;
+            
+            if (pending[v] != 0) {
+                uint32_t dep = (uint32_t)__builtin_ctzll(pending[v]);
+                pending[v] &= pending[v] - 1;
+                
+                if (visit[dep] == UNVISITED) {
+                    w = dep;
+                } else if (on_stack & (1ULL << dep)) {
+                    if (visit[dep] < low[v]) {
+                        low[v] = visit[dep];
+                    }
+                }
+                continue;
+            }
+            
+            /* v finished: propagate low to its caller */
+            depth--;
+            if (depth > 0 && low[v] < low[calls[depth - 1]]) {
+                low[calls[depth - 1]] = low[v];
+            }
+            
+            if (low[v] != visit[v]) {
+                continue;
+            }
+            
+            /* v is a component root: pop the component */
+            uint64_t members = 0;
+            uint32_t member;
+            do {
+                member = scc_stack[--scc_top];
+                members |= 1ULL << member;
+                order[emitted++] = (uint8_t)member;
+            } while (member != v);
+            on_stack &= ~members;
+            
+            if ((members & (members - 1)) != 0 || (rows[v] & members) != 0) {
+                report_cycle(graph, rows, members, ctx);
+                result = VALIDATION_HARD_FAIL;
+            }
+        }
     }
     
-    return VALIDATION_ACCEPT;
+    return result;
+}
+
+validation_result_t domain_graph_validate_acyclic(
+    const domain_graph_t *graph,
+    validation_context_t *ctx
+) {
+    uint8_t order[MAX_DOMAINS];
+    return domain_graph_check_acyclic(graph, ctx, order);
 }
 
 validation_result_t domain_graph_validate_cache_isolation(
@@ -570,12 +677,241 @@ validation_result_t domain_graph_validate_cache_isolation(
 }
 
 /* ========================================================================
- * MAIN VALIDATION FUNCTION
+ * INCREMENTAL STATE
  * ======================================================================== */
 
-validation_result_t domain_graph_validate(
+static validation_result_t worse_of(validation_result_t a, validation_result_t b) {
+    return (a > b) ? a : b;
+}
+
+/* Per-domain checks shared by full and incremental validation */
+static validation_result_t domain_validate_single(
+    const domain_graph_t *graph,
+    const security_domain_t *domain,
+    validation_context_t *ctx
+) {
+    validation_result_t result = domain_validate_fields(domain, ctx);
+    result = worse_of(result, domain_validate_boot(domain, graph->boot_facts, ctx));
+    result = worse_of(result, domain_validate_topology(domain, graph->topology, ctx));
+    result = worse_of(result, domain_validate_dependencies(domain, graph, ctx));
+    return result;
+}
+
+/* Claim domains[position]'s cores; returns positions already owning any */
+static uint64_t domain_graph_claim(domain_graph_t *graph, uint32_t position) {
+    uint64_t self = 1ULL << position;
+    uint64_t conflicts = 0;
+    core_id_t core;
+    
+    CORE_SET_FOR_EACH(core, &graph->domains[position].cores) {
+        uint64_t others = graph->core_owners[core];
+        
+        graph->core_owners[core] = others | self;
+        core_set_add(&graph->claimed, core);
+        if (others != 0) {
+            core_set_add(&graph->contested, core);
+            conflicts |= others;
+        }
+    }
+    
+    return conflicts;
+}
+
+/* The owner table is the only record of a domain's cores before an edit */
+static void domain_graph_release(domain_graph_t *graph, uint32_t position) {
+    uint64_t self = 1ULL << position;
+    core_set_t scan = graph->claimed;
+    core_id_t core;
+    
+    CORE_SET_FOR_EACH(core, &scan) {
+        uint64_t owners = graph->core_owners[core];
+        if (!(owners & self)) {
+            continue;
+        }
+        
+        owners &= ~self;
+        graph->core_owners[core] = owners;
+        
+        if (owners == 0) {
+            core_set_remove(&graph->claimed, core);
+        }
+        if ((owners & (owners - 1)) == 0) {
+            core_set_remove(&graph->contested, core);
+        }
+    }
+}
+
+static void domain_graph_track_claims(domain_graph_t *graph) {
+    core_id_t core;
+    
+    /* Only previously claimed owner entries can be non-zero */
+    CORE_SET_FOR_EACH(core, &graph->claimed) {
+        graph->core_owners[core] = 0;
+    }
+    core_set_clear(&graph->claimed);
+    core_set_clear(&graph->contested);
+    
+    for (uint32_t i = 0; i < graph->domain_count; i++) {
+        domain_graph_claim(graph, i);
+    }
+}
+
+/* Direct dependency rows, then Warshall: if i reaches k, i reaches
+ * everything k reaches. D^2 word operations for D domains. */
+static void domain_graph_build_access(domain_graph_t *graph) {
+    uint32_t count = graph->domain_count;
+    
+    for (uint32_t i = 0; i < count; i++) {
+        const dependency_set_t *deps = &graph->domains[i].dependencies;
+        uint64_t row = 0;
+        
+        for (uint32_t d = 0; d < deps->count; d++) {
+            uint32_t j = domain_graph_index_of(graph, deps->depends_on[d]);
+            if (j != DOMAIN_INDEX_NONE) {
+                row |= 1ULL << j;
+            }
+        }
+        
+        graph->access_direct[i] = row;
+        graph->access_reach[i] = row;
+    }
+    
+    for (uint32_t k = 0; k < count; k++) {
+        uint64_t via_k = graph->access_reach[k];
+        
+        for (uint32_t i = 0; i < count; i++) {
+            if (graph->access_reach[i] & (1ULL << k)) {
+                graph->access_reach[i] |= via_k;
+            }
+        }
+    }
+}
+
+/* ========================================================================
+ * PER-DOMAIN STAGE (serial or parallel)
+ * ======================================================================== */
+
+/**
+ * One contiguous block of domains, validated into a private context
+ * 
+ * Blocks are merged in block order, which is domain-index order, so
+ * the merged error list equals the serial one whatever the thread
+ * timing. failing_after records where the block's own context first
+ * reached HARD_FAIL, which is what serial mode uses to set
+ * domain->validated.
+ */
+typedef struct {
+    const domain_graph_t *graph;
+    uint32_t              first;
+    uint32_t              end;
+    validation_context_t  ctx;
+    uint64_t              failed;         /* bit = position */
+    uint64_t              failing_after;  /* ctx HARD_FAIL after position */
+} domain_block_t;
+
+static void domain_block_run(domain_block_t *block) {
+    const domain_graph_t *graph = block->graph;
+    
+    validation_context_init(&block->ctx);
+    block->failed = 0;
+    block->failing_after = 0;
+    
+    for (uint32_t i = block->first; i < block->end; i++) {
+        const security_domain_t *domain = &graph->domains[i];
+        
+        if (domain_validate_single(graph, domain, &block->ctx) == VALIDATION_HARD_FAIL ||
+            domain_graph_index_of(graph, domain->id) != i) {
+            block->failed |= 1ULL << i;
+        }
+        
+        if (block->ctx.worst_result == VALIDATION_HARD_FAIL) {
+            block->failing_after |= 1ULL << i;
+        }
+    }
+}
+
+static void *domain_block_worker(void *arg) {
+    domain_block_run(arg);
+    return NULL;
+}
+
+/* Append a block's errors and outcomes exactly as serial mode records them */
+static void domain_block_merge(
     domain_graph_t *graph,
+    const domain_block_t *block,
     validation_context_t *ctx
+) {
+    bool failing_before = (ctx->worst_result == VALIDATION_HARD_FAIL);
+    
+    /* Same 64-entry cap as validation_context_add_error */
+    for (uint32_t e = 0; e < block->ctx.error_count && ctx->error_count < 64; e++) {
+        ctx->details[ctx->error_count] = block->ctx.details[e];
+        ctx->errors[ctx->error_count++] = block->ctx.errors[e];
+    }
+    ctx->worst_result = worse_of(ctx->worst_result, block->ctx.worst_result);
+    
+    for (uint32_t i = block->first; i < block->end; i++) {
+        /* Mark domain as validated if no hard failures */
+        if (!failing_before && !(block->failing_after & (1ULL << i))) {
+            graph->domains[i].validated = true;
+        }
+    }
+    
+    graph->failed_domains |= block->failed;
+}
+
+static void domain_graph_validate_domains(
+    domain_graph_t *graph,
+    validation_context_t *ctx,
+    uint32_t workers
+) {
+    domain_block_t blocks[DOMAIN_VALIDATE_MAX_WORKERS];
+    pthread_t threads[DOMAIN_VALIDATE_MAX_WORKERS];
+    bool spawned[DOMAIN_VALIDATE_MAX_WORKERS];
+    uint32_t count = graph->domain_count;
+    
+    if (workers > DOMAIN_VALIDATE_MAX_WORKERS) {
+        workers = DOMAIN_VALIDATE_MAX_WORKERS;
+    }
+    if (workers > count) {
+        workers = count;
+    }
+    if (workers == 0) {
+        workers = 1;
+    }
+    
+    /* Contiguous blocks; block 0 runs on the calling thread */
+    for (uint32_t w = 0; w < workers; w++) {
+        blocks[w].graph = graph;
+        blocks[w].first = (uint32_t)((uint64_t)count * w / workers);
+        blocks[w].end = (uint32_t)((uint64_t)count * (w + 1) / workers);
+        spawned[w] = (w > 0) &&
+                     pthread_create(&threads[w], NULL, domain_block_worker,
+                                    &blocks[w]) == 0;
+    }
+    
+    for (uint32_t w = 0; w < workers; w++) {
+        if (spawned[w]) {
+            pthread_join(threads[w], NULL);
+        } else {
+            domain_block_run(&blocks[w]);  /* Block 0, or spawn failed */
+        }
+    }
+    
+    graph->failed_domains = 0;
+    for (uint32_t w = 0; w < workers; w++) {
+        domain_block_merge(graph, &blocks[w], ctx);
+    }
+}
+
+/* ========================================================================
+ * MAIN VALIDATION FUNCTION
+ * ======================================================================== */
+
+static validation_result_t domain_graph_validate_with(
+    domain_graph_t *graph,
+    validation_context_t *ctx,
+    uint32_t workers
 ) {
     validation_context_init(ctx);
     
@@ -592,6 +928,10 @@ validation_result_t domain_graph_validate(
         return VALIDATION_HARD_FAIL;
     }
     
+    /* domains[] may have been filled in place (config parser) */
+    domain_index_rebuild(graph);
+    domain_graph_validate_unique_ids(graph, ctx);
+    
     /* Check domain count */
     if (graph->domain_count == 0) {
         /* No domains is technically valid but unusual */
@@ -600,25 +940,19 @@ validation_result_t domain_graph_validate(
     }
     
     /* Validate each domain individually */
-    for (uint32_t i = 0; i < graph->domain_count; i++) {
-        security_domain_t *domain = &graph->domains[i];
-        
-        domain_validate_fields(domain, ctx);
-        domain_validate_boot(domain, graph->boot_facts, ctx);
-        domain_validate_topology(domain, graph->topology, ctx);
-        domain_validate_dependencies(domain, graph, ctx);
-        
-        /* Mark domain as validated if no hard failures */
-        if (ctx->worst_result != VALIDATION_HARD_FAIL) {
-            domain->validated = true;
-        }
-    }
+    domain_graph_validate_domains(graph, ctx, workers);
     
     /* Validate graph-level properties */
     domain_graph_validate_no_overlap(graph, ctx);
-    domain_graph_validate_acyclic(graph, ctx);
+    graph->cyclic = domain_graph_check_acyclic(graph, ctx, graph->startup_order)
+                    == VALIDATION_HARD_FAIL;
     domain_graph_validate_cache_isolation(graph, ctx);
     
+    /* State for domain_graph_revalidate_domain */
+    domain_graph_track_claims(graph);
+    domain_graph_build_access(graph);
+    graph->tracked = true;
+    
     /* Mark graph as validated if successful */
     if (ctx->worst_result != VALIDATION_HARD_FAIL) {
         graph->validated = true;
@@ -627,10 +961,221 @@ validation_result_t domain_graph_validate(
     return ctx->worst_result;
 }
 
+validation_result_t domain_graph_validate(
+    domain_graph_t *graph,
+    validation_context_t *ctx
+) {
+    return domain_graph_validate_with(graph, ctx, 1);
+}
+
+validation_result_t domain_graph_validate_parallel(
+    domain_graph_t *graph,
+    validation_context_t *ctx,
+    uint32_t workers
+) {
+    return domain_graph_validate_with(graph, ctx, workers);
+}
+
+validation_result_t domain_graph_validate_structure(
+    domain_graph_t *graph,
+    validation_context_t *ctx
+) {
+    validation_context_init(ctx);
+    
+    domain_index_rebuild(graph);
+    domain_graph_validate_unique_ids(graph, ctx);
+    
+    for (uint32_t i = 0; i < graph->domain_count; i++) {
+        const security_domain_t *domain = &graph->domains[i];
+        domain_validate_fields(domain, ctx);
+        domain_validate_dependencies(domain, graph, ctx);
+    }
+    
+    domain_graph_validate_no_overlap(graph, ctx);
+    graph->cyclic = domain_graph_check_acyclic(graph, ctx, graph->startup_order)
+                    == VALIDATION_HARD_FAIL;
+    
+    return ctx->worst_result;
+}
+
+/* ========================================================================
+ * COMPILED LAYOUTS
+ * ======================================================================== */
+
+validation_result_t domain_graph_validate_compiled(
+    domain_graph_t *graph,
+    const security_domain_t *domains,
+    uint32_t count,
+    const uint8_t *startup_order,
+    validation_context_t *ctx
+) {
+    validation_context_init(ctx);
+    
+    if (graph->sealed) {
+        validation_context_add_error(ctx, VALIDATION_ERROR_GRAPH_SEALED,
+                                    VALIDATION_HARD_FAIL);
+        return VALIDATION_HARD_FAIL;
+    }
+    
+    if (count > MAX_DOMAINS) {
+        validation_context_add_error(ctx, VALIDATION_ERROR_TOO_MANY_DOMAINS,
+                                    VALIDATION_HARD_FAIL);
+        return VALIDATION_HARD_FAIL;
+    }
+    
+    if (!graph->boot_facts || !graph->topology) {
+        validation_context_add_error(ctx, graph->boot_facts
+                                         ? VALIDATION_ERROR_TOPOLOGY_NULL
+                                         : VALIDATION_ERROR_BOOT_FACTS_NULL,
+                                    VALIDATION_HARD_FAIL);
+        return VALIDATION_HARD_FAIL;
+    }
+    
+    /* Structure was proven at build time: copy, don't re-derive */
+    memcpy(graph->domains, domains, count * sizeof(domains[0]));
+    memcpy(graph->startup_order, startup_order, count);
+    graph->domain_count = count;
+    graph->cyclic = false;
+    domain_index_rebuild(graph);
+    
+    graph->failed_domains = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        security_domain_t *domain = &graph->domains[i];
+        
+        validation_result_t result =
+            worse_of(domain_validate_boot(domain, graph->boot_facts, ctx),
+                     domain_validate_topology(domain, graph->topology, ctx));
+        
+        domain->validated = (result != VALIDATION_HARD_FAIL);
+        if (!domain->validated) {
+            graph->failed_domains |= 1ULL << i;
+        }
+    }
+    
+    domain_graph_track_claims(graph);
+    domain_graph_build_access(graph);
+    graph->tracked = true;
+    graph->validated = (ctx->worst_result != VALIDATION_HARD_FAIL);
+    
+    return ctx->worst_result;
+}
+
+/* ========================================================================
+ * INCREMENTAL REVALIDATION
+ * ======================================================================== */
+
+validation_result_t domain_graph_revalidate_domain(
+    domain_graph_t *graph,
+    domain_id_t id,
+    validation_context_t *ctx
+) {
+    validation_context_init(ctx);
+    
+    if (graph->sealed) {
+        validation_context_add_error(ctx, VALIDATION_ERROR_GRAPH_SEALED,
+                                    VALIDATION_HARD_FAIL);
+        return VALIDATION_HARD_FAIL;
+    }
+    
+    /* Parser fills domains[] in place without touching the index */
+    if (!graph->tracked || graph->index.indexed != graph->domain_count) {
+        return domain_graph_validate(graph, ctx);
+    }
+    
+    uint32_t k = domain_graph_index_of(graph, id);
+    if (k == DOMAIN_INDEX_NONE) {
+        const validation_detail_t detail = {
+            .domain = id,
+            .other = DOMAIN_ID_INVALID,
+            .first_core = CORE_ID_INVALID,
+            .core_count = 0
+        };
+        validation_context_add_detail(ctx, VALIDATION_ERROR_DOMAIN_NOT_FOUND,
+                                     VALIDATION_HARD_FAIL, &detail);
+        return VALIDATION_HARD_FAIL;
+    }
+    
+    security_domain_t *domain = &graph->domains[k];
+    uint64_t self = 1ULL << k;
+    
+    /* Per-domain constraints */
+    validation_result_t result = domain_validate_single(graph, domain, ctx);
+    bool domain_failed = (result == VALIDATION_HARD_FAIL);
+    
+    domain->validated = !domain_failed;
+    graph->failed_domains = domain_failed ? (graph->failed_domains | self)
+                                          : (graph->failed_domains & ~self);
+    
+    /* Overlaps: swap the old claims for the new ones */
+    domain_graph_release(graph, k);
+    uint64_t conflicts = domain_graph_claim(graph, k);
+    
+    while (conflicts != 0) {
+        uint32_t j = (uint32_t)__builtin_ctzll(conflicts);
+        conflicts &= conflicts - 1;
+        
+        core_set_t shared;
+        core_set_clear(&shared);   /* Error path only */
+        core_set_intersect(&shared, &domain->cores, &graph->domains[j].cores);
+        
+        const validation_detail_t detail = {
+            .domain = id,
+            .other = graph->domains[j].id,
+            .first_core = core_set_first(&shared),
+            .core_count = shared.count
+        };
+        validation_context_add_detail(ctx, VALIDATION_ERROR_CORES_OVERLAP,
+                                     VALIDATION_HARD_FAIL, &detail);
+        result = VALIDATION_HARD_FAIL;
+    }
+    
+    /* Dependencies: O(V + E) recheck; keep only cycles through this domain */
+    validation_context_t cycles = { 0 };
+    graph->cyclic = domain_graph_check_acyclic(graph, &cycles, graph->startup_order)
+                    == VALIDATION_HARD_FAIL;
+    
+    for (uint32_t e = 0; e < cycles.error_count; e++) {
+        if (cycles.details[e].members & self) {
+            validation_context_add_detail(ctx, cycles.errors[e],
+                                         VALIDATION_HARD_FAIL, &cycles.details[e]);
+            result = VALIDATION_HARD_FAIL;
+        }
+    }
+    
+    domain_graph_build_access(graph);
+    
+    graph->validated = (graph->failed_domains == 0) &&
+                       core_set_is_empty(&graph->contested) &&
+                       !graph->cyclic;
+    
+    return result;
+}
+
 /* ========================================================================
  * SEALING
  * ======================================================================== */
 
+/* Pack the query fields of every domain into its cache line */
+static void domain_graph_build_hot(domain_graph_t *graph) {
+    for (uint32_t i = 0; i < graph->domain_count; i++) {
+        const security_domain_t *domain = &graph->domains[i];
+        domain_hot_t *hot = &graph->hot[i];
+        
+        memset(hot, 0, sizeof(*hot));
+        hot->id = domain->id;
+        hot->security_level = (uint8_t)domain->security_level;
+        hot->preemption = (uint8_t)domain->preemption;
+        hot->cache_isolation = (uint8_t)domain->cache_isolation;
+        hot->memory_type = (uint8_t)domain->memory_type;
+        hot->core_count = domain->cores.count;
+        hot->core_words = domain->cores.words;
+        hot->access_direct = graph->access_direct[i];
+        hot->access_reach = graph->access_reach[i];
+        memcpy(hot->cores, domain->cores.bitmap,
+               domain->cores.words * sizeof(uint64_t));
+    }
+}
+
 bool domain_graph_seal(domain_graph_t *graph) {
     if (!graph->validated) {
         return false;
@@ -640,6 +1185,9 @@ bool domain_graph_seal(domain_graph_t *graph) {
         return false;  /* Already sealed */
     }
     
+    domain_graph_build_access(graph);
+    domain_graph_build_hot(graph);
+    
     /* Mark all domains as sealed */
     for (uint32_t i = 0; i < graph->domain_count; i++) {
         graph->domains[i].sealed = true;
@@ -679,6 +1227,8 @@ const char* validation_error_string(validation_error_t error) {
             return "Cache isolation requirement cannot be satisfied by topology";
         case VALIDATION_ERROR_NUMA_CONSTRAINT_VIOLATED:
             return "NUMA locality constraint violated";
+        case VALIDATION_ERROR_MEMORY_TIER_UNAVAILABLE:
+            return "Requested memory tier not present in topology";
         case VALIDATION_ERROR_DEPENDENCY_NOT_EXIST:
             return "Dependency references non-existent domain";
         case VALIDATION_ERROR_DEPENDENCY_CIRCULAR:
@@ -693,6 +1243,10 @@ const char* validation_error_string(validation_error_t error) {
             return "Boot facts not initialized";
         case VALIDATION_ERROR_TOPOLOGY_NULL:
             return "Topology not initialized";
+        case VALIDATION_ERROR_DOMAIN_NOT_FOUND:
+            return "No domain with this ID";
+        case VALIDATION_ERROR_GRAPH_SEALED:
+            return "Domain graph is sealed";
         case VALIDATION_WARN_UNUSED_CORES:
             return "Warning: Some cores are not assigned to any domain";
         case VALIDATION_WARN_ASYMMETRIC_TOPOLOGY:
@@ -719,7 +1273,25 @@ void validation_context_print(const validation_context_t *ctx) {
     }
     
     for (uint32_t i = 0; i < ctx->error_count; i++) {
-        printf("  [%u] %s\n", i, validation_error_string(ctx->errors[i]));
+        const validation_detail_t *detail = &ctx->details[i];
+        
+        printf("  [%u] %s", i, validation_error_string(ctx->errors[i]));
+        if (detail->domain != DOMAIN_ID_INVALID) {
+            printf(" (domain %u", detail->domain);
+            if (detail->other != DOMAIN_ID_INVALID) {
+                printf(" vs domain %u", detail->other);
+            }
+            if (detail->core_count > 0) {
+                printf(", %u core(s) from core %u",
+                       detail->core_count, detail->first_core);
+            }
+            if (detail->members != 0) {
+                printf(", %d domain(s) in cycle",
+                       __builtin_popcountll(detail->members));
+            }
+            printf(")");
+        }
+        printf("\n");
     }
 }
 
@@ -736,15 +1308,50 @@ bool domain_graph_can_access(
         return false;
     }
     
-    const security_domain_t *from_domain = domain_graph_get(graph, from);
-    const security_domain_t *to_domain = domain_graph_get(graph, to);
+    uint32_t i = domain_graph_index_of(graph, from);
+    uint32_t j = domain_graph_index_of(graph, to);
     
-    if (!from_domain || !to_domain) {
+    if (i == DOMAIN_INDEX_NONE || j == DOMAIN_INDEX_NONE) {
         return false;
     }
     
+    if (graph->sealed) {
+        return (graph->hot[i].access_direct >> j) & 1;
+    }
+    
     /* Check if 'from' depends on 'to' */
-    return dependency_set_contains(&from_domain->dependencies, to);
+    return dependency_set_contains(&graph->domains[i].dependencies, to);
+}
+
+bool domain_graph_can_reach(
+    const domain_graph_t *graph,
+    domain_id_t from,
+    domain_id_t to
+) {
+    if (!graph->sealed) {
+        return false;
+    }
+    
+    uint32_t i = domain_graph_index_of(graph, from);
+    uint32_t j = domain_graph_index_of(graph, to);
+    
+    if (i == DOMAIN_INDEX_NONE || j == DOMAIN_INDEX_NONE) {
+        return false;
+    }
+    
+    return (graph->hot[i].access_reach >> j) & 1;
+}
+
+const domain_hot_t* domain_graph_hot(
+    const domain_graph_t *graph,
+    domain_id_t id
+) {
+    if (!graph->sealed) {
+        return NULL;
+    }
+    
+    uint32_t position = domain_graph_index_of(graph, id);
+    return (position == DOMAIN_INDEX_NONE) ? NULL : &graph->hot[position];
 }
 
 bool domain_graph_cores_isolated(
@@ -756,6 +1363,24 @@ bool domain_graph_cores_isolated(
         return false;
     }
     
+    if (graph->sealed) {
+        const domain_hot_t *hot_a = domain_graph_hot(graph, a);
+        const domain_hot_t *hot_b = domain_graph_hot(graph, b);
+        
+        if (!hot_a || !hot_b) {
+            return false;
+        }
+        
+        uint32_t words = hot_a->core_words < hot_b->core_words ? hot_a->core_words
+                                                               : hot_b->core_words;
+        for (uint32_t w = 0; w < words; w++) {
+            if (hot_a->cores[w] & hot_b->cores[w]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
     const security_domain_t *domain_a = domain_graph_get(graph, a);
     const security_domain_t *domain_b = domain_graph_get(graph, b);
     
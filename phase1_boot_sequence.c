@@ -27,9 +27,24 @@
 #include "boot/boot_contract.h"
 #include "topology/topology_contract.h"
 #include "domains/domain_contract.h"
+#include "config/config_contract.h"
 #include <stdio.h>
 #include <stdlib.h>
-#include <string.h> // For strncpy
+
+/* Layout source: a generated header (-DUCQCF_COMPILED_LAYOUT='"path.h"'),
+ * a binary image (-DUCQCF_BINARY_LAYOUT='"path.bin"', tools/convert_layout)
+ * or the YAML file; files are read into a fixed buffer */
+#ifdef UCQCF_COMPILED_LAYOUT
+#include UCQCF_COMPILED_LAYOUT
+#endif
+
+#ifndef UCQCF_LAYOUT_PATH
+#define UCQCF_LAYOUT_PATH       "config/domain_layout.yaml"
+#endif
+
+#ifndef UCQCF_LAYOUT_MAX_BYTES
+#define UCQCF_LAYOUT_MAX_BYTES  (256 * 1024)
+#endif
 
 /* ========================================================================
  * PANIC HANDLER
@@ -44,6 +59,23 @@ static void panic(const char *message) {
     exit(1);
 }
 
+/* ========================================================================
+ * LAYOUT FILE
+ * ======================================================================== */
+
+/* Whole file into buffer; panics if missing or larger than capacity */
+static size_t read_layout(const char *path, void *buffer, size_t capacity) {
+    size_t size;
+    config_file_error_t error = config_read_file(path, buffer, capacity, &size);
+    
+    if (error != CONFIG_FILE_OK) {
+        printf("[DOMAINS] %s: %s\n", path, config_file_error_string(error));
+        panic(config_file_error_string(error));
+    }
+    
+    return size;
+}
+
 /* ========================================================================
  * PHASE-1 BOOT SEQUENCE
  * ======================================================================== */
@@ -91,7 +123,8 @@ int main(void) {
     
     printf("=== LAYER 2: TOPOLOGY ===\n\n");
     
-    topology_state_t topology;
+    /* Static: N x N matrices grow quadratically with UCQCF_MAX_CPUS */
+    static topology_state_t topology;
     topology_init(&topology, &boot_facts);
     
     /* PROBE: Discover topology */
@@ -103,6 +136,36 @@ int main(void) {
     printf("[TOPOLOGY] Discovered %u cores\n", topology.core_count);
     printf("[TOPOLOGY] Discovered %u NUMA nodes\n", topology.numa_node_count);
     
+    /* PROBE: Measure per-core effective frequency (optional on this arch) */
+    printf("[TOPOLOGY] Calibrating core frequencies...\n");
+    uint32_t calibrated = topology_calibrate_frequencies(&topology, NULL);
+    if (calibrated == 0) {
+        printf("[TOPOLOGY] Frequency measurement unavailable\n");
+    } else {
+        printf("[TOPOLOGY] Calibrated %u cores (core 0: %u MHz, spread %u permille)\n",
+               calibrated, topology.cores[0].base_freq_mhz,
+               topology_core_frequency_spread(&topology, 0));
+    }
+    
+    /* PROBE: Qualify isolated cores by measured OS noise */
+    printf("[TOPOLOGY] Measuring OS noise on isolated cores...\n");
+    uint32_t noise_measured = topology_measure_noise(&topology, NULL);
+    for (uint32_t i = 0; i < topology.core_count; i++) {
+        const core_noise_t *noise = &topology.cores[i].noise;
+        if (noise->measured) {
+            printf("[TOPOLOGY]   core %u: %u gaps, %lu ns stolen, max %u ns%s\n",
+                   i, noise->gap_count, (unsigned long)noise->stolen_ns,
+                   noise->max_gap_ns,
+                   topology_core_noise_within_budget(&topology, i)
+                       ? "" : " (OVER BUDGET)");
+        } else if (noise->failed) {
+            printf("[TOPOLOGY]   core %u: measurement failed%s\n", i,
+                   topology_core_noise_within_budget(&topology, i)
+                       ? "" : " (not isolated)");
+        }
+    }
+    printf("[TOPOLOGY] Noise measured on %u cores\n", noise_measured);
+    
     /* VALIDATE: Verify topology consistency and security requirements */
     printf("\n[TOPOLOGY] Validating...\n");
     topology_validation_context_t topo_ctx;
@@ -138,75 +201,74 @@ int main(void) {
     
     printf("=== LAYER 3: DOMAINS ===\n\n");
     
-    domain_graph_t domain_graph;
+    /* Static: 64 domains with core bitmaps are too large for the stack */
+    static domain_graph_t domain_graph;
     domain_graph_init(&domain_graph, &boot_facts, &topology);
     
-    /* LOAD: Parse domain configuration */
-    printf("[DOMAINS] Loading configuration from config/domain_layout.yaml...\n");
-    
-    /* Example: Add a simple domain configuration */
-    security_domain_t crypto_domain = {0};
-    crypto_domain.id = 1;
-    strncpy(crypto_domain.name, "crypto_domain", sizeof(crypto_domain.name) - 1);
-    crypto_domain.name_explicit = true;
-    crypto_domain.security_level = SECURITY_LEVEL_6;
-    crypto_domain.preemption = PREEMPTION_NEVER;
-    
-    /* Assign cores 4-7 (assuming they're isolated in topology) */
-    core_set_clear(&crypto_domain.cores);
-    for (uint32_t i = 4; i < 8 && i < boot_facts.cpu_count; i++) {
-        core_set_add(&crypto_domain.cores, i);
-    }
-    
-    crypto_domain.cache_isolation = CACHE_ISOLATION_L3;
-    crypto_domain.memory_type = MEMORY_DOMAIN_ISOLATED;
-    crypto_domain.numa_local = true;
-    crypto_domain.numa_local_explicit = true;
-    dependency_set_clear(&crypto_domain.dependencies);
-    
-    if (!domain_graph_add(&domain_graph, &crypto_domain)) {
-        panic("Failed to add crypto domain");
-    }
-    
-    printf("[DOMAINS] Added domain: %s (id=%u, cores=%u)\n",
-           crypto_domain.name, crypto_domain.id, crypto_domain.cores.count);
+    validation_context_t domain_ctx;
+    validation_result_t domain_result;
     
-    /* Add network domain */
-    security_domain_t network_domain = {0};
-    network_domain.id = 2;
-    strncpy(network_domain.name, "network_domain", sizeof(network_domain.name) - 1);
-    network_domain.name_explicit = true;
-    network_domain.security_level = SECURITY_LEVEL_2;
-    network_domain.preemption = PREEMPTION_BY_HIGHER;
+#ifdef UCQCF_COMPILED_LAYOUT
+    /* LOAD: Table compiled at build time (tools/compile_layout); its
+     * _Static_asserts already proved the hardware-independent rules */
+    printf("[DOMAINS] Loading compiled layout (%u domains)...\n", DOMAIN_LAYOUT_COUNT);
     
-    core_set_clear(&network_domain.cores);
-    for (uint32_t i = 0; i < 2 && i < boot_facts.cpu_count; i++) {
-        core_set_add(&network_domain.cores, i);
+    /* VALIDATE: Hardware-dependent checks only, against SEALED topology */
+    printf("\n[DOMAINS] Validating against sealed topology...\n");
+    domain_result = domain_graph_validate_compiled(&domain_graph, domain_layout_table,
+                                                   DOMAIN_LAYOUT_COUNT,
+                                                   domain_layout_startup_order,
+                                                   &domain_ctx);
+#elif defined(UCQCF_BINARY_LAYOUT)
+    /* LOAD: Copy binary image records (header and checksum checked) */
+    printf("[DOMAINS] Loading binary layout from %s...\n", UCQCF_BINARY_LAYOUT);
+    
+    static uint8_t layout_image[CONFIG_BINARY_MAX_SIZE];
+    size_t image_size = read_layout(UCQCF_BINARY_LAYOUT, layout_image,
+                                    sizeof(layout_image));
+    
+    config_binary_status_t binary_status;
+    if (!config_binary_load(layout_image, image_size, &domain_graph, &binary_status)) {
+        printf("[DOMAINS] %s: %s\n", UCQCF_BINARY_LAYOUT,
+               config_binary_error_string(binary_status.error));
+        panic("Domain configuration image rejected");
     }
     
-    network_domain.cache_isolation = CACHE_ISOLATION_L2;
-    network_domain.memory_type = MEMORY_DOMAIN_SHARED_READ;
-    network_domain.numa_local = false;
-    network_domain.numa_local_explicit = true;
-    dependency_set_clear(&network_domain.dependencies);
-    
-    if (!domain_graph_add(&domain_graph, &network_domain)) {
-        panic("Failed to add network domain");
+    /* VALIDATE: Image was checked for integrity only, so run everything */
+    printf("\n[DOMAINS] Validating against sealed topology...\n");
+    domain_result = domain_graph_validate(&domain_graph, &domain_ctx);
+#else
+    /* LOAD: Parse domain configuration (static buffer, no heap) */
+    printf("[DOMAINS] Loading configuration from %s...\n", UCQCF_LAYOUT_PATH);
+    
+    static char layout_text[UCQCF_LAYOUT_MAX_BYTES];
+    size_t layout_size = read_layout(UCQCF_LAYOUT_PATH, layout_text, sizeof(layout_text));
+    
+    config_parse_status_t parse_status;
+    if (!config_parse_domains(layout_text, layout_size, &domain_graph, &parse_status)) {
+        printf("[DOMAINS] %s:%u:%u: %s\n", UCQCF_LAYOUT_PATH,
+               parse_status.line, parse_status.column,
+               config_error_string(parse_status.error));
+        panic("Domain configuration rejected by parser");
     }
     
-    printf("[DOMAINS] Added domain: %s (id=%u, cores=%u)\n",
-           network_domain.name, network_domain.id, network_domain.cores.count);
-    
     /* VALIDATE: Check domains against SEALED topology */
     printf("\n[DOMAINS] Validating against sealed topology...\n");
-    validation_context_t domain_ctx;
-    validation_result_t domain_result = 
-        domain_graph_validate(&domain_graph, &domain_ctx);
+    domain_result = domain_graph_validate(&domain_graph, &domain_ctx);
+#endif
+    
+    for (uint32_t i = 0; i < domain_graph.domain_count; i++) {
+        const security_domain_t *domain = &domain_graph.domains[i];
+        printf("[DOMAINS] Domain: %s (id=%u, cores=%u, dependencies=%u)\n",
+               domain->name, domain->id, domain->cores.count,
+               domain->dependencies.count);
+    }
     
     printf("\n");
     validation_context_print(&domain_ctx);
     
-    if (!validation_context_allows_boot(&domain_ctx)) {
+    if (domain_result == VALIDATION_HARD_FAIL ||
+        !validation_context_allows_boot(&domain_ctx)) {
         panic("Domain validation failed - security constraints unsatisfiable");
     }
     
@@ -252,18 +314,17 @@ int main(void) {
             case CACHE_ISOLATED_L2: printf("L2\n"); break;
             case CACHE_ISOLATED_L3: printf("L3\n"); break;
             case CACHE_ISOLATED_FULL: printf("FULL\n"); break;
-            case CACHE_ISOLATION_UNDEFINED: printf("UNDEFINED\n"); break; // Added to handle enum
         }
     }
     
-    /* Query domain isolation */
-    bool isolated = domain_graph_cores_isolated(&domain_graph, 1, 2);
-    printf("Crypto domain (1) isolated from network domain (2): %s\n",
+    /* Query domain isolation (IDs from config/domain_layout.yaml) */
+    bool isolated = domain_graph_cores_isolated(&domain_graph, 1, 3);
+    printf("Crypto domain (1) isolated from network domain (3): %s\n",
            isolated ? "YES" : "NO");
     
     /* Query domain access */
-    bool can_access = domain_graph_can_access(&domain_graph, 2, 1);
-    printf("Network domain (2) can access crypto domain (1): %s\n",
+    bool can_access = domain_graph_can_access(&domain_graph, 4, 1);
+    printf("Validation domain (4) can access crypto domain (1): %s\n",
            can_access ? "YES" : "NO");
     
     printf("\n");
@@ -0,0 +1,119 @@
+/**
+ * Compiled domain layout
+ *
+ * GENERATED by config_compile_domains() from add_fixture_layout() in
+ * tests/config/test_domain_config.c.
+ * Do not edit: regenerate from the layout instead.
+ *
+ * Structural invariants (fields set, unique IDs, disjoint cores,
+ * acyclic dependencies) are _Static_asserts over the constants the
+ * table is built from. Load with domain_graph_validate_compiled(),
+ * which runs only the hardware-dependent checks.
+ *
+ * REQUIRES: domains/domain_contract.h included first
+ */
+
+#ifndef UCQCF_DOMAIN_LAYOUT_TABLE_H
+#define UCQCF_DOMAIN_LAYOUT_TABLE_H
+
+#ifndef UCQCF_DOMAIN_CONTRACT_H
+#error "include domains/domain_contract.h before the compiled layout"
+#endif
+
+#define DOMAIN_LAYOUT_COUNT 2u
+
+_Static_assert(CORE_SET_WORDS >= 1, "layout needs UCQCF_MAX_CPUS >= 64");
+
+/* Position 0: control */
+#define DOMAIN_LAYOUT_0_ID 0u
+#define DOMAIN_LAYOUT_0_RANK 0u
+#define DOMAIN_LAYOUT_0_SECURITY_LEVEL SECURITY_LEVEL_7
+#define DOMAIN_LAYOUT_0_PREEMPTION PREEMPTION_NEVER
+#define DOMAIN_LAYOUT_0_CACHE_ISOLATION CACHE_ISOLATION_L2
+#define DOMAIN_LAYOUT_0_MEMORY_TYPE MEMORY_DOMAIN_ISOLATED
+#define DOMAIN_LAYOUT_0_CORES_0 0x0000000000000004ULL
+
+/* Position 1: worker */
+#define DOMAIN_LAYOUT_1_ID 1u
+#define DOMAIN_LAYOUT_1_RANK 1u
+#define DOMAIN_LAYOUT_1_SECURITY_LEVEL SECURITY_LEVEL_3
+#define DOMAIN_LAYOUT_1_PREEMPTION PREEMPTION_BY_HIGHER
+#define DOMAIN_LAYOUT_1_CACHE_ISOLATION CACHE_ISOLATION_L2
+#define DOMAIN_LAYOUT_1_MEMORY_TYPE MEMORY_DOMAIN_SHARED_READ
+#define DOMAIN_LAYOUT_1_CORES_0 0x0000000000000050ULL
+
+static const security_domain_t domain_layout_table[DOMAIN_LAYOUT_COUNT] = {
+    {
+        .id = DOMAIN_LAYOUT_0_ID,
+        .name = "control",
+        .name_explicit = true,
+        .security_level = DOMAIN_LAYOUT_0_SECURITY_LEVEL,
+        .preemption = DOMAIN_LAYOUT_0_PREEMPTION,
+        .cores = {
+            .bitmap = { DOMAIN_LAYOUT_0_CORES_0 },
+            .words = 1,
+            .count = 1,
+            .explicit = true,
+        },
+        .cache_isolation = DOMAIN_LAYOUT_0_CACHE_ISOLATION,
+        .smt = SMT_POLICY_UNDEFINED,
+        .memory_type = DOMAIN_LAYOUT_0_MEMORY_TYPE,
+        .numa_local = true,
+        .numa_local_explicit = true,
+        .memory_tier = MEMORY_TIER_LOCAL,
+        .memory_tier_explicit = true,
+        .dependencies = {
+            .count = 0,
+            .explicit = true,
+        },
+    },
+    {
+        .id = DOMAIN_LAYOUT_1_ID,
+        .name = "worker",
+        .name_explicit = true,
+        .security_level = DOMAIN_LAYOUT_1_SECURITY_LEVEL,
+        .preemption = DOMAIN_LAYOUT_1_PREEMPTION,
+        .cores = {
+            .bitmap = { DOMAIN_LAYOUT_1_CORES_0 },
+            .words = 1,
+            .count = 2,
+            .explicit = true,
+        },
+        .cache_isolation = DOMAIN_LAYOUT_1_CACHE_ISOLATION,
+        .smt = SMT_POLICY_UNDEFINED,
+        .memory_type = DOMAIN_LAYOUT_1_MEMORY_TYPE,
+        .numa_local = true,
+        .numa_local_explicit = true,
+        .memory_tier = MEMORY_TIER_LOCAL,
+        .memory_tier_explicit = true,
+        .dependencies = {
+            .depends_on = { DOMAIN_LAYOUT_0_ID },
+            .count = 1,
+            .explicit = true,
+        },
+    },
+};
+
+/* Positions, dependencies first */
+static const uint8_t domain_layout_startup_order[DOMAIN_LAYOUT_COUNT] = { 0, 1 };
+
+/* Structural invariants */
+_Static_assert(DOMAIN_LAYOUT_0_ID != DOMAIN_ID_INVALID &&
+    DOMAIN_LAYOUT_0_SECURITY_LEVEL != SECURITY_LEVEL_UNDEFINED &&
+    DOMAIN_LAYOUT_0_PREEMPTION != PREEMPTION_UNDEFINED &&
+    DOMAIN_LAYOUT_0_CACHE_ISOLATION != CACHE_ISOLATION_UNDEFINED &&
+    DOMAIN_LAYOUT_0_MEMORY_TYPE != MEMORY_DOMAIN_UNDEFINED &&
+    (DOMAIN_LAYOUT_0_CORES_0) != 0,
+    "position 0: required field not set");
+_Static_assert(DOMAIN_LAYOUT_0_ID != DOMAIN_LAYOUT_1_ID, "positions 0 and 1: duplicate domain ID");
+_Static_assert(((DOMAIN_LAYOUT_0_CORES_0 & DOMAIN_LAYOUT_1_CORES_0)) == 0, "positions 0 and 1: cores overlap");
+_Static_assert(DOMAIN_LAYOUT_1_ID != DOMAIN_ID_INVALID &&
+    DOMAIN_LAYOUT_1_SECURITY_LEVEL != SECURITY_LEVEL_UNDEFINED &&
+    DOMAIN_LAYOUT_1_PREEMPTION != PREEMPTION_UNDEFINED &&
+    DOMAIN_LAYOUT_1_CACHE_ISOLATION != CACHE_ISOLATION_UNDEFINED &&
+    DOMAIN_LAYOUT_1_MEMORY_TYPE != MEMORY_DOMAIN_UNDEFINED &&
+    (DOMAIN_LAYOUT_1_CORES_0) != 0,
+    "position 1: required field not set");
+_Static_assert(DOMAIN_LAYOUT_0_RANK < DOMAIN_LAYOUT_1_RANK, "position 1 must start after its dependency at position 0");
+
+#endif /* UCQCF_DOMAIN_LAYOUT_TABLE_H */
@@ -0,0 +1,905 @@
+/**
+ * tests/config/test_domain_config.c
+ *
+ * Configuration layer tests
+ *
+ * PURPOSE:
+ *   Prove that the layout parser fills the graph exactly as the text
+ *   says and reports errors by line and column, and that the shipped
+ *   config/domain_layout.yaml validates on the topology it documents.
+ *   Prove that the offline placement solver produces layouts the
+ *   domain validator accepts on the machine they were placed for, that
+ *   refinement only makes moves that shorten dependency edges, and
+ *   that the emitted text says exactly what the graph holds. Prove
+ *   that a compiled layout loads to the same graph with only the
+ *   hardware checks left, and that a binary image loads back to the
+ *   same graph and refuses damaged input.
+ *
+ * APPROACH:
+ *   - Generate a small sealed machine (8 CPUs, SMT-2, 2 NUMA nodes)
+ *   - Build domain graphs the way a complete layout entry fills them
+ *   - Parse fixture_layout and malformed snippets; parse the shipped
+ *     layout and validate it against the topology it documents
+ *   - Place, emit, validate; check chosen cores and reported errors
+ *   - Refine a fixed graph and check the reported cost and moves
+ *   - Load compiled_layout_fixture.h (add_fixture_layout() compiled)
+ *     and compare it with the graph built here and with what the
+ *     compiler writes for that graph today
+ *   - Encode the parsed fixture, load it back, then damage the image
+ *   - Read a MAX_DOMAINS image from a file as boot does, then load it
+ */
+
+#include "../../topology/topology_contract.h"
+#include "../../domains/domain_contract.h"
+#include "../../config/config_contract.h"
+#include "../topology/topology_generator.h"
+#include "compiled_layout_fixture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Test result tracking */
+static uint32_t tests_run = 0;
+static uint32_t tests_passed = 0;
+static uint32_t tests_failed = 0;
+
+#define TEST(name) \
+    static void test_##name(void); \
+    static void run_test_##name(void) { \
+        printf("Running: %s ... ", #name); \
+        tests_run++; \
+        uint32_t failed_before = tests_failed; \
+        test_##name(); \
+        if (tests_failed == failed_before) { \
+            tests_passed++; \
+            printf("PASS\n"); \
+        } \
+    } \
+    static void test_##name(void)
+
+#define ASSERT(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL at %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            tests_failed++; \
+            return; \
+        } \
+    } while (0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NE(a, b) ASSERT((a) != (b))
+#define ASSERT_TRUE(x) ASSERT(x)
+#define ASSERT_FALSE(x) ASSERT(!(x))
+
+/* ========================================================================
+ * TEST FIXTURES
+ * ========================================================================
+ */
+
+static boot_facts_t     fixture_boot;
+static topology_state_t fixture_topology;
+static domain_graph_t   fixture_graph;
+static domain_graph_t   emitted_graph;
+
+/**
+ * Two sockets, one NUMA node each (distance 10 local, 21 remote), two
+ * SMT-2 physical cores per socket with private L1/L2 and one L3:
+ * CPUs 0-3 on node 0, 4-7 on node 1, siblings (0,1) (2,3) (4,5) (6,7).
+ * CPUs 0 and 1 are left to the kernel (not isolated).
+ */
+static bool seal_fixture(void) {
+    topology_gen_spec_t spec = {
+        .sockets               = 2,
+        .dies_per_socket       = 1,
+        .ccx_per_die           = 1,
+        .cores_per_ccx         = 2,
+        .threads_per_core      = 2,
+        .cores_per_l2          = 1,
+        .nodes_per_socket      = 1,
+        .local_distance        = 10,
+        .intra_socket_distance = 10,
+        .inter_socket_distance = 21,
+        .isolated              = true,
+    };
+
+    if (!topology_generate(&spec, &fixture_boot, &fixture_topology)) {
+        return false;
+    }
+
+    fixture_topology.cores[0].isolated = false;
+    fixture_topology.cores[1].isolated = false;
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+    return topology_validation_allows_boot(&ctx) && topology_seal(&fixture_topology);
+}
+
+/* Every field set, as a complete layout entry gives it; no cores yet */
+static security_domain_t fixture_domain(domain_id_t id, const char *name) {
+    security_domain_t domain;
+    memset(&domain, 0, sizeof(domain));
+
+    domain.id = id;
+    snprintf(domain.name, sizeof(domain.name), "%s", name);
+    domain.name_explicit = true;
+    domain.security_level = SECURITY_LEVEL_1;
+    domain.preemption = PREEMPTION_BY_ANY;
+    domain.cache_isolation = CACHE_ISOLATION_NONE;
+    domain.memory_type = MEMORY_DOMAIN_ISOLATED;
+    domain.numa_local = true;
+    domain.numa_local_explicit = true;
+    domain.memory_tier = MEMORY_TIER_LOCAL;
+    domain.memory_tier_explicit = true;
+
+    core_set_clear(&domain.cores);
+    dependency_set_clear(&domain.dependencies);
+    domain.dependencies.explicit = true;
+    return domain;
+}
+
+/* Request instead of cores: the solver must pick them */
+static security_domain_t fixture_request(
+    domain_id_t id,
+    const char *name,
+    uint32_t core_count,
+    smt_policy_t smt,
+    cache_isolation_t isolation
+) {
+    security_domain_t domain = fixture_domain(id, name);
+    domain.core_count = core_count;
+    domain.smt = smt;
+    domain.cache_isolation = isolation;
+    return domain;
+}
+
+/**
+ * Two domains, one per node: control on CPU 2, worker on CPUs 4 and 6
+ * depending on it. compiled_layout_fixture.h is this layout compiled.
+ */
+static bool add_fixture_layout(domain_graph_t *graph) {
+    security_domain_t control = fixture_domain(0, "control");
+    control.security_level = SECURITY_LEVEL_7;
+    control.preemption = PREEMPTION_NEVER;
+    control.cache_isolation = CACHE_ISOLATION_L2;
+    core_set_add(&control.cores, 2);
+
+    security_domain_t worker = fixture_domain(1, "worker");
+    worker.security_level = SECURITY_LEVEL_3;
+    worker.preemption = PREEMPTION_BY_HIGHER;
+    worker.cache_isolation = CACHE_ISOLATION_L2;
+    worker.memory_type = MEMORY_DOMAIN_SHARED_READ;
+    core_set_add(&worker.cores, 4);
+    core_set_add(&worker.cores, 6);
+    dependency_set_add(&worker.dependencies, 0);
+
+    return domain_graph_add(graph, &control) && domain_graph_add(graph, &worker);
+}
+
+/* add_fixture_layout() as layout text */
+static const char fixture_layout[] =
+    "# two domains, one per node\n"
+    "constraints:\n"
+    "  max_domains: 64\n"
+    "domains:\n"
+    "  - id: 0\n"
+    "    name: \"control\"\n"
+    "    security_level: 7  # highest\n"
+    "    preemption: never\n"
+    "    cores: [2]\n"
+    "    cache_isolation: l2\n"
+    "    memory_type: isolated\n"
+    "    numa_local: true\n"
+    "    memory_tier: local\n"
+    "    dependencies: []\n"
+    "  - id: 1\n"
+    "    name: worker\n"
+    "    security_level: 3\n"
+    "    preemption: by_higher\n"
+    "    cores: [4, 6]\n"
+    "    cache_isolation: l2\n"
+    "    memory_type: shared_read\n"
+    "    numa_local: true\n"
+    "    memory_tier: local\n"
+    "    dependencies: [0]\n";
+
+/* Checked-in files, read relative to the repository root */
+#define SHIPPED_LAYOUT_PATH  "config/domain_layout.yaml"
+#define COMPILED_HEADER_PATH "tests/config/compiled_layout_fixture.h"
+
+static char repo_file[16384];
+
+/* 0 if missing or not smaller than repo_file */
+static size_t read_repo_file(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return 0;
+    }
+
+    size_t length = fread(repo_file, 1, sizeof(repo_file), file);
+    fclose(file);
+    return length < sizeof(repo_file) ? length : 0;
+}
+
+/* ========================================================================
+ * PARSER TESTS
+ * ========================================================================
+ */
+
+TEST(layout_parses_to_fixture_layout) {
+    config_parse_status_t parse;
+    char parsed[1024], built[1024];
+
+    domain_graph_init(&fixture_graph, NULL, NULL);
+    ASSERT_TRUE(config_parse_domains(fixture_layout, sizeof(fixture_layout) - 1,
+                                     &fixture_graph, &parse));
+    ASSERT_EQ(parse.domain_count, 2);
+
+    const security_domain_t *worker = &fixture_graph.domains[1];
+    ASSERT_EQ(strcmp(worker->name, "worker"), 0);
+    ASSERT_EQ(worker->security_level, SECURITY_LEVEL_3);
+    ASSERT_EQ(worker->cores.count, 2);
+    ASSERT_TRUE(dependency_set_contains(&worker->dependencies, 0));
+
+    /* Same graph, same text */
+    domain_graph_init(&emitted_graph, NULL, NULL);
+    ASSERT_TRUE(add_fixture_layout(&emitted_graph));
+
+    size_t length = config_emit_domains(&fixture_graph, parsed, sizeof(parsed));
+    ASSERT_TRUE(length < sizeof(parsed));
+    ASSERT_EQ(config_emit_domains(&emitted_graph, built, sizeof(built)), length);
+    ASSERT_EQ(memcmp(parsed, built, length), 0);
+}
+
+TEST(layout_errors_carry_line_and_column) {
+    config_parse_status_t parse;
+    domain_graph_init(&fixture_graph, NULL, NULL);
+
+    static const char layout[] =
+        "domains:\n"
+        "  - id: 0\n"
+        "    cores: [1, x]\n";
+
+    ASSERT_FALSE(config_parse_domains(layout, sizeof(layout) - 1, &fixture_graph, &parse));
+    ASSERT_EQ(parse.error, CONFIG_ERROR_INVALID_VALUE);
+    ASSERT_EQ(parse.line, 3);
+    ASSERT_EQ(parse.column, 16);
+}
+
+TEST(layout_explicit_flags_follow_presence) {
+    config_parse_status_t parse;
+    domain_graph_init(&fixture_graph, NULL, NULL);
+
+    /* Second domain omits every optional field */
+    static const char layout[] =
+        "domains:\n"
+        "  - id: 0\n"
+        "    name: full\n"
+        "    cores: [2]\n"
+        "    numa_local: false\n"
+        "    memory_tier: far\n"
+        "    dependencies: []\n"
+        "  - id: 1\n";
+
+    ASSERT_TRUE(config_parse_domains(layout, sizeof(layout) - 1, &fixture_graph, &parse));
+    ASSERT_EQ(parse.domain_count, 2);
+
+    const security_domain_t *full = &fixture_graph.domains[0];
+    ASSERT_TRUE(full->name_explicit);
+    ASSERT_TRUE(full->cores.explicit);
+    ASSERT_TRUE(full->numa_local_explicit);
+    ASSERT_FALSE(full->numa_local);
+    ASSERT_TRUE(full->memory_tier_explicit);
+    ASSERT_TRUE(full->dependencies.explicit);
+    ASSERT_EQ(full->dependencies.count, 0);
+
+    const security_domain_t *bare = &fixture_graph.domains[1];
+    ASSERT_FALSE(bare->name_explicit);
+    ASSERT_FALSE(bare->cores.explicit);
+    ASSERT_FALSE(bare->numa_local_explicit);
+    ASSERT_FALSE(bare->memory_tier_explicit);
+    ASSERT_FALSE(bare->dependencies.explicit);
+    ASSERT_EQ(bare->security_level, SECURITY_LEVEL_UNDEFINED);
+}
+
+TEST(layout_rejects_duplicate_key_and_tab_indent) {
+    config_parse_status_t parse;
+    domain_graph_init(&fixture_graph, NULL, NULL);
+
+    static const char duplicate[] =
+        "domains:\n"
+        "  - id: 0\n"
+        "    cores: [1]\n"
+        "    # comment lines still count\n"
+        "    cores: [2]\n";
+
+    ASSERT_FALSE(config_parse_domains(duplicate, sizeof(duplicate) - 1,
+                                      &fixture_graph, &parse));
+    ASSERT_EQ(parse.error, CONFIG_ERROR_DUPLICATE_KEY);
+    ASSERT_EQ(parse.line, 5);
+    ASSERT_EQ(parse.column, 5);
+
+    static const char tab[] =
+        "domains:\n"
+        "  - id: 0\n"
+        "  \tcores: [1]\n";
+
+    domain_graph_init(&fixture_graph, NULL, NULL);
+    ASSERT_FALSE(config_parse_domains(tab, sizeof(tab) - 1, &fixture_graph, &parse));
+    ASSERT_EQ(parse.error, CONFIG_ERROR_SYNTAX);
+    ASSERT_EQ(parse.line, 3);
+    ASSERT_EQ(parse.column, 3);
+}
+
+TEST(layout_rejects_domain_past_max_domains) {
+    static char layout[(MAX_DOMAINS + 1) * 16 + 16];
+    config_parse_status_t parse;
+    size_t length = (size_t)snprintf(layout, sizeof(layout), "domains:\n");
+
+    for (uint32_t i = 0; i <= MAX_DOMAINS; i++) {
+        length += (size_t)snprintf(layout + length, sizeof(layout) - length,
+                                   "  - id: %u\n", i);
+    }
+
+    domain_graph_init(&fixture_graph, NULL, NULL);
+    ASSERT_FALSE(config_parse_domains(layout, length, &fixture_graph, &parse));
+    ASSERT_EQ(parse.error, CONFIG_ERROR_TOO_MANY_DOMAINS);
+    ASSERT_EQ(parse.line, MAX_DOMAINS + 2);
+    ASSERT_EQ(parse.column, 3);
+    ASSERT_EQ(fixture_graph.domain_count, MAX_DOMAINS);
+}
+
+/* ========================================================================
+ * SHIPPED LAYOUT TESTS
+ * ========================================================================
+ */
+
+TEST(shipped_layout_passes_structure_validation) {
+    config_parse_status_t parse;
+    validation_context_t ctx;
+    size_t length = read_repo_file(SHIPPED_LAYOUT_PATH);
+    ASSERT_NE(length, 0);
+
+    /* Boot's loader takes it in a buffer of exactly its size */
+    size_t loaded;
+    ASSERT_EQ(config_read_file(SHIPPED_LAYOUT_PATH, repo_file, length, &loaded),
+              CONFIG_FILE_OK);
+    ASSERT_EQ(loaded, length);
+
+    domain_graph_init(&fixture_graph, NULL, NULL);
+    ASSERT_TRUE(config_parse_domains(repo_file, length, &fixture_graph, &parse));
+    ASSERT_EQ(parse.domain_count, 8);
+    ASSERT_NE(domain_graph_validate_structure(&fixture_graph, &ctx), VALIDATION_HARD_FAIL);
+}
+
+/* The layout's EXPECTED TOPOLOGY: 2 nodes x 8 cores, cores paired on L2 */
+TEST(shipped_layout_validates_on_documented_topology) {
+    config_parse_status_t parse;
+    validation_context_t ctx;
+    topology_validation_context_t topo_ctx;
+    size_t length = read_repo_file(SHIPPED_LAYOUT_PATH);
+    ASSERT_NE(length, 0);
+
+    topology_gen_spec_t spec = topology_gen_preset(TOPOLOGY_GEN_TOY_16);
+    spec.isolated = true;
+    ASSERT_TRUE(topology_generate(&spec, &fixture_boot, &fixture_topology));
+    topology_validate(&fixture_topology, &topo_ctx);
+    ASSERT_TRUE(topology_validation_allows_boot(&topo_ctx));
+    ASSERT_TRUE(topology_seal(&fixture_topology));
+
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+    ASSERT_TRUE(config_parse_domains(repo_file, length, &fixture_graph, &parse));
+    ASSERT_NE(domain_graph_validate(&fixture_graph, &ctx), VALIDATION_HARD_FAIL);
+}
+
+/* ========================================================================
+ * PLACEMENT TESTS
+ * ========================================================================
+ */
+
+TEST(placement_emits_layout_that_validates) {
+    placement_status_t status;
+    config_parse_status_t parse;
+    validation_context_t ctx = { 0 };
+
+    ASSERT_TRUE(seal_fixture());
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+
+    /* CPU 0 is fixed; both requests need two physical cores on one node */
+    security_domain_t housekeeping = fixture_domain(0, "housekeeping");
+    housekeeping.security_level = SECURITY_LEVEL_0;
+    housekeeping.memory_type = MEMORY_DOMAIN_SHARED_READ;
+    housekeeping.numa_local = false;
+    core_set_add(&housekeeping.cores, 0);
+
+    security_domain_t worker = fixture_request(1, "worker", 2, SMT_POLICY_SHARED,
+                                               CACHE_ISOLATION_L2);
+    worker.security_level = SECURITY_LEVEL_3;
+    worker.preemption = PREEMPTION_BY_HIGHER;
+    dependency_set_add(&worker.dependencies, 0);
+
+    security_domain_t crypto = fixture_request(2, "crypto", 2, SMT_POLICY_EXCLUSIVE,
+                                               CACHE_ISOLATION_L2);
+    crypto.security_level = SECURITY_LEVEL_7;
+    crypto.preemption = PREEMPTION_NEVER;
+
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &housekeeping));
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &worker));
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &crypto));
+
+    ASSERT_TRUE(config_place_domains(&fixture_graph, &fixture_topology, &status));
+    ASSERT_EQ(status.placed, 2);
+
+    /* Exclusive goes first and takes the node with no fixed core */
+    const security_domain_t *placed = &fixture_graph.domains[2];
+    ASSERT_TRUE(placed->cores.explicit);
+    ASSERT_EQ(placed->core_count, 0);
+    ASSERT_EQ(placed->cores.count, 2);
+    ASSERT_TRUE(core_set_contains(&placed->cores, 4));
+    ASSERT_TRUE(core_set_contains(&placed->cores, 6));
+
+    /* Worker shares CPU 0's node but not CPU 0 */
+    placed = &fixture_graph.domains[1];
+    ASSERT_EQ(placed->cores.count, 2);
+    ASSERT_FALSE(core_set_contains(&placed->cores, 0));
+    ASSERT_TRUE(core_set_contains(&placed->cores, 2) ||
+                core_set_contains(&placed->cores, 3));
+
+    char text[2048];
+    size_t length = config_emit_domains(&fixture_graph, text, sizeof(text));
+    ASSERT_TRUE(length < sizeof(text));
+    ASSERT_EQ(config_emit_domains(&fixture_graph, NULL, 0), length);
+    ASSERT_EQ(strstr(text, "core_count"), NULL);
+    ASSERT_NE(strstr(text, "  - id: 2\n    name: \"crypto\"\n    security_level: 7\n"
+                           "    preemption: never\n    cores: [4, 6]\n"), NULL);
+
+    domain_graph_init(&emitted_graph, &fixture_boot, &fixture_topology);
+    ASSERT_TRUE(config_parse_domains(text, length, &emitted_graph, &parse));
+    ASSERT_EQ(parse.domain_count, 3);
+    ASSERT_EQ(domain_graph_validate(&emitted_graph, &ctx), VALIDATION_ACCEPT);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        const core_set_t *a = &emitted_graph.domains[i].cores;
+        const core_set_t *b = &fixture_graph.domains[i].cores;
+        ASSERT_TRUE(core_set_is_subset(a, b) && core_set_is_subset(b, a));
+    }
+}
+
+TEST(placement_reports_unsatisfiable_domain) {
+    placement_status_t status;
+
+    ASSERT_TRUE(seal_fixture());
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+
+    /* Each node has only two physical cores */
+    security_domain_t request = fixture_request(5, "wide", 3, SMT_POLICY_SHARED,
+                                                CACHE_ISOLATION_L2);
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &request));
+
+    ASSERT_FALSE(config_place_domains(&fixture_graph, &fixture_topology, &status));
+    ASSERT_EQ(status.error, PLACEMENT_ERROR_UNSATISFIABLE);
+    ASSERT_EQ(status.domain, 5);
+}
+
+TEST(placement_rejects_malformed_requests) {
+    placement_status_t status;
+
+    ASSERT_TRUE(seal_fixture());
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+
+    security_domain_t conflict = fixture_request(1, "conflict", 1, SMT_POLICY_SHARED,
+                                                 CACHE_ISOLATION_NONE);
+    core_set_add(&conflict.cores, 2);
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &conflict));
+
+    ASSERT_FALSE(config_place_domains(&fixture_graph, &fixture_topology, &status));
+    ASSERT_EQ(status.error, PLACEMENT_ERROR_REQUEST_CONFLICT);
+    ASSERT_EQ(status.domain, 1);
+
+    /* No smt policy: the solver cannot tell whether siblings are free */
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+
+    security_domain_t incomplete = fixture_request(2, "incomplete", 1,
+                                                   SMT_POLICY_UNDEFINED,
+                                                   CACHE_ISOLATION_NONE);
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &incomplete));
+
+    ASSERT_FALSE(config_place_domains(&fixture_graph, &fixture_topology, &status));
+    ASSERT_EQ(status.error, PLACEMENT_ERROR_REQUEST_INCOMPLETE);
+    ASSERT_EQ(status.domain, 2);
+}
+
+/* CPU 2 fixed (domain 0), CPUs 0-1 fixed (domain 3); CPU 6 (domain 1)
+ * depends on domain 0 across nodes, CPU 3 (domain 2) has no edges */
+static bool refine_fixture(smt_policy_t domain0_smt, placement_refinement_t *refine) {
+    if (!seal_fixture()) {
+        return false;
+    }
+
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+
+    security_domain_t domains[4] = {
+        fixture_domain(0, "fixed"),
+        fixture_domain(1, "dependent"),
+        fixture_domain(2, "bystander"),
+        fixture_domain(3, "housekeeping"),
+    };
+
+    core_set_add(&domains[0].cores, 2);
+    domains[0].smt = domain0_smt;
+    core_set_add(&domains[1].cores, 6);
+    domains[1].smt = SMT_POLICY_SHARED;
+    dependency_set_add(&domains[1].dependencies, 0);
+    core_set_add(&domains[2].cores, 3);
+    domains[2].smt = SMT_POLICY_SHARED;
+    core_set_from_range(&domains[3].cores, 0, 2);
+
+    for (uint32_t i = 0; i < 4; i++) {
+        if (!domain_graph_add(&fixture_graph, &domains[i])) {
+            return false;
+        }
+    }
+
+    return config_refine_placement(&fixture_graph, &fixture_topology,
+                                   (1ULL << 1) | (1ULL << 2), refine);
+}
+
+TEST(refinement_swaps_dependent_onto_near_node) {
+    placement_refinement_t refine;
+
+    ASSERT_TRUE(refine_fixture(SMT_POLICY_SHARED, &refine));
+    ASSERT_FALSE(refine.latency_measured);
+    ASSERT_EQ(refine.edge_count, 1);
+    ASSERT_EQ(refine.cost_before, 21000);
+    ASSERT_EQ(refine.cost_after, 10000);
+
+    /* Node 0 is full of fixed cores: only a swap with domain 2 helps */
+    ASSERT_EQ(refine.swap_count, 1);
+    ASSERT_EQ(refine.swaps[0].domain, 1);
+    ASSERT_EQ(refine.swaps[0].from, 6);
+    ASSERT_EQ(refine.swaps[0].to, 3);
+    ASSERT_EQ(refine.swaps[0].other, 2);
+    ASSERT_TRUE(core_set_contains(&fixture_graph.domains[1].cores, 3));
+    ASSERT_TRUE(core_set_contains(&fixture_graph.domains[2].cores, 6));
+}
+
+TEST(refinement_keeps_exclusive_smt_sibling_idle) {
+    placement_refinement_t refine;
+
+    /* CPU 3 is CPU 2's sibling: an exclusive domain 0 rules it out */
+    ASSERT_TRUE(refine_fixture(SMT_POLICY_EXCLUSIVE, &refine));
+    ASSERT_EQ(refine.swap_count, 0);
+    ASSERT_EQ(refine.cost_after, refine.cost_before);
+    ASSERT_TRUE(core_set_contains(&fixture_graph.domains[1].cores, 6));
+}
+
+TEST(refinement_leaves_housekeeping_cores_alone) {
+    placement_refinement_t refine;
+
+    ASSERT_TRUE(seal_fixture());
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+
+    /* Only free cores on node 0 are CPUs 0 and 1, both housekeeping */
+    security_domain_t fixed = fixture_domain(0, "fixed");
+    core_set_add(&fixed.cores, 2);
+    fixed.smt = SMT_POLICY_EXCLUSIVE;
+
+    security_domain_t dependent = fixture_domain(1, "dependent");
+    core_set_add(&dependent.cores, 6);
+    dependent.smt = SMT_POLICY_SHARED;
+    dependency_set_add(&dependent.dependencies, 0);
+
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &fixed));
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &dependent));
+
+    ASSERT_TRUE(config_refine_placement(&fixture_graph, &fixture_topology,
+                                        1ULL << 1, &refine));
+    ASSERT_EQ(refine.swap_count, 0);
+    ASSERT_EQ(refine.cost_after, refine.cost_before);
+    ASSERT_TRUE(core_set_contains(&fixture_graph.domains[1].cores, 6));
+}
+
+/* ========================================================================
+ * COMPILED LAYOUT TESTS
+ * ========================================================================
+ */
+
+TEST(compiled_layout_matches_fixture_layout) {
+    validation_context_t ctx = { 0 };
+
+    ASSERT_TRUE(seal_fixture());
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+    ASSERT_TRUE(add_fixture_layout(&fixture_graph));
+    ASSERT_NE(domain_graph_validate_structure(&fixture_graph, &ctx), VALIDATION_HARD_FAIL);
+
+    /* Dependency order is proven in the header, not re-derived at boot */
+    static char text[8192];
+    size_t length = config_compile_domains(&fixture_graph,
+                                           "add_fixture_layout() in\n"
+                                           " * tests/config/test_domain_config.c",
+                                           text, sizeof(text));
+    ASSERT_TRUE(length < sizeof(text));
+    ASSERT_NE(strstr(text, "_Static_assert(DOMAIN_LAYOUT_0_RANK < DOMAIN_LAYOUT_1_RANK"),
+              NULL);
+
+    /* The checked-in header is exactly what the compiler writes today */
+    ASSERT_EQ(read_repo_file(COMPILED_HEADER_PATH), length);
+    ASSERT_EQ(memcmp(repo_file, text, length), 0);
+
+    domain_graph_init(&emitted_graph, &fixture_boot, &fixture_topology);
+    ASSERT_EQ(domain_graph_validate_compiled(&emitted_graph, domain_layout_table,
+                                             DOMAIN_LAYOUT_COUNT,
+                                             domain_layout_startup_order, &ctx),
+              VALIDATION_ACCEPT);
+    ASSERT_EQ(emitted_graph.domain_count, fixture_graph.domain_count);
+
+    for (uint32_t i = 0; i < DOMAIN_LAYOUT_COUNT; i++) {
+        const security_domain_t *a = &emitted_graph.domains[i];
+        const security_domain_t *b = &fixture_graph.domains[i];
+        ASSERT_EQ(a->id, b->id);
+        ASSERT_EQ(strcmp(a->name, b->name), 0);
+        ASSERT_EQ(a->security_level, b->security_level);
+        ASSERT_EQ(a->cache_isolation, b->cache_isolation);
+        ASSERT_TRUE(core_set_is_subset(&a->cores, &b->cores) &&
+                    core_set_is_subset(&b->cores, &a->cores));
+        ASSERT_EQ(a->dependencies.count, b->dependencies.count);
+        ASSERT_EQ(emitted_graph.startup_order[i], fixture_graph.startup_order[i]);
+    }
+
+    ASSERT_TRUE(domain_graph_seal(&emitted_graph));
+    ASSERT_TRUE(domain_graph_can_access(&emitted_graph, 1, 0));
+}
+
+TEST(compiled_layout_escapes_names) {
+    validation_context_t ctx = { 0 };
+
+    domain_graph_init(&fixture_graph, NULL, NULL);
+    security_domain_t domain = fixture_domain(0, "a*/b\"c\\");
+    core_set_add(&domain.cores, 2);
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &domain));
+    ASSERT_NE(domain_graph_validate_structure(&fixture_graph, &ctx), VALIDATION_HARD_FAIL);
+
+    static char text[8192];
+    size_t length = config_compile_domains(&fixture_graph, "names", text, sizeof(text));
+    ASSERT_TRUE(length < sizeof(text));
+    ASSERT_NE(strstr(text, "/* Position 0: a* /b\"c\\ */\n"), NULL);
+    ASSERT_NE(strstr(text, ".name = \"a*/b\\\"c\\\\\",\n"), NULL);
+    ASSERT_NE(strstr(text, " };\n\n/* Structural invariants */\n"), NULL);
+}
+
+TEST(compiled_layout_still_checks_hardware) {
+    validation_context_t ctx = { 0 };
+
+    ASSERT_TRUE(seal_fixture());
+
+    /* Structurally fine, but CPUs 4 and 5 share L1/L2 on this machine */
+    security_domain_t table[DOMAIN_LAYOUT_COUNT];
+    memcpy(table, domain_layout_table, sizeof(table));
+    core_set_add(&table[1].cores, 5);
+
+    domain_graph_init(&emitted_graph, &fixture_boot, &fixture_topology);
+    ASSERT_EQ(domain_graph_validate_compiled(&emitted_graph, table, DOMAIN_LAYOUT_COUNT,
+                                             domain_layout_startup_order, &ctx),
+              VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_CACHE_ISOLATION_UNSATISFIABLE);
+    ASSERT_FALSE(domain_graph_seal(&emitted_graph));
+}
+
+TEST(structure_validation_rejects_overlap_without_hardware) {
+    validation_context_t ctx = { 0 };
+
+    security_domain_t a = fixture_domain(0, "a");
+    core_set_add(&a.cores, 0);
+
+    security_domain_t b = fixture_domain(1, "b");
+    core_set_from_range(&b.cores, 0, 2);
+
+    /* Build time: no boot facts, no topology */
+    domain_graph_init(&fixture_graph, NULL, NULL);
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &a));
+    ASSERT_TRUE(domain_graph_add(&fixture_graph, &b));
+
+    ASSERT_EQ(domain_graph_validate_structure(&fixture_graph, &ctx), VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.error_count, 1);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_CORES_OVERLAP);
+    ASSERT_FALSE(fixture_graph.validated);
+}
+
+/* ========================================================================
+ * BINARY IMAGE TESTS
+ * ========================================================================
+ */
+
+static uint8_t binary_image[CONFIG_BINARY_MAX_SIZE];
+
+/* Parse fixture_layout and encode it into binary_image */
+static size_t encode_fixture(void) {
+    config_parse_status_t parse;
+    config_binary_status_t binary;
+
+    if (!seal_fixture()) {
+        return 0;
+    }
+
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+    if (!config_parse_domains(fixture_layout, sizeof(fixture_layout) - 1,
+                              &fixture_graph, &parse)) {
+        return 0;
+    }
+
+    return config_binary_encode(&fixture_graph, binary_image, sizeof(binary_image),
+                                &binary);
+}
+
+TEST(binary_image_round_trips_parsed_layout) {
+    config_binary_status_t binary;
+    validation_context_t ctx;
+    size_t size = encode_fixture();
+
+    ASSERT_EQ(size, sizeof(config_binary_header_t) + 2 * sizeof(config_binary_record_t));
+
+    domain_graph_init(&emitted_graph, &fixture_boot, &fixture_topology);
+    ASSERT_TRUE(config_binary_load(binary_image, size, &emitted_graph, &binary));
+    ASSERT_EQ(emitted_graph.domain_count, 2);
+
+    /* Both sides were zeroed before filling, so whole records compare */
+    for (uint32_t i = 0; i < emitted_graph.domain_count; i++) {
+        ASSERT_EQ(memcmp(&emitted_graph.domains[i], &fixture_graph.domains[i],
+                         sizeof(security_domain_t)), 0);
+    }
+
+    /* Same graph, same bytes */
+    static uint8_t again[CONFIG_BINARY_MAX_SIZE];
+    ASSERT_EQ(config_binary_encode(&emitted_graph, again, sizeof(again), &binary), size);
+    ASSERT_EQ(memcmp(again, binary_image, size), 0);
+
+    ASSERT_NE(domain_graph_validate(&emitted_graph, &ctx), VALIDATION_HARD_FAIL);
+    ASSERT_TRUE(domain_graph_seal(&emitted_graph));
+    ASSERT_TRUE(domain_graph_can_access(&emitted_graph, 1, 0));
+}
+
+TEST(binary_image_rejects_damage) {
+    config_binary_status_t binary;
+    size_t size = encode_fixture();
+    size_t record1 = sizeof(config_binary_header_t) + sizeof(config_binary_record_t);
+    size_t level = record1 + offsetof(config_binary_record_t, security_level);
+    ASSERT_NE(size, 0);
+
+    domain_graph_init(&emitted_graph, &fixture_boot, &fixture_topology);
+    ASSERT_FALSE(config_binary_load(binary_image, size - 1, &emitted_graph, &binary));
+    ASSERT_EQ(binary.error, CONFIG_BINARY_ERROR_SIZE);
+
+    binary_image[level] ^= 1;
+    ASSERT_FALSE(config_binary_load(binary_image, size, &emitted_graph, &binary));
+    ASSERT_EQ(binary.error, CONFIG_BINARY_ERROR_CHECKSUM);
+
+    /* Consistent checksum, out-of-range field: caught per record */
+    binary_image[level] = SECURITY_LEVEL_MAX + 1;
+    uint32_t checksum = config_binary_checksum(binary_image, size);
+    memcpy(binary_image + offsetof(config_binary_header_t, checksum), &checksum,
+           sizeof(checksum));
+    ASSERT_FALSE(config_binary_load(binary_image, size, &emitted_graph, &binary));
+    ASSERT_EQ(binary.error, CONFIG_BINARY_ERROR_INVALID_RECORD);
+    ASSERT_EQ(binary.record, 1);
+    ASSERT_EQ(emitted_graph.domain_count, 0);
+
+    binary_image[offsetof(config_binary_header_t, version)] = CONFIG_BINARY_VERSION + 1;
+    ASSERT_FALSE(config_binary_load(binary_image, size, &emitted_graph, &binary));
+    ASSERT_EQ(binary.error, CONFIG_BINARY_ERROR_VERSION);
+
+    binary_image[0] = 'X';
+    ASSERT_FALSE(config_binary_load(binary_image, size, &emitted_graph, &binary));
+    ASSERT_EQ(binary.error, CONFIG_BINARY_ERROR_MAGIC);
+}
+
+TEST(binary_encode_rejects_unresolved_dependency) {
+    config_binary_status_t binary;
+    ASSERT_NE(encode_fixture(), 0);
+
+    fixture_graph.domains[1].dependencies.depends_on[0] = 42;
+    ASSERT_EQ(config_binary_encode(&fixture_graph, NULL, 0, &binary), 0);
+    ASSERT_EQ(binary.error, CONFIG_BINARY_ERROR_UNRESOLVED_DEPENDENCY);
+    ASSERT_EQ(binary.record, 1);
+}
+
+/* Boot's path for the largest image: file -> fixed buffer -> graph */
+TEST(binary_image_at_max_domains_loads_from_file) {
+    config_binary_status_t binary;
+    validation_context_t ctx;
+
+    domain_graph_init(&fixture_graph, NULL, NULL);
+    for (uint32_t i = 0; i < MAX_DOMAINS; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "domain_%u", i);
+        security_domain_t domain = fixture_domain(i, name);
+        core_set_add(&domain.cores, i);
+        ASSERT_TRUE(domain_graph_add(&fixture_graph, &domain));
+    }
+    ASSERT_NE(domain_graph_validate_structure(&fixture_graph, &ctx), VALIDATION_HARD_FAIL);
+
+    size_t size = config_binary_encode(&fixture_graph, binary_image,
+                                       sizeof(binary_image), &binary);
+    ASSERT_EQ(size, CONFIG_BINARY_MAX_SIZE);
+
+    char path[] = "/tmp/ucqcf_image_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_TRUE(fd >= 0);
+    ASSERT_EQ(write(fd, binary_image, size), (ssize_t)size);
+    close(fd);
+
+    /* Exactly fills the buffer: EOF is not set, the file still fits */
+    static uint8_t buffer[CONFIG_BINARY_MAX_SIZE];
+    size_t loaded;
+    ASSERT_EQ(config_read_file(path, buffer, sizeof(buffer), &loaded), CONFIG_FILE_OK);
+    ASSERT_EQ(loaded, CONFIG_BINARY_MAX_SIZE);
+
+    domain_graph_init(&emitted_graph, NULL, NULL);
+    ASSERT_TRUE(config_binary_load(buffer, loaded, &emitted_graph, &binary));
+    ASSERT_EQ(emitted_graph.domain_count, MAX_DOMAINS);
+
+    /* One byte short of the file is too small */
+    ASSERT_EQ(config_read_file(path, buffer, sizeof(buffer) - 1, &loaded),
+              CONFIG_FILE_ERROR_TOO_LARGE);
+    ASSERT_EQ(loaded, 0);
+    unlink(path);
+
+    ASSERT_EQ(config_read_file(path, buffer, sizeof(buffer), &loaded),
+              CONFIG_FILE_ERROR_OPEN);
+}
+
+/* ========================================================================
+ * TEST RUNNER
+ * ========================================================================
+ */
+
+int main(void) {
+    printf("=================================================\n");
+    printf("UCQCF Phase-1 Configuration Tests\n");
+    printf("=================================================\n\n");
+
+    /* Parser tests */
+    run_test_layout_parses_to_fixture_layout();
+    run_test_layout_errors_carry_line_and_column();
+    run_test_layout_explicit_flags_follow_presence();
+    run_test_layout_rejects_duplicate_key_and_tab_indent();
+    run_test_layout_rejects_domain_past_max_domains();
+
+    /* Shipped layout tests */
+    run_test_shipped_layout_passes_structure_validation();
+    run_test_shipped_layout_validates_on_documented_topology();
+
+    /* Placement tests */
+    run_test_placement_emits_layout_that_validates();
+    run_test_placement_reports_unsatisfiable_domain();
+    run_test_placement_rejects_malformed_requests();
+    run_test_refinement_swaps_dependent_onto_near_node();
+    run_test_refinement_keeps_exclusive_smt_sibling_idle();
+    run_test_refinement_leaves_housekeeping_cores_alone();
+
+    /* Compiled layout tests */
+    run_test_compiled_layout_matches_fixture_layout();
+    run_test_compiled_layout_escapes_names();
+    run_test_compiled_layout_still_checks_hardware();
+    run_test_structure_validation_rejects_overlap_without_hardware();
+
+    /* Binary image tests */
+    run_test_binary_image_round_trips_parsed_layout();
+    run_test_binary_image_rejects_damage();
+    run_test_binary_encode_rejects_unresolved_dependency();
+    run_test_binary_image_at_max_domains_loads_from_file();
+
+    /* Summary */
+    printf("\n=================================================\n");
+    printf("Tests run:    %u\n", tests_run);
+    printf("Tests passed: %u\n", tests_passed);
+    printf("Tests failed: %u\n", tests_failed);
+    printf("=================================================\n");
+
+    if (tests_failed == 0) {
+        printf("✓ ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("✗ SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -19,6 +19,7 @@
 #include "../../domains/domain_contract.h"
 #include "../../boot/boot_contract.h"
 #include "../../topology/topology_contract.h"
+#include "../topology/topology_generator.h"
 #include <stdio.h>
 #include <assert.h>
 #include <string.h>
@@ -67,25 +68,63 @@ static boot_facts_t create_test_boot_facts(void) {
     return facts;
 }
 
-static topology_state_t create_test_topology(void) {
-    topology_state_t topology = {0};
-    topology.core_count = 16;
-    topology.numa_node_count = 2;
+/* Topology is large; keep fixtures out of the test stack frames */
+static boot_facts_t     fixture_boot;
+static topology_state_t fixture_topology;
+
+/**
+ * 16 cores, 2 NUMA nodes (0-7, 8-15)
+ * L1 private, L2 shared by pairs, L3 shared by groups of 8
+ * 
+ * Probed only: tests may reshape cache domains before sealing.
+ */
+static topology_state_t* create_test_topology(void) {
+    topology_state_t *topology = &fixture_topology;
+    fixture_boot = create_test_boot_facts();
+    
+    topology_init(topology, &fixture_boot);
+    topology_probe_all_cores(topology);
+    topology->numa_node_count = 2;
     
-    /* Initialize core geometries */
     for (uint32_t i = 0; i < 16; i++) {
-        core_geometry_t *geom = &topology.cores[i];
-        geom->physical_core = i;
+        core_geometry_t *geom = &topology->cores[i];
         geom->l1_domain = i;  /* Private L1 */
         geom->l2_domain = i / 2;  /* Shared by pairs */
         geom->l3_domain = i / 8;  /* Shared by groups of 8 */
         geom->numa_node = i / 8;  /* Two NUMA nodes */
-        geom->isolated = false;
+        geom->numa_distance[0] = (i / 8 == 0) ? 10 : 20;
+        geom->numa_distance[1] = (i / 8 == 1) ? 10 : 20;
+        geom->cache_hierarchy.level_count = 3;
+        geom->isolated = true;
+        geom->freq_scaling_disabled = true;
+        geom->supports_constant_time = true;
+    }
+    
+    for (uint32_t n = 0; n < 2; n++) {
+        topology->numa_nodes[n].id = n;
+        topology->numa_nodes[n].distance[0] = (n == 0) ? 10 : 20;
+        topology->numa_nodes[n].distance[1] = (n == 1) ? 10 : 20;
+    }
+    
+    return topology;
+}
+
+/* Validate and seal, as phase-1 does before loading domains */
+static topology_state_t* seal_test_topology(topology_state_t *topology) {
+    topology_validation_context_t ctx;
+    
+    topology_validate(topology, &ctx);
+    if (!topology_validation_allows_boot(&ctx) || !topology_seal(topology)) {
+        return NULL;
     }
     
     return topology;
 }
 
+static topology_state_t* create_sealed_test_topology(void) {
+    return seal_test_topology(create_test_topology());
+}
+
 static security_domain_t create_valid_domain(void) {
     security_domain_t domain = {0};
     
@@ -96,9 +135,10 @@ static security_domain_t create_valid_domain(void) {
     domain.security_level = SECURITY_LEVEL_4;
     domain.preemption = PREEMPTION_BY_HIGHER;
     
+    /* Cores 0 and 2: private L1 and L2, same NUMA node */
     core_set_clear(&domain.cores);
     core_set_add(&domain.cores, 0);
-    core_set_add(&domain.cores, 1);
+    core_set_add(&domain.cores, 2);
     
     domain.cache_isolation = CACHE_ISOLATION_L2;
     domain.memory_type = MEMORY_DOMAIN_ISOLATED;
@@ -117,10 +157,11 @@ static security_domain_t create_valid_domain(void) {
 
 TEST(field_validation_accepts_complete_domain) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     security_domain_t domain = create_valid_domain();
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_fields(&domain, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
@@ -131,7 +172,7 @@ TEST(field_validation_rejects_undefined_security_level) {
     security_domain_t domain = create_valid_domain();
     domain.security_level = SECURITY_LEVEL_UNDEFINED;
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_fields(&domain, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -143,7 +184,7 @@ TEST(field_validation_rejects_undefined_preemption) {
     security_domain_t domain = create_valid_domain();
     domain.preemption = PREEMPTION_UNDEFINED;
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_fields(&domain, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -155,7 +196,7 @@ TEST(field_validation_rejects_empty_name) {
     domain.name[0] = '\0';
     domain.name_explicit = false;
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_fields(&domain, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -164,8 +205,9 @@ TEST(field_validation_rejects_empty_name) {
 TEST(field_validation_rejects_empty_core_set) {
     security_domain_t domain = create_valid_domain();
     core_set_clear(&domain.cores);
+    domain.cores.explicit = true;  /* Explicitly empty, not unset */
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_fields(&domain, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -176,7 +218,7 @@ TEST(field_validation_rejects_undefined_cache_isolation) {
     security_domain_t domain = create_valid_domain();
     domain.cache_isolation = CACHE_ISOLATION_UNDEFINED;
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_fields(&domain, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -186,12 +228,215 @@ TEST(field_validation_rejects_undefined_memory_type) {
     security_domain_t domain = create_valid_domain();
     domain.memory_type = MEMORY_DOMAIN_UNDEFINED;
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_fields(&domain, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
 }
 
+/* ========================================================================
+ * CORE SET TESTS
+ * ========================================================================
+ */
+
+TEST(core_set_tracks_used_words) {
+    core_set_t set;
+    core_set_clear(&set);
+    
+    ASSERT_EQ(set.words, 0);
+    ASSERT_TRUE(core_set_is_empty(&set));
+    
+    core_set_add(&set, 3);
+    ASSERT_EQ(set.words, 1);
+    
+    core_set_add(&set, MAX_DOMAIN_CORES - 1);
+    ASSERT_EQ(set.words, CORE_SET_WORDS);
+    ASSERT_TRUE(core_set_contains(&set, MAX_DOMAIN_CORES - 1));
+    ASSERT_FALSE(core_set_contains(&set, MAX_DOMAIN_CORES));
+}
+
+TEST(core_set_count_ignores_duplicates) {
+    core_set_t set;
+    core_set_clear(&set);
+    
+    core_set_add(&set, 7);
+    core_set_add(&set, 7);
+    core_set_add(&set, 70);
+    
+    ASSERT_EQ(set.count, 2);
+}
+
+TEST(core_set_overlap_uses_narrower_set) {
+    core_set_t narrow, wide;
+    core_set_clear(&narrow);
+    core_set_clear(&wide);
+    
+    core_set_add(&narrow, 1);
+    core_set_add(&wide, 2);
+    core_set_add(&wide, MAX_DOMAIN_CORES - 1);
+    ASSERT_FALSE(core_set_overlaps(&narrow, &wide));
+    
+    core_set_add(&wide, 1);
+    ASSERT_TRUE(core_set_overlaps(&narrow, &wide));
+    ASSERT_TRUE(core_set_overlaps(&wide, &narrow));
+}
+
+TEST(core_set_iteration_visits_members_in_order) {
+    core_set_t set;
+    core_set_clear(&set);
+
+    core_id_t members[] = { 0, 5, 63, 64, 130, MAX_DOMAIN_CORES - 1 };
+    uint32_t member_count = sizeof(members) / sizeof(members[0]);
+    for (uint32_t i = 0; i < member_count; i++) {
+        core_set_add(&set, members[i]);
+    }
+
+    uint32_t visited = 0;
+    core_id_t core;
+    CORE_SET_FOR_EACH(core, &set) {
+        ASSERT_TRUE(visited < member_count);
+        ASSERT_EQ(core, members[visited]);
+        visited++;
+    }
+    ASSERT_EQ(visited, member_count);
+
+    /* break leaves the loop like any for-loop */
+    visited = 0;
+    CORE_SET_FOR_EACH(core, &set) {
+        if (core == 63) {
+            break;
+        }
+        visited++;
+    }
+    ASSERT_EQ(visited, 2);
+
+    core_set_clear(&set);
+    CORE_SET_FOR_EACH(core, &set) {
+        ASSERT_TRUE(false);
+    }
+}
+
+TEST(core_set_algebra_recomputes_words_and_count) {
+    core_set_t a, b, out;
+    core_set_from_range(&a, 60, 10);              /* 60..69 */
+    core_set_clear(&b);
+    core_set_add(&b, 65);
+    core_set_add(&b, MAX_DOMAIN_CORES - 1);
+    core_set_clear(&out);
+
+    core_set_union(&out, &a, &b);
+    ASSERT_EQ(out.count, 11);
+    ASSERT_EQ(out.words, CORE_SET_WORDS);
+    ASSERT_TRUE(core_set_contains(&out, MAX_DOMAIN_CORES - 1));
+
+    /* Narrower result clears out's stale high words */
+    core_set_intersect(&out, &a, &b);
+    ASSERT_EQ(out.count, 1);
+    ASSERT_EQ(out.words, 2);
+    ASSERT_TRUE(core_set_contains(&out, 65));
+    ASSERT_EQ(out.bitmap[CORE_SET_WORDS - 1], 0);
+
+    core_set_difference(&out, &a, &b);
+    ASSERT_EQ(out.count, 9);
+    ASSERT_FALSE(core_set_contains(&out, 65));
+
+    /* Output may alias an input */
+    core_set_difference(&a, &a, &a);
+    ASSERT_EQ(a.count, 0);
+    ASSERT_EQ(a.words, 0);
+    ASSERT_TRUE(core_set_is_empty(&a));
+}
+
+TEST(core_set_subset_checks_every_word) {
+    core_set_t small, large;
+    core_set_from_range(&small, 62, 4);           /* 62..65 */
+    core_set_from_range(&large, 0, 128);
+
+    ASSERT_TRUE(core_set_is_subset(&small, &large));
+    ASSERT_FALSE(core_set_is_subset(&large, &small));
+
+    core_set_add(&small, MAX_DOMAIN_CORES - 1);
+    ASSERT_FALSE(core_set_is_subset(&small, &large));
+
+    core_set_clear(&small);
+    ASSERT_TRUE(core_set_is_subset(&small, &large));
+}
+
+TEST(core_set_lookup_first_next_nth) {
+    core_set_t set;
+    core_set_clear(&set);
+    ASSERT_EQ(core_set_first(&set), CORE_ID_INVALID);
+    ASSERT_EQ(core_set_nth(&set, 0), CORE_ID_INVALID);
+
+    core_set_add(&set, 3);
+    core_set_add(&set, 64);
+    core_set_add(&set, 200);
+
+    ASSERT_EQ(core_set_first(&set), 3);
+    ASSERT_EQ(core_set_next(&set, 3), 64);
+    ASSERT_EQ(core_set_next(&set, 64), 200);
+    ASSERT_EQ(core_set_next(&set, 200), CORE_ID_INVALID);
+    ASSERT_EQ(core_set_next(&set, 4), 64);
+
+    ASSERT_EQ(core_set_nth(&set, 0), 3);
+    ASSERT_EQ(core_set_nth(&set, 1), 64);
+    ASSERT_EQ(core_set_nth(&set, 2), 200);
+    ASSERT_EQ(core_set_nth(&set, 3), CORE_ID_INVALID);
+}
+
+TEST(core_set_range_spans_word_boundary) {
+    core_set_t set;
+    core_set_from_range(&set, 62, 4);
+
+    ASSERT_EQ(set.count, 4);
+    ASSERT_EQ(set.words, 2);
+    ASSERT_TRUE(set.explicit);
+    ASSERT_FALSE(core_set_contains(&set, 61));
+    ASSERT_TRUE(core_set_contains(&set, 62));
+    ASSERT_TRUE(core_set_contains(&set, 65));
+    ASSERT_FALSE(core_set_contains(&set, 66));
+
+    /* Clamped at MAX_DOMAIN_CORES */
+    core_set_from_range(&set, MAX_DOMAIN_CORES - 2, 100);
+    ASSERT_EQ(set.count, 2);
+    ASSERT_EQ(set.words, CORE_SET_WORDS);
+}
+
+TEST(core_set_word_kernels_match_scalar) {
+    uint64_t a[CORE_SET_WORDS];
+    uint64_t b[CORE_SET_WORDS];
+    uint64_t fast[CORE_SET_WORDS];
+    uint64_t slow[CORE_SET_WORDS];
+
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (uint32_t i = 0; i < CORE_SET_WORDS; i++) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        a[i] = seed;
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        b[i] = seed;
+    }
+
+    core_set_op_t ops[] = {
+        CORE_SET_OP_UNION, CORE_SET_OP_INTERSECT, CORE_SET_OP_DIFFERENCE
+    };
+    for (uint32_t o = 0; o < 3; o++) {
+        /* Every length exercises both the vector body and the tail */
+        for (uint32_t words = 0; words <= CORE_SET_WORDS; words++) {
+            uint32_t fast_count = core_set_combine_words(fast, a, b, words, ops[o]);
+            uint32_t slow_count = core_set_combine_words_scalar(slow, a, b, words, ops[o]);
+            ASSERT_EQ(fast_count, slow_count);
+            ASSERT_EQ(memcmp(fast, slow, words * sizeof(uint64_t)), 0);
+        }
+    }
+
+    for (uint32_t i = 0; i < CORE_SET_WORDS; i++) {
+        uint32_t members = (uint32_t)__builtin_popcountll(a[i]);
+        for (uint32_t n = 0; n < members; n++) {
+            ASSERT_EQ(core_set_select_bit(a[i], n), core_set_select_bit_scalar(a[i], n));
+        }
+    }
+}
+
 /* ========================================================================
  * BOOT FACTS VALIDATION TESTS
  * ========================================================================
@@ -201,7 +446,7 @@ TEST(boot_validation_accepts_valid_cores) {
     boot_facts_t boot = create_test_boot_facts();
     security_domain_t domain = create_valid_domain();
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_boot(&domain, &boot, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
@@ -215,7 +460,7 @@ TEST(boot_validation_rejects_nonexistent_core) {
     /* Add core that doesn't exist */
     core_set_add(&domain.cores, 100);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_boot(&domain, &boot, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -225,7 +470,7 @@ TEST(boot_validation_rejects_nonexistent_core) {
 TEST(boot_validation_rejects_null_boot_facts) {
     security_domain_t domain = create_valid_domain();
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_boot(&domain, NULL, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -238,7 +483,8 @@ TEST(boot_validation_rejects_null_boot_facts) {
  */
 
 TEST(topology_validation_accepts_satisfiable_l2_isolation) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     security_domain_t domain = create_valid_domain();
     
     /* Cores 0 and 2 don't share L2 (different pairs) */
@@ -247,14 +493,15 @@ TEST(topology_validation_accepts_satisfiable_l2_isolation) {
     core_set_add(&domain.cores, 2);
     domain.cache_isolation = CACHE_ISOLATION_L2;
     
-    validation_context_t ctx;
-    validation_result_t result = domain_validate_topology(&domain, &topology, &ctx);
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
 }
 
 TEST(topology_validation_rejects_unsatisfiable_l2_isolation) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     security_domain_t domain = create_valid_domain();
     
     /* Cores 0 and 1 share L2 (same pair) */
@@ -263,31 +510,34 @@ TEST(topology_validation_rejects_unsatisfiable_l2_isolation) {
     core_set_add(&domain.cores, 1);
     domain.cache_isolation = CACHE_ISOLATION_L2;
     
-    validation_context_t ctx;
-    validation_result_t result = domain_validate_topology(&domain, &topology, &ctx);
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
     ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_CACHE_ISOLATION_UNSATISFIABLE);
 }
 
 TEST(topology_validation_accepts_satisfiable_l3_isolation) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     security_domain_t domain = create_valid_domain();
     
-    /* Cores 0 and 8 don't share L3 (different groups) */
+    /* Cores 0 and 8 don't share L3 (different groups, so different nodes) */
     core_set_clear(&domain.cores);
     core_set_add(&domain.cores, 0);
     core_set_add(&domain.cores, 8);
     domain.cache_isolation = CACHE_ISOLATION_L3;
+    domain.numa_local = false;
     
-    validation_context_t ctx;
-    validation_result_t result = domain_validate_topology(&domain, &topology, &ctx);
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
 }
 
 TEST(topology_validation_rejects_unsatisfiable_l3_isolation) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     security_domain_t domain = create_valid_domain();
     
     /* Cores 0 and 1 share L3 (same group of 8) */
@@ -296,32 +546,35 @@ TEST(topology_validation_rejects_unsatisfiable_l3_isolation) {
     core_set_add(&domain.cores, 1);
     domain.cache_isolation = CACHE_ISOLATION_L3;
     
-    validation_context_t ctx;
-    validation_result_t result = domain_validate_topology(&domain, &topology, &ctx);
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
 }
 
 TEST(topology_validation_accepts_numa_local_on_same_node) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     security_domain_t domain = create_valid_domain();
     
-    /* Cores 0, 1, 2 are all on NUMA node 0 */
+    /* Cores 0, 1, 2 are all on NUMA node 0 (0 and 1 share L2) */
     core_set_clear(&domain.cores);
     core_set_add(&domain.cores, 0);
     core_set_add(&domain.cores, 1);
     core_set_add(&domain.cores, 2);
+    domain.cache_isolation = CACHE_ISOLATION_L1;
     domain.numa_local = true;
     domain.numa_local_explicit = true;
     
-    validation_context_t ctx;
-    validation_result_t result = domain_validate_topology(&domain, &topology, &ctx);
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
 }
 
 TEST(topology_validation_rejects_numa_local_on_different_nodes) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     security_domain_t domain = create_valid_domain();
     
     /* Cores 0 (node 0) and 8 (node 1) are on different NUMA nodes */
@@ -331,13 +584,42 @@ TEST(topology_validation_rejects_numa_local_on_different_nodes) {
     domain.numa_local = true;
     domain.numa_local_explicit = true;
     
-    validation_context_t ctx;
-    validation_result_t result = domain_validate_topology(&domain, &topology, &ctx);
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
     ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_NUMA_CONSTRAINT_VIOLATED);
 }
 
+TEST(field_validation_rejects_implicit_memory_tier) {
+    security_domain_t domain = create_valid_domain();
+    domain.memory_tier = MEMORY_TIER_FAR;
+    domain.memory_tier_explicit = false;
+    
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_fields(&domain, &ctx);
+    
+    ASSERT_EQ(result, VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_FIELD_NOT_SET);
+}
+
+TEST(topology_validation_rejects_unavailable_memory_tier) {
+    /* Sealing validates, which classifies both nodes as DRAM */
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    security_domain_t domain = create_valid_domain();
+    
+    /* Test topology has DRAM nodes only */
+    domain.memory_tier = MEMORY_TIER_FAR;
+    domain.memory_tier_explicit = true;
+    
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
+    
+    ASSERT_EQ(result, VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_MEMORY_TIER_UNAVAILABLE);
+}
+
 /* ========================================================================
  * DEPENDENCY VALIDATION TESTS
  * ========================================================================
@@ -345,10 +627,11 @@ TEST(topology_validation_rejects_numa_local_on_different_nodes) {
 
 TEST(dependency_validation_accepts_valid_dependencies) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain1 = create_valid_domain();
     domain1.id = 1;
@@ -362,7 +645,7 @@ TEST(dependency_validation_accepts_valid_dependencies) {
     domain_graph_add(&graph, &domain1);
     domain_graph_add(&graph, &domain2);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_dependencies(&domain2, &graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
@@ -370,10 +653,11 @@ TEST(dependency_validation_accepts_valid_dependencies) {
 
 TEST(dependency_validation_rejects_self_dependency) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain = create_valid_domain();
     domain.id = 1;
@@ -381,7 +665,7 @@ TEST(dependency_validation_rejects_self_dependency) {
     
     domain_graph_add(&graph, &domain);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_dependencies(&domain, &graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -390,10 +674,11 @@ TEST(dependency_validation_rejects_self_dependency) {
 
 TEST(dependency_validation_rejects_nonexistent_dependency) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain = create_valid_domain();
     domain.id = 1;
@@ -401,7 +686,7 @@ TEST(dependency_validation_rejects_nonexistent_dependency) {
     
     domain_graph_add(&graph, &domain);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_validate_dependencies(&domain, &graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -415,10 +700,11 @@ TEST(dependency_validation_rejects_nonexistent_dependency) {
 
 TEST(graph_validation_accepts_non_overlapping_cores) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain1 = create_valid_domain();
     domain1.id = 1;
@@ -435,7 +721,7 @@ TEST(graph_validation_accepts_non_overlapping_cores) {
     domain_graph_add(&graph, &domain1);
     domain_graph_add(&graph, &domain2);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_graph_validate_no_overlap(&graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
@@ -443,10 +729,11 @@ TEST(graph_validation_accepts_non_overlapping_cores) {
 
 TEST(graph_validation_rejects_overlapping_cores) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain1 = create_valid_domain();
     domain1.id = 1;
@@ -463,19 +750,66 @@ TEST(graph_validation_rejects_overlapping_cores) {
     domain_graph_add(&graph, &domain1);
     domain_graph_add(&graph, &domain2);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_graph_validate_no_overlap(&graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
     ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_CORES_OVERLAP);
+    ASSERT_EQ(ctx.details[0].domain, 2);
+    ASSERT_EQ(ctx.details[0].other, 1);
+    ASSERT_EQ(ctx.details[0].first_core, 1);
+    ASSERT_EQ(ctx.details[0].core_count, 1);
+}
+
+TEST(graph_validation_attributes_each_overlapping_pair) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    domain_graph_init(&graph, &boot, topology);
+    
+    security_domain_t domain1 = create_valid_domain();
+    domain1.id = 10;
+    core_set_from_range(&domain1.cores, 0, 4);       /* 0..3 */
+    
+    security_domain_t domain2 = create_valid_domain();
+    domain2.id = 20;
+    core_set_from_range(&domain2.cores, 4, 4);       /* 4..7 */
+    
+    /* Collides with domain1 on 2,3 and with domain2 on 4 */
+    security_domain_t domain3 = create_valid_domain();
+    domain3.id = 30;
+    core_set_from_range(&domain3.cores, 2, 3);
+    
+    domain_graph_add(&graph, &domain1);
+    domain_graph_add(&graph, &domain2);
+    domain_graph_add(&graph, &domain3);
+    
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_graph_validate_no_overlap(&graph, &ctx);
+    
+    ASSERT_EQ(result, VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.error_count, 2);
+    
+    ASSERT_EQ(ctx.details[0].domain, 30);
+    ASSERT_EQ(ctx.details[0].other, 10);
+    ASSERT_EQ(ctx.details[0].first_core, 2);
+    ASSERT_EQ(ctx.details[0].core_count, 2);
+    
+    ASSERT_EQ(ctx.details[1].domain, 30);
+    ASSERT_EQ(ctx.details[1].other, 20);
+    ASSERT_EQ(ctx.details[1].first_core, 4);
+    ASSERT_EQ(ctx.details[1].core_count, 1);
 }
 
 TEST(graph_validation_accepts_acyclic_dependencies) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     /* Create chain: domain1 <- domain2 <- domain3 */
     security_domain_t domain1 = create_valid_domain();
@@ -499,7 +833,7 @@ TEST(graph_validation_accepts_acyclic_dependencies) {
     domain_graph_add(&graph, &domain2);
     domain_graph_add(&graph, &domain3);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_graph_validate_acyclic(&graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
@@ -507,10 +841,11 @@ TEST(graph_validation_accepts_acyclic_dependencies) {
 
 TEST(graph_validation_rejects_circular_dependencies) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     /* Create cycle: domain1 -> domain2 -> domain3 -> domain1 */
     security_domain_t domain1 = create_valid_domain();
@@ -535,11 +870,152 @@ TEST(graph_validation_rejects_circular_dependencies) {
     domain_graph_add(&graph, &domain2);
     domain_graph_add(&graph, &domain3);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_graph_validate_acyclic(&graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
     ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_DEPENDENCY_CIRCULAR);
+    ASSERT_EQ(ctx.details[0].members, 0x7);
+    ASSERT_EQ(ctx.details[0].domain, 1);
+    ASSERT_EQ(ctx.details[0].other, 3);
+}
+
+TEST(graph_validation_reports_each_cycle) {
+    boot_facts_t boot = create_test_boot_facts();
+    
+    domain_graph_t graph;
+    domain_graph_init(&graph, &boot, NULL);
+    
+    /* 1 <-> 2, 3 -> 1 (depends on a cycle, not in it), 4 -> 4 */
+    domain_id_t depends_on[] = { 2, 1, 1, 4 };
+    for (uint32_t i = 0; i < 4; i++) {
+        security_domain_t domain = create_valid_domain();
+        domain.id = i + 1;
+        dependency_set_add(&domain.dependencies, depends_on[i]);
+        domain_graph_add(&graph, &domain);
+    }
+    
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_graph_validate_acyclic(&graph, &ctx);
+    
+    ASSERT_EQ(result, VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.error_count, 2);
+    ASSERT_EQ(ctx.details[0].members, 0x3);
+    ASSERT_EQ(ctx.details[1].members, 0x8);
+    ASSERT_EQ(ctx.details[1].domain, 4);
+}
+
+TEST(graph_validation_records_startup_order) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    domain_graph_init(&graph, &boot, topology);
+    
+    /* Added before their dependencies: 10 -> 20 -> 30, 40 -> 30 */
+    domain_id_t ids[] = { 10, 20, 40, 30 };
+    domain_id_t depends_on[] = { 20, 30, 30, DOMAIN_ID_INVALID };
+    for (uint32_t i = 0; i < 4; i++) {
+        security_domain_t domain = create_valid_domain();
+        domain.id = ids[i];
+        core_set_clear(&domain.cores);
+        core_set_add(&domain.cores, i * 2);
+        if (depends_on[i] != DOMAIN_ID_INVALID) {
+            dependency_set_add(&domain.dependencies, depends_on[i]);
+        }
+        domain_graph_add(&graph, &domain);
+    }
+    
+    validation_context_t ctx = { 0 };
+    ASSERT_EQ(domain_graph_validate(&graph, &ctx), VALIDATION_ACCEPT);
+    
+    /* Every domain starts after all of its dependencies */
+    uint32_t started[MAX_DOMAINS];
+    for (uint32_t k = 0; k < graph.domain_count; k++) {
+        started[graph.startup_order[k]] = k;
+    }
+    for (uint32_t i = 0; i < graph.domain_count; i++) {
+        if (depends_on[i] != DOMAIN_ID_INVALID) {
+            uint32_t dep = domain_graph_index_of(&graph, depends_on[i]);
+            ASSERT_TRUE(started[dep] < started[i]);
+        }
+    }
+    ASSERT_EQ(graph.domains[graph.startup_order[0]].id, 30);
+}
+
+TEST(graph_index_finds_sparse_ids) {
+    boot_facts_t boot = create_test_boot_facts();
+    
+    domain_graph_t graph;
+    domain_graph_init(&graph, &boot, NULL);
+    
+    /* Full graph of widely spread IDs */
+    for (uint32_t i = 0; i < MAX_DOMAINS; i++) {
+        security_domain_t domain = create_valid_domain();
+        domain.id = i * 1000003u + 7;
+        ASSERT_TRUE(domain_graph_add(&graph, &domain));
+    }
+    ASSERT_EQ(graph.index.indexed, MAX_DOMAINS);
+    
+    for (uint32_t i = 0; i < MAX_DOMAINS; i++) {
+        ASSERT_EQ(domain_graph_index_of(&graph, i * 1000003u + 7), i);
+    }
+    ASSERT_EQ(domain_graph_index_of(&graph, 8), DOMAIN_INDEX_NONE);
+    ASSERT_TRUE(domain_graph_get(&graph, 8) == NULL);
+}
+
+TEST(graph_index_falls_back_when_filled_in_place) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    domain_graph_init(&graph, &boot, topology);
+    
+    /* As the config parser does: write domains[] directly */
+    graph.domains[0] = create_valid_domain();
+    graph.domains[0].id = 42;
+    graph.domain_count = 1;
+    
+    ASSERT_EQ(domain_graph_index_of(&graph, 42), 0);
+    
+    validation_context_t ctx = { 0 };
+    ASSERT_EQ(domain_graph_validate(&graph, &ctx), VALIDATION_ACCEPT);
+    ASSERT_EQ(graph.index.indexed, 1);
+    ASSERT_EQ(domain_graph_index_of(&graph, 42), 0);
+}
+
+TEST(graph_validation_rejects_duplicate_ids) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    domain_graph_init(&graph, &boot, topology);
+    
+    security_domain_t domain1 = create_valid_domain();
+    domain1.id = 5;
+    
+    security_domain_t domain2 = create_valid_domain();
+    domain2.id = 5;
+    core_set_clear(&domain2.cores);
+    core_set_add(&domain2.cores, 4);
+    core_set_add(&domain2.cores, 6);
+    
+    domain_graph_add(&graph, &domain1);
+    domain_graph_add(&graph, &domain2);
+    
+    /* First domain added keeps the ID */
+    ASSERT_EQ(domain_graph_index_of(&graph, 5), 0);
+    
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_graph_validate_unique_ids(&graph, &ctx);
+    
+    ASSERT_EQ(result, VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.error_count, 1);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_DUPLICATE_ID);
+    ASSERT_EQ(ctx.details[0].domain, 5);
 }
 
 /* ========================================================================
@@ -549,17 +1025,18 @@ TEST(graph_validation_rejects_circular_dependencies) {
 
 TEST(full_validation_accepts_valid_configuration) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain1 = create_valid_domain();
     domain1.id = 1;
     
     domain_graph_add(&graph, &domain1);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_graph_validate(&graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_ACCEPT);
@@ -569,17 +1046,18 @@ TEST(full_validation_accepts_valid_configuration) {
 
 TEST(full_validation_rejects_incomplete_domain) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain = create_valid_domain();
     domain.security_level = SECURITY_LEVEL_UNDEFINED;  /* Invalid */
     
     domain_graph_add(&graph, &domain);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     validation_result_t result = domain_graph_validate(&graph, &ctx);
     
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
@@ -588,15 +1066,16 @@ TEST(full_validation_rejects_incomplete_domain) {
 
 TEST(sealing_succeeds_after_validation) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain = create_valid_domain();
     domain_graph_add(&graph, &domain);
     
-    validation_context_t ctx;
+    validation_context_t ctx = { 0 };
     domain_graph_validate(&graph, &ctx);
     
     bool sealed = domain_graph_seal(&graph);
@@ -607,10 +1086,11 @@ TEST(sealing_succeeds_after_validation) {
 
 TEST(sealing_fails_without_validation) {
     boot_facts_t boot = create_test_boot_facts();
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
     
     domain_graph_t graph;
-    domain_graph_init(&graph, &boot, &topology);
+    domain_graph_init(&graph, &boot, topology);
     
     security_domain_t domain = create_valid_domain();
     domain_graph_add(&graph, &domain);
@@ -622,138 +1102,506 @@ TEST(sealing_fails_without_validation) {
     ASSERT_FALSE(graph.sealed);
 }
 
+TEST(sealing_builds_transitive_access) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    domain_graph_init(&graph, &boot, topology);
+    
+    /* audit(3) -> validation(2) -> network(1), plus 4 -> 1 */
+    domain_id_t depends_on[] = { DOMAIN_ID_INVALID, 1, 2, 1 };
+    for (uint32_t i = 0; i < 4; i++) {
+        security_domain_t domain = create_valid_domain();
+        domain.id = i + 1;
+        core_set_clear(&domain.cores);
+        core_set_add(&domain.cores, i * 2);
+        if (depends_on[i] != DOMAIN_ID_INVALID) {
+            dependency_set_add(&domain.dependencies, depends_on[i]);
+        }
+        domain_graph_add(&graph, &domain);
+    }
+    
+    validation_context_t ctx = { 0 };
+    ASSERT_EQ(domain_graph_validate(&graph, &ctx), VALIDATION_ACCEPT);
+    
+    /* Transitive queries need the sealed matrices */
+    ASSERT_FALSE(domain_graph_can_reach(&graph, 3, 2));
+    ASSERT_TRUE(domain_graph_seal(&graph));
+    
+    ASSERT_TRUE(domain_graph_can_access(&graph, 3, 2));
+    ASSERT_FALSE(domain_graph_can_access(&graph, 3, 1));
+    
+    ASSERT_TRUE(domain_graph_can_reach(&graph, 3, 2));
+    ASSERT_TRUE(domain_graph_can_reach(&graph, 3, 1));
+    ASSERT_TRUE(domain_graph_can_reach(&graph, 4, 1));
+    ASSERT_FALSE(domain_graph_can_reach(&graph, 1, 3));
+    ASSERT_FALSE(domain_graph_can_reach(&graph, 4, 2));
+    ASSERT_FALSE(domain_graph_can_reach(&graph, 3, 3));
+    ASSERT_FALSE(domain_graph_can_reach(&graph, 3, 99));
+}
+
+TEST(sealing_packs_hot_records) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    domain_graph_init(&graph, &boot, topology);
+    
+    /* 7 on cores 0 and 2; 9 on core 4, depends on 7 */
+    security_domain_t first = create_valid_domain();
+    first.id = 7;
+    security_domain_t second = create_valid_domain();
+    second.id = 9;
+    second.security_level = SECURITY_LEVEL_6;
+    second.preemption = PREEMPTION_NEVER;
+    core_set_clear(&second.cores);
+    core_set_add(&second.cores, 4);
+    dependency_set_add(&second.dependencies, 7);
+    
+    ASSERT_TRUE(domain_graph_add(&graph, &first));
+    ASSERT_TRUE(domain_graph_add(&graph, &second));
+    
+    validation_context_t ctx = { 0 };
+    ASSERT_EQ(domain_graph_validate(&graph, &ctx), VALIDATION_ACCEPT);
+    ASSERT_TRUE(domain_graph_hot(&graph, 9) == NULL);
+    ASSERT_TRUE(domain_graph_seal(&graph));
+    
+    const domain_hot_t *hot = domain_graph_hot(&graph, 9);
+    ASSERT_TRUE(hot != NULL);
+    ASSERT_EQ((uintptr_t)hot % DOMAIN_HOT_ALIGN, 0);
+    ASSERT_EQ(hot, &graph.hot[1]);
+    ASSERT_EQ(hot->id, 9);
+    ASSERT_EQ(hot->security_level, SECURITY_LEVEL_6);
+    ASSERT_EQ(hot->preemption, PREEMPTION_NEVER);
+    ASSERT_EQ(hot->cache_isolation, CACHE_ISOLATION_L2);
+    ASSERT_EQ(hot->memory_type, MEMORY_DOMAIN_ISOLATED);
+    ASSERT_EQ(hot->core_count, 1);
+    ASSERT_EQ(hot->cores[0], 1ULL << 4);
+    ASSERT_EQ(hot->access_direct, 0x1);
+    ASSERT_EQ(graph.hot[0].cores[0], (1ULL << 0) | (1ULL << 2));
+    ASSERT_TRUE(domain_graph_hot(&graph, 8) == NULL);
+    
+    /* Sealed queries answer from the hot records */
+    ASSERT_TRUE(domain_graph_cores_isolated(&graph, 7, 9));
+    ASSERT_TRUE(domain_graph_can_access(&graph, 9, 7));
+    ASSERT_FALSE(domain_graph_can_access(&graph, 7, 9));
+    
+    graph.hot[1].cores[0] |= 1ULL << 2;
+    ASSERT_FALSE(domain_graph_cores_isolated(&graph, 7, 9));
+}
+
+/* ========================================================================
+ * PARALLEL VALIDATION TESTS
+ * ========================================================================
+ */
+
+/* Large graphs: keep them out of the test stack frames */
+static domain_graph_t serial_graph;
+static domain_graph_t parallel_graph;
+
+/* 40 domains with a mix of field, boot, overlap and duplicate errors */
+static void create_mixed_graph(domain_graph_t *graph, boot_facts_t *boot,
+                               topology_state_t *topology) {
+    domain_graph_init(graph, boot, topology);
+    
+    for (uint32_t i = 0; i < 40; i++) {
+        security_domain_t domain = create_valid_domain();
+        domain.id = (i % 13 == 12) ? 3 : i;           /* Duplicate IDs */
+        domain.cache_isolation = CACHE_ISOLATION_L1;
+        domain.numa_local = false;
+        core_set_clear(&domain.cores);
+        core_set_add(&domain.cores, (i % 9 == 4) ? 100 : i % 16);
+        
+        if (i % 7 == 3) {
+            domain.security_level = SECURITY_LEVEL_UNDEFINED;
+        }
+        if (i % 11 == 5) {
+            domain.name_explicit = false;
+        }
+        if (i > 0) {
+            dependency_set_add(&domain.dependencies, i - 1);
+        }
+        
+        domain_graph_add(graph, &domain);
+    }
+}
+
+TEST(parallel_validation_matches_serial) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    create_mixed_graph(&serial_graph, &boot, topology);
+    validation_context_t serial = { 0 };
+    validation_result_t serial_result = domain_graph_validate(&serial_graph, &serial);
+    ASSERT_EQ(serial_result, VALIDATION_HARD_FAIL);
+    ASSERT_TRUE(serial.error_count > 10);
+    
+    uint32_t worker_counts[] = { 2, 3, 7, DOMAIN_VALIDATE_MAX_WORKERS, 1000 };
+    for (uint32_t t = 0; t < 5; t++) {
+        create_mixed_graph(&parallel_graph, &boot, topology);
+        validation_context_t parallel = { 0 };
+        validation_result_t parallel_result =
+            domain_graph_validate_parallel(&parallel_graph, &parallel, worker_counts[t]);
+        
+        ASSERT_EQ(parallel_result, serial_result);
+        ASSERT_EQ(parallel.error_count, serial.error_count);
+        ASSERT_EQ(parallel.worst_result, serial.worst_result);
+        ASSERT_EQ(memcmp(parallel.errors, serial.errors, sizeof(serial.errors)), 0);
+        ASSERT_EQ(memcmp(parallel.details, serial.details, sizeof(serial.details)), 0);
+        
+        ASSERT_EQ(parallel_graph.failed_domains, serial_graph.failed_domains);
+        ASSERT_EQ(parallel_graph.validated, serial_graph.validated);
+        for (uint32_t i = 0; i < serial_graph.domain_count; i++) {
+            ASSERT_EQ(parallel_graph.domains[i].validated,
+                      serial_graph.domains[i].validated);
+        }
+    }
+}
+
+TEST(parallel_validation_accepts_valid_graph) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t *graph = &parallel_graph;
+    domain_graph_init(graph, &boot, topology);
+    
+    for (uint32_t i = 0; i < 8; i++) {
+        security_domain_t domain = create_valid_domain();
+        domain.id = i;
+        core_set_clear(&domain.cores);
+        core_set_add(&domain.cores, i * 2);
+        domain_graph_add(graph, &domain);
+    }
+    
+    validation_context_t ctx = { 0 };
+    ASSERT_EQ(domain_graph_validate_parallel(graph, &ctx, 4), VALIDATION_ACCEPT);
+    ASSERT_EQ(ctx.error_count, 0);
+    ASSERT_TRUE(graph->validated);
+    ASSERT_TRUE(graph->domains[7].validated);
+}
+
+/* ========================================================================
+ * INCREMENTAL REVALIDATION TESTS
+ * ========================================================================
+ */
+
+/* Domains 1 (cores 0,2) and 2 (cores 4,6), 2 depends on 1; validated */
+static void create_validated_pair(domain_graph_t *graph, boot_facts_t *boot,
+                                  topology_state_t *topology) {
+    domain_graph_init(graph, boot, topology);
+    
+    security_domain_t domain1 = create_valid_domain();
+    domain1.id = 1;
+    
+    security_domain_t domain2 = create_valid_domain();
+    domain2.id = 2;
+    core_set_clear(&domain2.cores);
+    core_set_add(&domain2.cores, 4);
+    core_set_add(&domain2.cores, 6);
+    dependency_set_add(&domain2.dependencies, 1);
+    
+    domain_graph_add(graph, &domain1);
+    domain_graph_add(graph, &domain2);
+    
+    validation_context_t ctx = { 0 };
+    domain_graph_validate(graph, &ctx);
+}
+
+TEST(revalidate_reports_and_clears_overlap) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    create_validated_pair(&graph, &boot, topology);
+    ASSERT_TRUE(graph.validated);
+    
+    /* Move domain 2 onto domain 1's core 2 */
+    security_domain_t *domain2 = &graph.domains[1];
+    core_set_clear(&domain2->cores);
+    core_set_add(&domain2->cores, 2);
+    core_set_add(&domain2->cores, 4);
+    
+    validation_context_t ctx;
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 2, &ctx), VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.error_count, 1);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_CORES_OVERLAP);
+    ASSERT_EQ(ctx.details[0].domain, 2);
+    ASSERT_EQ(ctx.details[0].other, 1);
+    ASSERT_EQ(ctx.details[0].first_core, 2);
+    ASSERT_FALSE(graph.validated);
+    ASSERT_TRUE(core_set_contains(&graph.contested, 2));
+    
+    /* Move it back: old claim on 2 released, graph valid again */
+    core_set_clear(&domain2->cores);
+    core_set_add(&domain2->cores, 4);
+    core_set_add(&domain2->cores, 6);
+    
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 2, &ctx), VALIDATION_ACCEPT);
+    ASSERT_EQ(ctx.error_count, 0);
+    ASSERT_TRUE(graph.validated);
+    ASSERT_TRUE(core_set_is_empty(&graph.contested));
+    ASSERT_EQ(graph.claimed.count, 4);
+    ASSERT_EQ(graph.core_owners[2], 0x1);
+}
+
+TEST(revalidate_reports_cycle_through_edited_domain) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    create_validated_pair(&graph, &boot, topology);
+    
+    /* 1 -> 2 closes the cycle 1 -> 2 -> 1 */
+    dependency_set_add(&graph.domains[0].dependencies, 2);
+    
+    validation_context_t ctx;
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 1, &ctx), VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_DEPENDENCY_CIRCULAR);
+    ASSERT_EQ(ctx.details[0].members, 0x3);
+    ASSERT_FALSE(graph.validated);
+    ASSERT_EQ(graph.access_reach[0] & 0x1, 0x1);
+    
+    dependency_set_clear(&graph.domains[0].dependencies);
+    
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 1, &ctx), VALIDATION_ACCEPT);
+    ASSERT_TRUE(graph.validated);
+    ASSERT_EQ(graph.access_reach[0], 0);
+    ASSERT_EQ(graph.access_reach[1], 0x1);
+}
+
+TEST(revalidate_keeps_other_domains_failures) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    create_validated_pair(&graph, &boot, topology);
+    
+    /* Break domain 1, then revalidate a clean edit of domain 2 */
+    graph.domains[0].security_level = SECURITY_LEVEL_UNDEFINED;
+    
+    validation_context_t ctx;
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 1, &ctx), VALIDATION_HARD_FAIL);
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 2, &ctx), VALIDATION_ACCEPT);
+    ASSERT_FALSE(graph.validated);
+    
+    graph.domains[0].security_level = SECURITY_LEVEL_4;
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 1, &ctx), VALIDATION_ACCEPT);
+    ASSERT_TRUE(graph.validated);
+}
+
+TEST(revalidate_rejects_unknown_and_sealed) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    create_validated_pair(&graph, &boot, topology);
+    
+    validation_context_t ctx;
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 99, &ctx), VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_DOMAIN_NOT_FOUND);
+    ASSERT_TRUE(graph.validated);
+    
+    ASSERT_TRUE(domain_graph_seal(&graph));
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 1, &ctx), VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_GRAPH_SEALED);
+}
+
+TEST(revalidate_falls_back_to_full_validation) {
+    boot_facts_t boot = create_test_boot_facts();
+    topology_state_t *topology = create_sealed_test_topology();
+    ASSERT_TRUE(topology != NULL);
+    
+    domain_graph_t graph;
+    create_validated_pair(&graph, &boot, topology);
+    
+    /* Added after the last full validation: no incremental state for it */
+    security_domain_t domain3 = create_valid_domain();
+    domain3.id = 3;
+    core_set_clear(&domain3.cores);
+    core_set_add(&domain3.cores, 6);
+    domain_graph_add(&graph, &domain3);
+    
+    validation_context_t ctx;
+    ASSERT_EQ(domain_graph_revalidate_domain(&graph, 3, &ctx), VALIDATION_HARD_FAIL);
+    ASSERT_TRUE(graph.tracked);
+    ASSERT_TRUE(core_set_contains(&graph.contested, 6));
+}
+
 /* ========================================================================
  * CACHE ISOLATION MATRIX TESTS (Critical Gap Filled)
  * ========================================================================
  */
 
 TEST(cache_isolation_matrix_self_core) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_test_topology();
     
-    topology_build_cache_isolation_matrix(&topology);
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
     
     /* Same core should have CACHE_ISOLATED_NONE */
     cache_isolation_level_t isolation = 
-        topology_get_cache_isolation(&topology, 0, 0);
+        topology_get_cache_isolation(topology, 0, 0);
     
     ASSERT_EQ(isolation, CACHE_ISOLATED_NONE);
 }
 
 TEST(cache_isolation_matrix_l1_shared) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_test_topology();
     
     /* Cores 0 and 1 share L2 (pair 0), but have private L1 */
-    topology.cores[0].l1_domain = 0;
-    topology.cores[1].l1_domain = 1;
-    topology.cores[0].l2_domain = 0;
-    topology.cores[1].l2_domain = 0;  /* Shared L2 */
-    topology.cores[0].l3_domain = 0;
-    topology.cores[1].l3_domain = 0;  /* Shared L3 */
+    topology->cores[0].l1_domain = 0;
+    topology->cores[1].l1_domain = 1;
+    topology->cores[0].l2_domain = 0;
+    topology->cores[1].l2_domain = 0;  /* Shared L2 */
+    topology->cores[0].l3_domain = 0;
+    topology->cores[1].l3_domain = 0;  /* Shared L3 */
     
-    topology_build_cache_isolation_matrix(&topology);
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
     
     cache_isolation_level_t isolation = 
-        topology_get_cache_isolation(&topology, 0, 1);
+        topology_get_cache_isolation(topology, 0, 1);
     
     /* Private L1, shared L2/L3 = CACHE_ISOLATED_L2 */
     ASSERT_EQ(isolation, CACHE_ISOLATED_L2);
 }
 
 TEST(cache_isolation_matrix_l1_l2_private) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_test_topology();
     
     /* Cores 0 and 2 have private L1 and L2, shared L3 */
-    topology.cores[0].l1_domain = 0;
-    topology.cores[2].l1_domain = 2;
-    topology.cores[0].l2_domain = 0;
-    topology.cores[2].l2_domain = 1;
-    topology.cores[0].l3_domain = 0;
-    topology.cores[2].l3_domain = 0;  /* Shared L3 */
+    topology->cores[0].l1_domain = 0;
+    topology->cores[2].l1_domain = 2;
+    topology->cores[0].l2_domain = 0;
+    topology->cores[2].l2_domain = 1;
+    topology->cores[0].l3_domain = 0;
+    topology->cores[2].l3_domain = 0;  /* Shared L3 */
     
-    topology_build_cache_isolation_matrix(&topology);
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
     
     cache_isolation_level_t isolation = 
-        topology_get_cache_isolation(&topology, 0, 2);
+        topology_get_cache_isolation(topology, 0, 2);
     
     /* Private L1/L2, shared L3 = CACHE_ISOLATED_L3 */
     ASSERT_EQ(isolation, CACHE_ISOLATED_L3);
 }
 
 TEST(cache_isolation_matrix_full_isolation) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_test_topology();
     
     /* Cores 0 and 8 have no shared cache */
-    topology.cores[0].l1_domain = 0;
-    topology.cores[8].l1_domain = 8;
-    topology.cores[0].l2_domain = 0;
-    topology.cores[8].l2_domain = 4;
-    topology.cores[0].l3_domain = 0;
-    topology.cores[8].l3_domain = 1;
+    topology->cores[0].l1_domain = 0;
+    topology->cores[8].l1_domain = 8;
+    topology->cores[0].l2_domain = 0;
+    topology->cores[8].l2_domain = 4;
+    topology->cores[0].l3_domain = 0;
+    topology->cores[8].l3_domain = 1;
     
-    topology_build_cache_isolation_matrix(&topology);
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
     
     cache_isolation_level_t isolation = 
-        topology_get_cache_isolation(&topology, 0, 8);
+        topology_get_cache_isolation(topology, 0, 8);
     
     /* No shared cache = CACHE_ISOLATED_FULL */
     ASSERT_EQ(isolation, CACHE_ISOLATED_FULL);
 }
 
 TEST(cache_isolation_matrix_all_shared) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_test_topology();
     
     /* Cores 0 and 1 share all caches (hypothetical bad config) */
-    topology.cores[0].l1_domain = 0;
-    topology.cores[1].l1_domain = 0;  /* Shared L1! */
-    topology.cores[0].l2_domain = 0;
-    topology.cores[1].l2_domain = 0;
-    topology.cores[0].l3_domain = 0;
-    topology.cores[1].l3_domain = 0;
+    topology->cores[0].l1_domain = 0;
+    topology->cores[1].l1_domain = 0;  /* Shared L1! */
+    topology->cores[0].l2_domain = 0;
+    topology->cores[1].l2_domain = 0;
+    topology->cores[0].l3_domain = 0;
+    topology->cores[1].l3_domain = 0;
     
-    topology_build_cache_isolation_matrix(&topology);
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
     
     cache_isolation_level_t isolation = 
-        topology_get_cache_isolation(&topology, 0, 1);
+        topology_get_cache_isolation(topology, 0, 1);
     
     /* All caches shared = CACHE_ISOLATED_L1 (only registers private) */
     ASSERT_EQ(isolation, CACHE_ISOLATED_L1);
 }
 
+TEST(cache_isolation_matrix_smt_siblings_share_l1) {
+    topology_state_t *topology = create_test_topology();
+    
+    /* Cores 0 and 1 are SMT threads of one physical core */
+    topology->cores[1].physical_core = 0;
+    topology->cores[1].l1_domain = 0;
+    topology->cores[1].l2_domain = 0;
+    
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
+    
+    /* Siblings share L1; a core against itself shares everything */
+    ASSERT_EQ(topology_get_cache_isolation(topology, 0, 1), CACHE_ISOLATED_L1);
+    ASSERT_EQ(topology_get_cache_isolation(topology, 1, 0), CACHE_ISOLATED_L1);
+    ASSERT_EQ(topology_get_cache_isolation(topology, 1, 1), CACHE_ISOLATED_NONE);
+}
+
 TEST(cache_isolation_matrix_symmetry) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_test_topology();
     
-    topology_build_cache_isolation_matrix(&topology);
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
     
     /* Matrix must be symmetric */
     for (uint32_t i = 0; i < topology->core_count; i++) {
         for (uint32_t j = 0; j < topology->core_count; j++) {
             cache_isolation_level_t iso_ij = 
-                topology_get_cache_isolation(&topology, i, j);
+                topology_get_cache_isolation(topology, i, j);
             cache_isolation_level_t iso_ji = 
-                topology_get_cache_isolation(&topology, j, i);
+                topology_get_cache_isolation(topology, j, i);
             
             ASSERT_EQ(iso_ij, iso_ji);
         }
     }
 }
 
+TEST(cache_isolation_row_kernel_matches_scalar) {
+    /* Irregular domains and a non-multiple-of-vector width */
+    static _Alignas(64) cache_domain_t l1[77], l2[77], l3[77];
+    uint8_t expected[77], actual[77];
+    
+    for (uint32_t i = 0; i < 77; i++) {
+        l1[i] = i / 2;
+        l2[i] = (i * 7) % 13;
+        l3[i] = i / 11;
+    }
+    
+    for (uint32_t row = 0; row < 77; row++) {
+        topology_build_isolation_row_scalar(l1, l2, l3, 77, row, expected);
+        topology_build_isolation_row(l1, l2, l3, 77, row, actual);
+        
+        ASSERT_EQ(memcmp(expected, actual, sizeof(expected)), 0);
+        ASSERT_EQ(actual[row], CACHE_ISOLATED_FULL);
+    }
+}
+
 /* ========================================================================
  * CUMULATIVE CACHE ISOLATION VALIDATION TESTS
  * ========================================================================
  */
 
 TEST(domain_validation_l2_requires_l1_private) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_test_topology();
     
     /* Setup: cores 0,1 share L1 but have private L2 */
-    topology.cores[0].l1_domain = 0;
-    topology.cores[1].l1_domain = 0;  /* Shared L1 */
-    topology.cores[0].l2_domain = 0;
-    topology.cores[1].l2_domain = 1;  /* Private L2 */
+    topology->cores[0].l1_domain = 0;
+    topology->cores[1].l1_domain = 0;  /* Shared L1 */
+    topology->cores[0].l2_domain = 0;
+    topology->cores[1].l2_domain = 1;  /* Private L2 */
     
-    topology_build_cache_isolation_matrix(&topology);
-    topology.validated = true;
-    topology.sealed = true;
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
     
     boot_facts_t boot = create_test_boot_facts();
     
@@ -764,27 +1612,25 @@ TEST(domain_validation_l2_requires_l1_private) {
     core_set_add(&domain.cores, 1);
     domain.cache_isolation = CACHE_ISOLATION_L2;
     
-    validation_context_t ctx;
-    validation_result_t result = domain_validate_topology(&domain, &topology, &ctx);
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
     
     /* Should FAIL because L2 isolation requires L1 to be private too */
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
 }
 
 TEST(domain_validation_l3_requires_l1_l2_private) {
-    topology_state_t topology = create_test_topology();
+    topology_state_t *topology = create_test_topology();
     
     /* Setup: cores 0,1 have private L1, shared L2, private L3 */
-    topology.cores[0].l1_domain = 0;
-    topology.cores[1].l1_domain = 1;  /* Private L1 */
-    topology.cores[0].l2_domain = 0;
-    topology.cores[1].l2_domain = 0;  /* Shared L2! */
-    topology.cores[0].l3_domain = 0;
-    topology.cores[1].l3_domain = 1;  /* Private L3 */
+    topology->cores[0].l1_domain = 0;
+    topology->cores[1].l1_domain = 1;  /* Private L1 */
+    topology->cores[0].l2_domain = 0;
+    topology->cores[1].l2_domain = 0;  /* Shared L2! */
+    topology->cores[0].l3_domain = 0;
+    topology->cores[1].l3_domain = 1;  /* Private L3 */
     
-    topology_build_cache_isolation_matrix(&topology);
-    topology.validated = true;
-    topology.sealed = true;
+    ASSERT_TRUE(seal_test_topology(topology) != NULL);
     
     boot_facts_t boot = create_test_boot_facts();
     
@@ -795,13 +1641,165 @@ TEST(domain_validation_l3_requires_l1_l2_private) {
     core_set_add(&domain.cores, 1);
     domain.cache_isolation = CACHE_ISOLATION_L3;
     
-    validation_context_t ctx;
-    validation_result_t result = domain_validate_topology(&domain, &topology, &ctx);
+    validation_context_t ctx = { 0 };
+    validation_result_t result = domain_validate_topology(&domain, topology, &ctx);
     
     /* Should FAIL because L3 isolation requires L1 AND L2 to be private */
     ASSERT_EQ(result, VALIDATION_HARD_FAIL);
 }
 
+/* ========================================================================
+ * GENERATED TOPOLOGY TESTS (Production-Scale Shapes)
+ * ========================================================================
+ */
+
+/* Generated topologies are large; keep them out of test stack frames */
+static boot_facts_t     generated_boot;
+static topology_state_t generated_topology;
+
+static bool generate_sealed_topology(topology_gen_preset_t preset) {
+    topology_gen_spec_t spec = topology_gen_preset(preset);
+    
+    if (!topology_generate(&spec, &generated_boot, &generated_topology)) {
+        return false;
+    }
+    
+    topology_validation_context_t ctx;
+    topology_validate(&generated_topology, &ctx);
+    if (!topology_validation_allows_boot(&ctx)) {
+        return false;
+    }
+    
+    return topology_seal(&generated_topology);
+}
+
+/* One thread per physical core on a node (generator: physical = l1_domain) */
+static void add_node_primary_threads(core_set_t *set, numa_node_t node) {
+    for (core_id_t core = 0; core < generated_topology.core_count; core++) {
+        const core_geometry_t *geom = &generated_topology.cores[core];
+        
+        if (geom->numa_node == node &&
+            (!geom->has_smt || geom->smt_sibling > core)) {
+            core_set_add(set, core);
+        }
+    }
+}
+
+TEST(generated_topologies_validate_and_seal) {
+    for (uint32_t p = 0; p < TOPOLOGY_GEN_PRESET_COUNT; p++) {
+        topology_gen_spec_t spec = topology_gen_preset(p);
+        
+        ASSERT_TRUE(generate_sealed_topology(p));
+        ASSERT_EQ(generated_topology.core_count, topology_gen_cpu_count(&spec));
+        ASSERT_EQ(generated_topology.numa_node_count, topology_gen_node_count(&spec));
+        
+        uint32_t node_cores = 0;
+        for (uint32_t n = 0; n < generated_topology.numa_node_count; n++) {
+            node_cores += generated_topology.numa_nodes[n].core_count;
+        }
+        ASSERT_EQ(node_cores, generated_topology.core_count);
+    }
+}
+
+TEST(generated_max_topology_fills_core_limit) {
+    topology_gen_spec_t spec = topology_gen_preset(TOPOLOGY_GEN_MAX);
+    ASSERT_EQ(topology_gen_cpu_count(&spec), MAX_CORES);
+    
+    spec.sockets++;
+    ASSERT_FALSE(topology_generate(&spec, &generated_boot, &generated_topology));
+}
+
+TEST(generated_nps4_numa_local_domain_per_node) {
+    ASSERT_TRUE(generate_sealed_topology(TOPOLOGY_GEN_SERVER_2S_NPS4));
+    ASSERT_EQ(generated_topology.numa_node_count, 8);
+    
+    for (numa_node_t node = 0; node < generated_topology.numa_node_count; node++) {
+        security_domain_t domain = create_valid_domain();
+        core_set_clear(&domain.cores);
+        add_node_primary_threads(&domain.cores, node);
+        
+        validation_context_t ctx = { 0 };
+        validation_result_t result =
+            domain_validate_topology(&domain, &generated_topology, &ctx);
+        
+        ASSERT_EQ(result, VALIDATION_ACCEPT);
+    }
+    
+    /* Adding a core from the neighbouring quadrant breaks locality */
+    security_domain_t domain = create_valid_domain();
+    core_set_clear(&domain.cores);
+    add_node_primary_threads(&domain.cores, 0);
+    add_node_primary_threads(&domain.cores, 1);
+    
+    validation_context_t ctx = { 0 };
+    validation_result_t result =
+        domain_validate_topology(&domain, &generated_topology, &ctx);
+    
+    ASSERT_EQ(result, VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_NUMA_CONSTRAINT_VIOLATED);
+}
+
+TEST(generated_hybrid_efficiency_cluster_shares_l2) {
+    ASSERT_TRUE(generate_sealed_topology(TOPOLOGY_GEN_CLIENT_HYBRID));
+    
+    /* 8 P-cores x 2 threads (0-15), then 16 E-cores (16-31) */
+    ASSERT_EQ(generated_topology.core_count, 32);
+    ASSERT_FALSE(generated_topology.symmetric);
+    ASSERT_EQ(topology_get_cache_isolation(&generated_topology, 16, 19),
+              CACHE_ISOLATED_L2);
+    ASSERT_EQ(topology_get_cache_isolation(&generated_topology, 16, 20),
+              CACHE_ISOLATED_L3);
+    
+    security_domain_t domain = create_valid_domain();
+    core_set_clear(&domain.cores);
+    core_set_add(&domain.cores, 16);
+    core_set_add(&domain.cores, 17);
+    
+    validation_context_t ctx = { 0 };
+    ASSERT_EQ(domain_validate_topology(&domain, &generated_topology, &ctx),
+              VALIDATION_HARD_FAIL);
+    
+    core_set_clear(&domain.cores);
+    core_set_add(&domain.cores, 0);
+    core_set_add(&domain.cores, 2);
+    
+    ASSERT_EQ(domain_validate_topology(&domain, &generated_topology, &ctx),
+              VALIDATION_ACCEPT);
+}
+
+TEST(generated_max_isolation_collision_reported_once) {
+    ASSERT_TRUE(generate_sealed_topology(TOPOLOGY_GEN_MAX));
+    
+    security_domain_t domain = create_valid_domain();
+    domain.numa_local = false;
+    core_set_clear(&domain.cores);
+    add_node_primary_threads(&domain.cores, 0);
+    
+    validation_context_t ctx = { 0 };   /* Per-domain validators accumulate */
+    ASSERT_EQ(domain_validate_topology(&domain, &generated_topology, &ctx),
+              VALIDATION_ACCEPT);
+    
+    /* Highest core's SMT sibling shares its L1: one collision, one error */
+    const core_geometry_t *last =
+        &generated_topology.cores[generated_topology.core_count - 1];
+    ASSERT_TRUE(last->has_smt);
+    core_set_add(&domain.cores, generated_topology.core_count - 1);
+    core_set_add(&domain.cores, last->smt_sibling);
+    
+    ASSERT_EQ(domain_validate_topology(&domain, &generated_topology, &ctx),
+              VALIDATION_HARD_FAIL);
+    ASSERT_EQ(ctx.error_count, 1);
+    ASSERT_EQ(ctx.errors[0], VALIDATION_ERROR_CACHE_ISOLATION_UNSATISFIABLE);
+}
+
+TEST(generated_asymmetric_distances_warn_only) {
+    ASSERT_TRUE(generate_sealed_topology(TOPOLOGY_GEN_ASYMMETRIC_4S));
+    
+    const numa_node_info_t *nodes = generated_topology.numa_nodes;
+    ASSERT_NE(nodes[0].distance[3], nodes[3].distance[0]);
+    ASSERT_TRUE(nodes[0].distance[3] > nodes[0].distance[1]);
+}
+
 /* ========================================================================
  * TEST RUNNER (Updated)
  * ========================================================================
@@ -821,6 +1819,17 @@ int main(void) {
     run_test_field_validation_rejects_undefined_cache_isolation();
     run_test_field_validation_rejects_undefined_memory_type();
     
+    /* Core set tests */
+    run_test_core_set_tracks_used_words();
+    run_test_core_set_count_ignores_duplicates();
+    run_test_core_set_overlap_uses_narrower_set();
+    run_test_core_set_iteration_visits_members_in_order();
+    run_test_core_set_algebra_recomputes_words_and_count();
+    run_test_core_set_subset_checks_every_word();
+    run_test_core_set_lookup_first_next_nth();
+    run_test_core_set_range_spans_word_boundary();
+    run_test_core_set_word_kernels_match_scalar();
+    
     /* Boot validation tests */
     run_test_boot_validation_accepts_valid_cores();
     run_test_boot_validation_rejects_nonexistent_core();
@@ -833,6 +1842,8 @@ int main(void) {
     run_test_topology_validation_rejects_unsatisfiable_l3_isolation();
     run_test_topology_validation_accepts_numa_local_on_same_node();
     run_test_topology_validation_rejects_numa_local_on_different_nodes();
+    run_test_field_validation_rejects_implicit_memory_tier();
+    run_test_topology_validation_rejects_unavailable_memory_tier();
     
     /* Cache isolation matrix tests (NEW - Critical gap filled) */
     run_test_cache_isolation_matrix_self_core();
@@ -840,12 +1851,22 @@ int main(void) {
     run_test_cache_isolation_matrix_l1_l2_private();
     run_test_cache_isolation_matrix_full_isolation();
     run_test_cache_isolation_matrix_all_shared();
+    run_test_cache_isolation_matrix_smt_siblings_share_l1();
     run_test_cache_isolation_matrix_symmetry();
+    run_test_cache_isolation_row_kernel_matches_scalar();
     
     /* Cumulative cache isolation validation tests (NEW) */
     run_test_domain_validation_l2_requires_l1_private();
     run_test_domain_validation_l3_requires_l1_l2_private();
     
+    /* Generated topology tests */
+    run_test_generated_topologies_validate_and_seal();
+    run_test_generated_max_topology_fills_core_limit();
+    run_test_generated_nps4_numa_local_domain_per_node();
+    run_test_generated_hybrid_efficiency_cluster_shares_l2();
+    run_test_generated_max_isolation_collision_reported_once();
+    run_test_generated_asymmetric_distances_warn_only();
+    
     /* Dependency validation tests */
     run_test_dependency_validation_accepts_valid_dependencies();
     run_test_dependency_validation_rejects_self_dependency();
@@ -854,14 +1875,32 @@ int main(void) {
     /* Graph validation tests */
     run_test_graph_validation_accepts_non_overlapping_cores();
     run_test_graph_validation_rejects_overlapping_cores();
+    run_test_graph_validation_attributes_each_overlapping_pair();
     run_test_graph_validation_accepts_acyclic_dependencies();
     run_test_graph_validation_rejects_circular_dependencies();
+    run_test_graph_validation_reports_each_cycle();
+    run_test_graph_validation_records_startup_order();
+    run_test_graph_index_finds_sparse_ids();
+    run_test_graph_index_falls_back_when_filled_in_place();
+    run_test_graph_validation_rejects_duplicate_ids();
     
     /* Full validation tests */
     run_test_full_validation_accepts_valid_configuration();
     run_test_full_validation_rejects_incomplete_domain();
     run_test_sealing_succeeds_after_validation();
     run_test_sealing_fails_without_validation();
+    run_test_sealing_builds_transitive_access();
+    run_test_sealing_packs_hot_records();
+    
+    /* Parallel validation tests */
+    run_test_parallel_validation_matches_serial();
+    run_test_parallel_validation_accepts_valid_graph();    
+    /* Incremental revalidation tests */
+    run_test_revalidate_reports_and_clears_overlap();
+    run_test_revalidate_reports_cycle_through_edited_domain();
+    run_test_revalidate_keeps_other_domains_failures();
+    run_test_revalidate_rejects_unknown_and_sealed();
+    run_test_revalidate_falls_back_to_full_validation();
     
     /* Summary */
     printf("\n=================================================\n");
@@ -0,0 +1,150 @@
+/**
+ * tests/timing/bench_config_parse.c
+ *
+ * Domain layout parser benchmark
+ *
+ * PURPOSE:
+ *   Boot parses config/domain_layout.yaml on every start, so the parser
+ *   sits on the boot critical path. Time config_parse_domains() on
+ *   generated layouts up to MAX_DOMAINS, commented the way the shipped
+ *   file is, and confirm every domain lands in the graph. The binary
+ *   image of the same graph is timed alongside for comparison.
+ *
+ * STAGES (best of BENCH_ITERATIONS, per layout size):
+ *   - parse:    config_parse_domains() into a fresh graph
+ *   - ns/dom:   parse time per domain
+ *   - load:     config_binary_load() of the encoded graph
+ */
+
+#include "../../domains/domain_contract.h"
+#include "../../config/config_contract.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ITERATIONS 64
+
+static const uint32_t bench_sizes[] = { 1, 8, 32, MAX_DOMAINS };
+
+static char           bench_text[MAX_DOMAINS * 512];
+static uint8_t        bench_image[CONFIG_BINARY_MAX_SIZE];
+static domain_graph_t bench_graph;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* One domain per 4 cores, each depending on its predecessor */
+static size_t generate_layout(uint32_t count) {
+    size_t length = 0;
+
+    length += (size_t)snprintf(bench_text + length, sizeof(bench_text) - length,
+                               "# Generated benchmark layout\n"
+                               "domains:\n");
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t first = i * 4;
+
+        length += (size_t)snprintf(
+            bench_text + length, sizeof(bench_text) - length,
+            "  # Domain %u\n"
+            "  - id: %u\n"
+            "    name: \"domain_%u\"\n"
+            "    security_level: %u        # 0..7\n"
+            "    preemption: %s\n"
+            "    cores: [%u, %u, %u, %u]\n"
+            "    cache_isolation: l3\n"
+            "    memory_type: isolated\n"
+            "    numa_local: true\n"
+            "    memory_tier: local\n",
+            i, i, i, i % 8, (i % 2) ? "by_higher" : "never",
+            first, first + 1, first + 2, first + 3);
+
+        if (i == 0) {
+            length += (size_t)snprintf(bench_text + length, sizeof(bench_text) - length,
+                                       "    dependencies: []\n\n");
+        } else {
+            length += (size_t)snprintf(bench_text + length, sizeof(bench_text) - length,
+                                       "    dependencies: [%u]\n\n", i - 1);
+        }
+    }
+
+    return length;
+}
+
+static uint64_t time_parse(size_t length, uint32_t count, bool *ok) {
+    config_parse_status_t status;
+    domain_graph_init(&bench_graph, NULL, NULL);
+
+    uint64_t start = now_ns();
+    bool parsed = config_parse_domains(bench_text, length, &bench_graph, &status);
+    uint64_t elapsed = now_ns() - start;
+
+    *ok = parsed && bench_graph.domain_count == count &&
+          bench_graph.domains[count - 1].cores.count == 4 &&
+          bench_graph.domains[count - 1].memory_tier_explicit;
+    return elapsed;
+}
+
+static uint64_t time_load(size_t size, uint32_t count, bool *ok) {
+    config_binary_status_t status;
+    domain_graph_init(&bench_graph, NULL, NULL);
+
+    uint64_t start = now_ns();
+    bool loaded = config_binary_load(bench_image, size, &bench_graph, &status);
+    uint64_t elapsed = now_ns() - start;
+
+    *ok = loaded && bench_graph.domain_count == count &&
+          bench_graph.domains[count - 1].cores.count == 4 &&
+          bench_graph.domains[count - 1].memory_tier_explicit;
+    return elapsed;
+}
+
+static uint64_t min_u64(uint64_t a, uint64_t b) {
+    return a < b ? a : b;
+}
+
+int main(void) {
+    int status = 0;
+
+    printf("=================================================\n");
+    printf("UCQCF Domain Layout Parse Benchmark (MAX_DOMAINS=%u)\n", MAX_DOMAINS);
+    printf("=================================================\n\n");
+    printf("%8s %8s %12s %12s %8s %12s %4s\n", "domains", "bytes", "parse (ns)",
+           "ns/dom", "image", "load (ns)", "ok");
+
+    for (uint32_t s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); s++) {
+        uint32_t count = bench_sizes[s];
+        size_t length = generate_layout(count);
+        uint64_t parse_ns = UINT64_MAX, load_ns = UINT64_MAX;
+        size_t image_size = 0;
+        bool ok = true;
+
+        for (uint32_t iter = 0; iter < BENCH_ITERATIONS && ok; iter++) {
+            parse_ns = min_u64(parse_ns, time_parse(length, count, &ok));
+        }
+
+        if (ok) {
+            config_binary_status_t encode;
+            image_size = config_binary_encode(&bench_graph, bench_image,
+                                              sizeof(bench_image), &encode);
+            ok = image_size != 0;
+        }
+
+        for (uint32_t iter = 0; iter < BENCH_ITERATIONS && ok; iter++) {
+            load_ns = min_u64(load_ns, time_load(image_size, count, &ok));
+        }
+
+        if (!ok) {
+            status = 1;
+        }
+
+        printf("%8u %8zu %12lu %12lu %8zu %12lu %4s\n", count, length, parse_ns,
+               parse_ns / count, image_size, load_ns, ok ? "yes" : "NO");
+    }
+
+    printf("\n");
+    return status;
+}
@@ -0,0 +1,212 @@
+/**
+ * tests/timing/bench_domain_queries.c
+ *
+ * Domain query path benchmark (cold records vs sealed hot table)
+ *
+ * PURPOSE:
+ *   Scheduler and access checks run against the sealed graph for the
+ *   life of the system. Time the same all-pairs query mix answered from
+ *   the construction records (security_domain_t plus the access
+ *   matrix) and from the packed domain_hot_t lines, at MAX_DOMAINS.
+ *
+ * APPROACH:
+ *   One graph's records fit in L1, which hides any layout effect, so
+ *   BENCH_GRAPHS sealed copies are queried in interleaved order: every
+ *   query lands in a different graph. The cold working set is then
+ *   larger than L2; the hot one is BENCH_GRAPHS x MAX_DOMAINS lines.
+ *   Both stages run on the same sealed graphs and resolve IDs through
+ *   the same index; only the records they read differ.
+ *
+ * STAGES (best of BENCH_ITERATIONS, all ordered domain pairs x graphs):
+ *   - cold:     domain_graph_get() records + graph->access_direct[]
+ *   - hot:      domain_graph_hot() records
+ *
+ * Each query reads both domains' cores (isolated?), the target's
+ * security level and preemption, and the source's direct access row.
+ */
+
+#include "../../topology/topology_contract.h"
+#include "../../domains/domain_contract.h"
+#include "../topology/topology_generator.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ITERATIONS       8
+#define BENCH_CORES_PER_DOMAIN 4
+#define BENCH_GRAPHS           256   /* ~7 MB of graphs */
+
+static boot_facts_t     bench_boot;
+static topology_state_t bench_topology;
+static domain_graph_t   bench_graphs[BENCH_GRAPHS];
+
+/* Defeats dead-code elimination of query results */
+static volatile uint64_t bench_sink;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Chain of domains over consecutive cores, each depending on the last;
+ * sealed once, then copied (graphs hold no pointers into themselves) */
+static bool build_graphs(uint32_t *count) {
+    topology_gen_spec_t spec = topology_gen_preset(TOPOLOGY_GEN_MAX);
+    spec.isolated = true;
+
+    topology_validation_context_t topo_ctx;
+    if (!topology_generate(&spec, &bench_boot, &bench_topology)) {
+        return false;
+    }
+    topology_validate(&bench_topology, &topo_ctx);
+    if (!topology_validation_allows_boot(&topo_ctx) || !topology_seal(&bench_topology)) {
+        return false;
+    }
+
+    domain_graph_t *graph = &bench_graphs[0];
+    domain_graph_init(graph, &bench_boot, &bench_topology);
+
+    uint32_t domains = bench_topology.core_count / BENCH_CORES_PER_DOMAIN;
+    if (domains > MAX_DOMAINS) {
+        domains = MAX_DOMAINS;
+    }
+
+    for (uint32_t i = 0; i < domains; i++) {
+        security_domain_t domain;
+        memset(&domain, 0, sizeof(domain));
+
+        domain.id = 100 + i;
+        snprintf(domain.name, sizeof(domain.name), "domain_%u", i);
+        domain.name_explicit = true;
+        domain.security_level = (security_level_t)(SECURITY_LEVEL_0 + i % 8);
+        domain.preemption = PREEMPTION_BY_HIGHER;
+        domain.cache_isolation = CACHE_ISOLATION_NONE;
+        domain.memory_type = MEMORY_DOMAIN_ISOLATED;
+        domain.numa_local = false;
+        domain.numa_local_explicit = true;
+
+        core_set_from_range(&domain.cores, i * BENCH_CORES_PER_DOMAIN,
+                            BENCH_CORES_PER_DOMAIN);
+        dependency_set_clear(&domain.dependencies);
+        if (i > 0) {
+            dependency_set_add(&domain.dependencies, 100 + i - 1);
+        }
+
+        if (!domain_graph_add(graph, &domain)) {
+            return false;
+        }
+    }
+
+    validation_context_t ctx;
+    if (domain_graph_validate(graph, &ctx) == VALIDATION_HARD_FAIL ||
+        !domain_graph_seal(graph)) {
+        return false;
+    }
+
+    for (uint32_t g = 1; g < BENCH_GRAPHS; g++) {
+        bench_graphs[g] = *graph;
+    }
+
+    *count = domains;
+    return true;
+}
+
+static uint64_t time_cold(uint32_t count) {
+    uint64_t start = now_ns();
+    uint64_t acc = 0;
+
+    for (domain_id_t a = 100; a < 100 + count; a++) {
+        for (domain_id_t b = 100; b < 100 + count; b++) {
+            for (uint32_t g = 0; g < BENCH_GRAPHS; g++) {
+                const domain_graph_t *graph = &bench_graphs[g];
+                const security_domain_t *da = domain_graph_get(graph, a);
+                const security_domain_t *db = domain_graph_get(graph, b);
+                uint32_t j = domain_graph_index_of(graph, b);
+
+                acc += !core_set_overlaps(&da->cores, &db->cores);
+                acc += db->security_level + db->preemption;
+                acc += (graph->access_direct[domain_graph_index_of(graph, a)] >> j) & 1;
+            }
+        }
+    }
+
+    bench_sink = acc;
+    return now_ns() - start;
+}
+
+static uint64_t time_hot(uint32_t count) {
+    uint64_t start = now_ns();
+    uint64_t acc = 0;
+
+    for (domain_id_t a = 100; a < 100 + count; a++) {
+        for (domain_id_t b = 100; b < 100 + count; b++) {
+            for (uint32_t g = 0; g < BENCH_GRAPHS; g++) {
+                const domain_graph_t *graph = &bench_graphs[g];
+                const domain_hot_t *ha = domain_graph_hot(graph, a);
+                const domain_hot_t *hb = domain_graph_hot(graph, b);
+                uint32_t j = domain_graph_index_of(graph, b);
+
+                uint32_t words = ha->core_words < hb->core_words ? ha->core_words
+                                                                 : hb->core_words;
+                bool shared = false;
+                for (uint32_t w = 0; w < words; w++) {
+                    shared |= (ha->cores[w] & hb->cores[w]) != 0;
+                }
+
+                acc += !shared;
+                acc += hb->security_level + hb->preemption;
+                acc += (ha->access_direct >> j) & 1;
+            }
+        }
+    }
+
+    bench_sink = acc;
+    return now_ns() - start;
+}
+
+static uint64_t min_u64(uint64_t a, uint64_t b) {
+    return a < b ? a : b;
+}
+
+int main(void) {
+    uint32_t count = 0;
+
+    printf("=================================================\n");
+    printf("UCQCF Domain Query Benchmark (MAX_DOMAINS=%u, %u graphs)\n",
+           MAX_DOMAINS, BENCH_GRAPHS);
+    printf("=================================================\n\n");
+
+    if (!build_graphs(&count) || count < 2) {
+        printf("Graph construction failed\n\n");
+        return 1;
+    }
+
+    uint64_t cold_ns = UINT64_MAX, hot_ns = UINT64_MAX;
+    uint64_t cold_sum, hot_sum;
+
+    for (uint32_t iter = 0; iter < BENCH_ITERATIONS; iter++) {
+        cold_ns = min_u64(cold_ns, time_cold(count));
+    }
+    cold_sum = bench_sink;
+
+    for (uint32_t iter = 0; iter < BENCH_ITERATIONS; iter++) {
+        hot_ns = min_u64(hot_ns, time_hot(count));
+    }
+    hot_sum = bench_sink;
+
+    uint64_t queries = (uint64_t)count * count * BENCH_GRAPHS;
+    bool ok = cold_sum == hot_sum;
+
+    printf("%-6s %8s %12s %14s %10s\n", "path", "bytes", "working set",
+           "queries (ns)", "ns/query");
+    printf("%-6s %8zu %9zu KB %14lu %10.2f\n", "cold", sizeof(security_domain_t),
+           (size_t)BENCH_GRAPHS * count * sizeof(security_domain_t) / 1024,
+           cold_ns, (double)cold_ns / (double)queries);
+    printf("%-6s %8zu %9zu KB %14lu %10.2f\n", "hot", sizeof(domain_hot_t),
+           (size_t)BENCH_GRAPHS * count * sizeof(domain_hot_t) / 1024,
+           hot_ns, (double)hot_ns / (double)queries);
+    printf("\nAnswers match: %s\n\n", ok ? "yes" : "NO");
+
+    return ok ? 0 : 1;
+}
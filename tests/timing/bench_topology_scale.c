@@ -0,0 +1,175 @@
+/**
+ * tests/timing/bench_topology_scale.c
+ *
+ * Topology and domain validation benchmark at production scale
+ *
+ * PURPOSE:
+ *   Time the validation and query paths on generated machine shapes
+ *   (toy through MAX_CORES), so regressions show up at the core counts
+ *   we actually deploy on rather than only on the 16-core fixture.
+ *
+ * STAGES (best of BENCH_ITERATIONS, per preset):
+ *   - seal:     topology_validate() + topology_seal()
+ *   - pairs:    all-pairs cache isolation + same-NUMA-node queries
+ *   - nearest:  topology_nearest_cores() from every core
+ *   - domains:  domain_validate_topology() for one NUMA-local domain
+ *               per node (one core per L2 instance)
+ */
+
+#include "../../topology/topology_contract.h"
+#include "../../domains/domain_contract.h"
+#include "../topology/topology_generator.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ITERATIONS 8
+#define BENCH_NEAREST_K  16
+
+static boot_facts_t     bench_boot;
+static topology_state_t bench_topology;
+static core_id_t        bench_nearest[BENCH_NEAREST_K];
+
+/* Defeats dead-code elimination of query results */
+static volatile uint64_t bench_sink;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static bool generate_and_seal(const topology_gen_spec_t *spec, uint64_t *elapsed) {
+    if (!topology_generate(spec, &bench_boot, &bench_topology)) {
+        return false;
+    }
+
+    uint64_t start = now_ns();
+
+    topology_validation_context_t ctx;
+    topology_validate(&bench_topology, &ctx);
+    bool sealed = topology_validation_allows_boot(&ctx) &&
+                  topology_seal(&bench_topology);
+
+    *elapsed = now_ns() - start;
+    return sealed;
+}
+
+static uint64_t time_pairs(void) {
+    uint32_t n = bench_topology.core_count;
+    uint64_t start = now_ns();
+    uint64_t acc = 0;
+
+    for (core_id_t a = 0; a < n; a++) {
+        for (core_id_t b = 0; b < n; b++) {
+            acc += topology_get_cache_isolation(&bench_topology, a, b);
+            acc += topology_same_numa_node(&bench_topology, a, b);
+        }
+    }
+
+    bench_sink = acc;
+    return now_ns() - start;
+}
+
+static uint64_t time_nearest(void) {
+    uint32_t n = bench_topology.core_count;
+    uint64_t start = now_ns();
+    uint64_t acc = 0;
+
+    for (core_id_t core = 0; core < n; core++) {
+        acc += topology_nearest_cores(&bench_topology, core, CACHE_ISOLATED_L3,
+                                      NULL, bench_nearest, BENCH_NEAREST_K);
+    }
+
+    bench_sink = acc;
+    return now_ns() - start;
+}
+
+static uint64_t time_domains(bool *accepted) {
+    uint64_t elapsed = 0;
+    *accepted = true;
+
+    for (numa_node_t node = 0; node < bench_topology.numa_node_count; node++) {
+        security_domain_t domain;
+        memset(&domain, 0, sizeof(domain));
+        domain.cache_isolation = CACHE_ISOLATION_L2;
+        domain.numa_local = true;
+        domain.numa_local_explicit = true;
+        core_set_clear(&domain.cores);
+
+        /* First core of each L2 instance satisfies L2 isolation */
+        core_mask_t l2_seen = { 0 };
+
+        for (core_id_t core = 0; core < bench_topology.core_count; core++) {
+            const core_geometry_t *geom = &bench_topology.cores[core];
+
+            if (geom->numa_node == node &&
+                !core_mask_test(&l2_seen, geom->l2_domain)) {
+                core_mask_set(&l2_seen, geom->l2_domain);
+                core_set_add(&domain.cores, core);
+            }
+        }
+
+        validation_context_t ctx;
+        uint64_t start = now_ns();
+        validation_result_t result =
+            domain_validate_topology(&domain, &bench_topology, &ctx);
+        elapsed += now_ns() - start;
+
+        if (result != VALIDATION_ACCEPT) {
+            *accepted = false;
+        }
+    }
+
+    return elapsed;
+}
+
+static uint64_t min_u64(uint64_t a, uint64_t b) {
+    return a < b ? a : b;
+}
+
+int main(void) {
+    int status = 0;
+
+    printf("=================================================\n");
+    printf("UCQCF Topology Scale Benchmark (MAX_CORES=%u)\n", MAX_CORES);
+    printf("=================================================\n\n");
+    printf("%-16s %6s %6s %12s %12s %12s %12s %4s\n",
+           "shape", "cpus", "nodes", "seal (ns)", "pairs (ns)",
+           "nearest (ns)", "domains (ns)", "ok");
+
+    for (uint32_t p = 0; p < TOPOLOGY_GEN_PRESET_COUNT; p++) {
+        topology_gen_spec_t spec = topology_gen_preset(p);
+        uint64_t seal_ns = UINT64_MAX, pairs_ns = UINT64_MAX;
+        uint64_t nearest_ns = UINT64_MAX, domains_ns = UINT64_MAX;
+        bool ok = true;
+
+        for (uint32_t iter = 0; iter < BENCH_ITERATIONS && ok; iter++) {
+            uint64_t elapsed;
+            bool accepted;
+
+            if (!generate_and_seal(&spec, &elapsed)) {
+                ok = false;
+                break;
+            }
+
+            seal_ns = min_u64(seal_ns, elapsed);
+            pairs_ns = min_u64(pairs_ns, time_pairs());
+            nearest_ns = min_u64(nearest_ns, time_nearest());
+            domains_ns = min_u64(domains_ns, time_domains(&accepted));
+            ok = accepted;
+        }
+
+        if (!ok) {
+            status = 1;
+        }
+
+        printf("%-16s %6u %6u %12lu %12lu %12lu %12lu %4s\n",
+               topology_gen_preset_string(p),
+               topology_gen_cpu_count(&spec), topology_gen_node_count(&spec),
+               seal_ns, pairs_ns, nearest_ns, domains_ns, ok ? "yes" : "NO");
+    }
+
+    printf("\n");
+    return status;
+}
@@ -0,0 +1,376 @@
+/**
+ * tests/topology/test_topology_import.c
+ *
+ * Offline topology import tests
+ *
+ * PURPOSE:
+ *   Prove that a sysfs snapshot imports into the same topology facts
+ *   the live probe would produce, and that the result validates and
+ *   seals exactly as it would at boot, and that domain layouts are
+ *   checked against the imported hardware.
+ *
+ * APPROACH:
+ *   - Build a ustar image in memory (8 CPUs, SMT-2, 2 NUMA nodes)
+ *   - Import, validate and seal; check geometry against the files
+ *   - Corrupt the image and check the reported error and path
+ *   - Parse layouts against the imported topology and validate them
+ */
+
+#include "../../topology/topology_contract.h"
+#include "../../domains/domain_contract.h"
+#include "../../config/config_contract.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test result tracking */
+static uint32_t tests_run = 0;
+static uint32_t tests_passed = 0;
+static uint32_t tests_failed = 0;
+
+#define TEST(name) \
+    static void test_##name(void); \
+    static void run_test_##name(void) { \
+        printf("Running: %s ... ", #name); \
+        tests_run++; \
+        uint32_t failed_before = tests_failed; \
+        test_##name(); \
+        if (tests_failed == failed_before) { \
+            tests_passed++; \
+            printf("PASS\n"); \
+        } \
+    } \
+    static void test_##name(void)
+
+#define ASSERT(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL at %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            tests_failed++; \
+            return; \
+        } \
+    } while (0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NE(a, b) ASSERT((a) != (b))
+#define ASSERT_TRUE(x) ASSERT(x)
+#define ASSERT_FALSE(x) ASSERT(!(x))
+
+/* ========================================================================
+ * TEST FIXTURES
+ * ========================================================================
+ */
+
+#define IMAGE_SIZE (256 * 1024)
+
+static uint8_t          image[IMAGE_SIZE];
+static size_t           image_size;
+static topology_tar_t   fixture_tar;
+static boot_facts_t     fixture_boot;
+static topology_state_t fixture_topology;
+static domain_graph_t   fixture_graph;
+
+/* Append one ustar member under "system/" */
+static void tar_add(const char *path, const char *contents) {
+    uint8_t *header = image + image_size;
+    size_t length = strlen(contents);
+
+    memset(header, 0, 512);
+    snprintf((char *)header, 100, "system/%s", path);
+    snprintf((char *)header + 100, 8, "%07o", 0644);
+
+    /* Size: 11 octal digits (members here are far below 8^11 bytes) */
+    char size[12];
+    snprintf(size, sizeof(size), "%011lo", (unsigned long)(length % 0100000000000UL));
+    memcpy(header + 124, size, 11);
+
+    header[156] = '0';
+    memcpy(header + 257, "ustar", 6);
+    memcpy(header + 263, "00", 2);
+
+    uint32_t sum = 0;
+    memset(header + 148, ' ', 8);
+    for (uint32_t i = 0; i < 512; i++) {
+        sum += header[i];
+    }
+    snprintf((char *)header + 148, 8, "%06o", sum & 0777777);   /* <= 512 * 255 */
+
+    memcpy(header + 512, contents, length);
+    image_size += 512 + (length + 511) / 512 * 512;
+}
+
+static void tar_finish(void) {
+    memset(image + image_size, 0, 1024);
+    image_size += 1024;
+}
+
+/**
+ * 8 CPUs, SMT pairs (0,1) (2,3) ..., 2 NUMA nodes (0-3, 4-7)
+ * L1 and L2 per physical core, L3 per node; CPUs 2-7 isolated
+ */
+static void build_snapshot(const char *skip) {
+    char path[96], text[64];
+    image_size = 0;
+
+    tar_add("cpu/online", "0-7\n");
+    tar_add("cpu/isolated", "2-7\n");
+    tar_add("cpuinfo", "processor\t: 0\nflags\t\t: fpu sse2 aes rdrand rdseed\n");
+
+    for (uint32_t cpu = 0; cpu < 8; cpu++) {
+        uint32_t pair = cpu & ~1u;
+        uint32_t node = cpu / 4;
+
+        static const struct {
+            const char *level, *type, *size;
+        } caches[] = {
+            { "1", "Data",        "48K" },
+            { "1", "Instruction", "32K" },
+            { "2", "Unified",     "2048K" },
+            { "3", "Unified",     "32M" },
+        };
+
+        snprintf(path, sizeof(path), "cpu/cpu%u/topology/physical_package_id", cpu);
+        if (strcmp(path, skip) != 0) {
+            tar_add(path, "0\n");
+        }
+
+        snprintf(path, sizeof(path), "cpu/cpu%u/topology/thread_siblings_list", cpu);
+        snprintf(text, sizeof(text), "%u-%u\n", pair, pair + 1);
+        tar_add(path, text);
+
+        for (uint32_t index = 0; index < 4; index++) {
+            snprintf(path, sizeof(path), "cpu/cpu%u/cache/index%u/level", cpu, index);
+            tar_add(path, caches[index].level);
+            snprintf(path, sizeof(path), "cpu/cpu%u/cache/index%u/type", cpu, index);
+            tar_add(path, caches[index].type);
+            snprintf(path, sizeof(path), "cpu/cpu%u/cache/index%u/size", cpu, index);
+            tar_add(path, caches[index].size);
+
+            snprintf(path, sizeof(path), "cpu/cpu%u/cache/index%u/shared_cpu_list",
+                     cpu, index);
+            if (index < 3) {
+                snprintf(text, sizeof(text), "%u-%u\n", pair, pair + 1);
+            } else {
+                snprintf(text, sizeof(text), "%u-%u\n", node * 4, node * 4 + 3);
+            }
+            tar_add(path, text);
+        }
+    }
+
+    tar_add("node/online", "0-1\n");
+    tar_add("node/node0/cpulist", "0-3\n");
+    tar_add("node/node0/distance", "10 21\n");
+    tar_add("node/node0/meminfo", "Node 0 MemTotal:       16777216 kB\n");
+    tar_add("node/node1/cpulist", "4-7\n");
+    tar_add("node/node1/distance", "21 10\n");
+    tar_add("node/node1/meminfo", "Node 1 MemTotal:       16777216 kB\n");
+
+    tar_finish();
+}
+
+static bool import_fixture(topology_import_status_t *status) {
+    topology_snapshot_t snapshot;
+
+    return topology_snapshot_tar(&snapshot, &fixture_tar, image, image_size, status) &&
+           topology_import_snapshot(&snapshot, &fixture_boot, &fixture_topology,
+                                    status);
+}
+
+static bool seal_fixture(void) {
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+    return topology_validation_allows_boot(&ctx) && topology_seal(&fixture_topology);
+}
+
+static const char fixture_layout[] =
+    "# two domains, one per node\n"
+    "constraints:\n"
+    "  max_domains: 64\n"
+    "domains:\n"
+    "  - id: 0\n"
+    "    name: \"control\"\n"
+    "    security_level: 7  # highest\n"
+    "    preemption: never\n"
+    "    cores: [2]\n"
+    "    cache_isolation: l2\n"
+    "    memory_type: isolated\n"
+    "    numa_local: true\n"
+    "    memory_tier: local\n"
+    "    dependencies: []\n"
+    "  - id: 1\n"
+    "    name: worker\n"
+    "    security_level: 3\n"
+    "    preemption: by_higher\n"
+    "    cores: [4, 6]\n"
+    "    cache_isolation: l2\n"
+    "    memory_type: shared_read\n"
+    "    numa_local: true\n"
+    "    memory_tier: local\n"
+    "    dependencies: [0]\n";
+
+/* ========================================================================
+ * IMPORT TESTS
+ * ========================================================================
+ */
+
+TEST(import_reads_cpu_and_cache_geometry) {
+    topology_import_status_t status;
+    build_snapshot("");
+
+    ASSERT_TRUE(import_fixture(&status));
+    ASSERT_EQ(status.error, TOPOLOGY_IMPORT_OK);
+    ASSERT_TRUE(seal_fixture());
+
+    ASSERT_EQ(fixture_topology.core_count, 8);
+    ASSERT_EQ(fixture_boot.threads_per_core, 2);
+    ASSERT_TRUE(fixture_boot.smt_enabled);
+
+    const core_geometry_t *c5 = topology_get_core_geometry(&fixture_topology, 5);
+    ASSERT_NE(c5, NULL);
+    ASSERT_EQ(c5->physical_core, 4);
+    ASSERT_EQ(c5->smt_sibling, 4);
+    ASSERT_EQ(c5->l1_domain, 4);
+    ASSERT_EQ(c5->l3_domain, 4);
+    ASSERT_EQ(c5->cache_hierarchy.level_count, 3);   /* L1I skipped */
+    ASSERT_EQ(c5->cache_hierarchy.levels[1].size_bytes, 2048 * 1024);
+    ASSERT_TRUE(c5->isolated);
+    ASSERT_FALSE(fixture_topology.cores[0].isolated);
+
+    /* No cpufreq directory: fixed frequency */
+    ASSERT_TRUE(c5->freq_scaling_disabled);
+
+    ASSERT_EQ(topology_get_cache_isolation(&fixture_topology, 4, 5), CACHE_ISOLATED_L1);
+    ASSERT_EQ(topology_get_cache_isolation(&fixture_topology, 4, 6), CACHE_ISOLATED_L3);
+    ASSERT_EQ(topology_get_cache_isolation(&fixture_topology, 0, 4), CACHE_ISOLATED_FULL);
+}
+
+TEST(import_reads_numa_nodes_and_cpuinfo) {
+    topology_import_status_t status;
+    build_snapshot("");
+
+    ASSERT_TRUE(import_fixture(&status));
+    ASSERT_TRUE(seal_fixture());
+
+    ASSERT_EQ(fixture_topology.numa_node_count, 2);
+    ASSERT_EQ(fixture_boot.numa_nodes, 2);
+    ASSERT_EQ(fixture_topology.numa_nodes[1].memory_mb, 16384);
+    ASSERT_EQ(fixture_topology.cores[6].numa_node, 1);
+    ASSERT_EQ(fixture_topology.cores[6].numa_distance[0], 21);
+    ASSERT_TRUE(topology_same_numa_node(&fixture_topology, 4, 7));
+    ASSERT_FALSE(topology_same_numa_node(&fixture_topology, 3, 4));
+
+    ASSERT_TRUE(fixture_boot.constant_time.aes_ni);
+    ASSERT_TRUE(fixture_boot.constant_time.rdseed);
+}
+
+TEST(import_missing_file_reports_path) {
+    topology_import_status_t status;
+    build_snapshot("cpu/cpu3/topology/physical_package_id");
+
+    ASSERT_FALSE(import_fixture(&status));
+    ASSERT_EQ(status.error, TOPOLOGY_IMPORT_ERROR_MISSING_FILE);
+    ASSERT_EQ(strcmp(status.path, "cpu/cpu3/topology/physical_package_id"), 0);
+}
+
+TEST(import_rejects_corrupt_tar) {
+    topology_import_status_t status;
+    topology_snapshot_t snapshot;
+    build_snapshot("");
+
+    image[512 * 2 + 10] ^= 0x20;   /* Second member's name: checksum now stale */
+
+    ASSERT_FALSE(topology_snapshot_tar(&snapshot, &fixture_tar, image, image_size,
+                                       &status));
+    ASSERT_EQ(status.error, TOPOLOGY_IMPORT_ERROR_TAR_INVALID);
+}
+
+/* ========================================================================
+ * LAYOUT TESTS
+ * ========================================================================
+ */
+
+TEST(layout_validates_against_imported_topology) {
+    topology_import_status_t status;
+    config_parse_status_t parse;
+    validation_context_t ctx;
+    build_snapshot("");
+
+    ASSERT_TRUE(import_fixture(&status));
+    ASSERT_TRUE(seal_fixture());
+
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+    ASSERT_TRUE(config_parse_domains(fixture_layout, sizeof(fixture_layout) - 1,
+                                     &fixture_graph, &parse));
+    ASSERT_EQ(parse.domain_count, 2);
+
+    const security_domain_t *worker = &fixture_graph.domains[1];
+    ASSERT_EQ(strcmp(worker->name, "worker"), 0);
+    ASSERT_EQ(worker->security_level, SECURITY_LEVEL_3);
+    ASSERT_EQ(worker->cores.count, 2);
+    ASSERT_TRUE(dependency_set_contains(&worker->dependencies, 0));
+
+    ASSERT_NE(domain_graph_validate(&fixture_graph, &ctx), VALIDATION_HARD_FAIL);
+}
+
+TEST(layout_rejected_by_imported_cache_geometry) {
+    topology_import_status_t status;
+    config_parse_status_t parse;
+    validation_context_t ctx;
+    build_snapshot("");
+
+    ASSERT_TRUE(import_fixture(&status));
+    ASSERT_TRUE(seal_fixture());
+
+    /* 4 and 5 are SMT siblings: they share L1 and L2 */
+    static const char layout[] =
+        "domains:\n"
+        "  - id: 0\n"
+        "    name: pair\n"
+        "    security_level: 1\n"
+        "    preemption: by_any\n"
+        "    cores: [4, 5]\n"
+        "    cache_isolation: l2\n"
+        "    memory_type: isolated\n"
+        "    numa_local: true\n"
+        "    memory_tier: local\n"
+        "    dependencies: []\n";
+
+    domain_graph_init(&fixture_graph, &fixture_boot, &fixture_topology);
+    ASSERT_TRUE(config_parse_domains(layout, sizeof(layout) - 1, &fixture_graph, &parse));
+    ASSERT_EQ(domain_graph_validate(&fixture_graph, &ctx), VALIDATION_HARD_FAIL);
+}
+
+/* ========================================================================
+ * TEST RUNNER
+ * ========================================================================
+ */
+
+int main(void) {
+    printf("=================================================\n");
+    printf("UCQCF Phase-1 Offline Topology Import Tests\n");
+    printf("=================================================\n\n");
+
+    /* Snapshot import tests */
+    run_test_import_reads_cpu_and_cache_geometry();
+    run_test_import_reads_numa_nodes_and_cpuinfo();
+    run_test_import_missing_file_reports_path();
+    run_test_import_rejects_corrupt_tar();
+
+    /* Layout against imported topology */
+    run_test_layout_validates_against_imported_topology();
+    run_test_layout_rejected_by_imported_cache_geometry();
+
+    /* Summary */
+    printf("\n=================================================\n");
+    printf("Tests run:    %u\n", tests_run);
+    printf("Tests passed: %u\n", tests_passed);
+    printf("Tests failed: %u\n", tests_failed);
+    printf("=================================================\n");
+
+    if (tests_failed == 0) {
+        printf("✓ ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("✗ SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,665 @@
+/**
+ * tests/topology/test_topology_queries.c
+ *
+ * Topology query invariant tests
+ *
+ * PURPOSE:
+ *   Prove that the precomputed placement structures built at seal time
+ *   answer the same questions as the raw per-core facts they summarize.
+ *
+ * APPROACH:
+ *   - Build, validate and seal a known 16-core topology
+ *   - Check every query against hand-derived expectations
+ *
+ * SECURITY PROPERTY:
+ *   If these tests pass, placement decisions made from the sealed
+ *   indexes cannot contradict the cache isolation matrix.
+ */
+
+#include "../../topology/topology_contract.h"
+#include "../../boot/boot_contract.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test result tracking */
+static uint32_t tests_run = 0;
+static uint32_t tests_passed = 0;
+static uint32_t tests_failed = 0;
+
+#define TEST(name) \
+    static void test_##name(void); \
+    static void run_test_##name(void) { \
+        printf("Running: %s ... ", #name); \
+        tests_run++; \
+        uint32_t failed_before = tests_failed; \
+        test_##name(); \
+        if (tests_failed == failed_before) { \
+            tests_passed++; \
+            printf("PASS\n"); \
+        } \
+    } \
+    static void test_##name(void)
+
+#define ASSERT(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL at %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            tests_failed++; \
+            return; \
+        } \
+    } while (0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NE(a, b) ASSERT((a) != (b))
+#define ASSERT_TRUE(x) ASSERT(x)
+#define ASSERT_FALSE(x) ASSERT(!(x))
+
+/* ========================================================================
+ * TEST FIXTURES
+ * ========================================================================
+ */
+
+/* Topology is large; keep fixtures out of the test stack frames */
+static boot_facts_t     fixture_boot;
+static topology_state_t fixture_topology;
+
+/**
+ * 16 cores, 2 NUMA nodes (0-7, 8-15)
+ * L1 private, L2 shared by pairs, L3 shared by groups of 8
+ */
+static void probe_test_topology(topology_state_t *topology) {
+    memset(&fixture_boot, 0, sizeof(fixture_boot));
+    fixture_boot.cpu_count = 16;
+    fixture_boot.numa_nodes = 2;
+    fixture_boot.constant_time_supported = true;
+
+    topology_init(topology, &fixture_boot);
+    topology_probe_all_cores(topology);
+    topology->numa_node_count = 2;
+
+    for (uint32_t i = 0; i < 16; i++) {
+        core_geometry_t *geom = &topology->cores[i];
+        geom->l1_domain = i;
+        geom->l2_domain = i / 2;
+        geom->l3_domain = i / 8;
+        geom->numa_node = i / 8;
+        geom->numa_distance[0] = (i / 8 == 0) ? 10 : 20;
+        geom->numa_distance[1] = (i / 8 == 1) ? 10 : 20;
+        geom->cache_hierarchy.level_count = 3;
+        geom->isolated = true;
+        geom->freq_scaling_disabled = true;
+        geom->supports_constant_time = true;
+    }
+
+    for (uint32_t n = 0; n < 2; n++) {
+        topology->numa_nodes[n].id = n;
+        topology->numa_nodes[n].distance[0] = (n == 0) ? 10 : 20;
+        topology->numa_nodes[n].distance[1] = (n == 1) ? 10 : 20;
+    }
+}
+
+static bool seal_test_topology(topology_state_t *topology) {
+    topology_validation_context_t ctx;
+
+    topology_validate(topology, &ctx);
+    if (!topology_validation_allows_boot(&ctx)) {
+        return false;
+    }
+
+    return topology_seal(topology);
+}
+
+static topology_state_t* create_sealed_topology(void) {
+    probe_test_topology(&fixture_topology);
+    if (!seal_test_topology(&fixture_topology)) {
+        return NULL;
+    }
+    return &fixture_topology;
+}
+
+/* ========================================================================
+ * NEAREST-CORE RANKING TESTS
+ * ========================================================================
+ */
+
+TEST(nearest_cores_requires_sealed_topology) {
+    probe_test_topology(&fixture_topology);
+
+    core_id_t out[4];
+    uint32_t count = topology_nearest_cores(
+        &fixture_topology, 0, CACHE_ISOLATED_NONE, NULL, out, 4);
+
+    ASSERT_EQ(count, 0);
+}
+
+TEST(nearest_cores_orders_by_cache_sharing_then_distance) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    core_id_t out[15];
+    uint32_t count = topology_nearest_cores(
+        topology, 0, CACHE_ISOLATED_NONE, NULL, out, 15);
+
+    ASSERT_EQ(count, 15);
+    ASSERT_EQ(out[0], 1);   /* Shares L2 */
+    for (uint32_t i = 1; i < 7; i++) {
+        ASSERT_EQ(out[i], i + 1);  /* Shares L3, same node */
+    }
+    for (uint32_t i = 7; i < 15; i++) {
+        ASSERT_EQ(out[i], i + 1);  /* Other node */
+    }
+}
+
+TEST(nearest_cores_filters_by_isolation_level) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    core_id_t out[16];
+    uint32_t count = topology_nearest_cores(
+        topology, 0, CACHE_ISOLATED_FULL, NULL, out, 16);
+
+    ASSERT_EQ(count, 8);
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_TRUE(topology_can_isolate_cores(
+            topology, 0, out[i], CACHE_ISOLATED_FULL));
+    }
+
+    count = topology_nearest_cores(
+        topology, 0, CACHE_ISOLATED_L3, NULL, out, 16);
+    ASSERT_EQ(count, 14);
+    ASSERT_EQ(out[0], 2);
+}
+
+TEST(nearest_cores_skips_excluded_cores) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    core_mask_t exclude;
+    memset(&exclude, 0, sizeof(exclude));
+    core_mask_set(&exclude, 1);
+    core_mask_set(&exclude, 2);
+
+    core_id_t out[2];
+    uint32_t count = topology_nearest_cores(
+        topology, 0, CACHE_ISOLATED_NONE, &exclude, out, 2);
+
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(out[0], 3);
+    ASSERT_EQ(out[1], 4);
+}
+
+TEST(nearest_cores_uses_measured_latency_as_tie_break) {
+    probe_test_topology(&fixture_topology);
+
+    /* Core 7 is measurably closest among the L3 peers of core 0 */
+    for (core_id_t peer = 1; peer < 16; peer++) {
+        topology_record_core_latency(&fixture_topology, 0, peer, 100);
+    }
+    topology_record_core_latency(&fixture_topology, 0, 7, 40);
+
+    ASSERT_TRUE(seal_test_topology(&fixture_topology));
+
+    core_id_t out[2];
+    uint32_t count = topology_nearest_cores(
+        &fixture_topology, 0, CACHE_ISOLATED_L3, NULL, out, 2);
+
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(out[0], 7);
+    ASSERT_EQ(out[1], 2);
+
+    /* Latency cannot be recorded after sealing */
+    ASSERT_FALSE(topology_record_core_latency(&fixture_topology, 0, 1, 1));
+}
+
+/* ========================================================================
+ * TOPOLOGY TREE TESTS
+ * ========================================================================
+ */
+
+TEST(tree_levels_are_breadth_first) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    const topology_tree_t *tree = &topology->tree;
+
+    /* 1 machine, 1 package, 1 die, 2 L3, 8 L2, 16 cores, 16 threads */
+    ASSERT_EQ(tree->node_count, 45);
+    ASSERT_EQ(tree->level_start[TOPOLOGY_LEVEL_L3], 3);
+    ASSERT_EQ(tree->level_start[TOPOLOGY_LEVEL_L2], 5);
+    ASSERT_EQ(tree->level_start[TOPOLOGY_LEVEL_THREAD], 29);
+
+    for (uint32_t i = 0; i < tree->node_count; i++) {
+        const topology_node_t *node = topology_tree_node(topology, i);
+        ASSERT_TRUE(node != NULL);
+
+        for (uint32_t c = 0; c < node->child_count; c++) {
+            const topology_node_t *child =
+                topology_tree_node(topology, node->first_child + c);
+            ASSERT_EQ(child->parent, i);
+            ASSERT_EQ(child->level, node->level + 1);
+        }
+    }
+}
+
+TEST(tree_cpus_under_l3_are_contiguous) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    topology_cpu_range_t l3 = topology_cpu_siblings(
+        topology, 9, TOPOLOGY_LEVEL_L3);
+
+    ASSERT_EQ(l3.count, 8);
+    for (uint32_t i = 0; i < l3.count; i++) {
+        ASSERT_EQ(l3.cpus[i], 8 + i);
+        ASSERT_EQ(topology->cores[l3.cpus[i]].l3_domain, 1);
+    }
+}
+
+TEST(tree_siblings_match_cache_domains) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    topology_cpu_range_t l2 = topology_cpu_siblings(
+        topology, 5, TOPOLOGY_LEVEL_L2);
+    ASSERT_EQ(l2.count, 2);
+    ASSERT_EQ(l2.cpus[0], 4);
+    ASSERT_EQ(l2.cpus[1], 5);
+
+    topology_cpu_range_t thread = topology_cpu_siblings(
+        topology, 5, TOPOLOGY_LEVEL_CORE);
+    ASSERT_EQ(thread.count, 1);
+    ASSERT_EQ(thread.cpus[0], 5);
+
+    topology_cpu_range_t machine = topology_cpu_siblings(
+        topology, 5, TOPOLOGY_LEVEL_MACHINE);
+    ASSERT_EQ(machine.count, 16);
+}
+
+TEST(tree_requires_sealed_topology) {
+    probe_test_topology(&fixture_topology);
+
+    ASSERT_EQ(topology_cpu_ancestor(&fixture_topology, 0, TOPOLOGY_LEVEL_L3),
+              TOPOLOGY_NODE_INVALID);
+    ASSERT_EQ(topology_cpu_siblings(&fixture_topology, 0,
+                                    TOPOLOGY_LEVEL_L3).count, 0);
+}
+
+/* ========================================================================
+ * FREQUENCY CALIBRATION TESTS
+ * ========================================================================
+ */
+
+static void record_uniform_frequencies(uint32_t mhz) {
+    for (core_id_t core = 0; core < 16; core++) {
+        for (uint32_t s = 0; s < 3; s++) {
+            core_frequency_sample_t sample = { .effective_mhz = mhz + s };
+            topology_record_core_frequency(&fixture_topology, core, &sample);
+        }
+    }
+}
+
+static bool context_has_error(
+    const topology_validation_context_t *ctx,
+    topology_error_t error
+) {
+    for (uint32_t i = 0; i < ctx->error_count; i++) {
+        if (ctx->errors[i] == error) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST(frequency_uniform_cores_do_not_warn) {
+    probe_test_topology(&fixture_topology);
+    record_uniform_frequencies(3000);
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+
+    ASSERT_FALSE(context_has_error(&ctx, TOPOLOGY_WARN_FREQ_VARIATION));
+    ASSERT_EQ(fixture_topology.cores[5].base_freq_mhz, 3001);
+    ASSERT_EQ(fixture_topology.cores[5].max_freq_mhz, 3002);
+    ASSERT_EQ(fixture_topology.freq_reference_mhz, 3001);
+
+    for (core_id_t core = 0; core < 16; core++) {
+        ASSERT_TRUE(topology_core_frequency_stable(&fixture_topology, core));
+    }
+}
+
+TEST(frequency_throttled_core_warns) {
+    probe_test_topology(&fixture_topology);
+    record_uniform_frequencies(3000);
+
+    /* Core 6 runs 10% slow */
+    memset(&fixture_topology.cores[6].frequency, 0, sizeof(core_frequency_t));
+    core_frequency_sample_t slow = { .effective_mhz = 2700 };
+    topology_record_core_frequency(&fixture_topology, 6, &slow);
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+
+    ASSERT_TRUE(context_has_error(&ctx, TOPOLOGY_WARN_FREQ_VARIATION));
+    ASSERT_TRUE(topology_validation_allows_boot(&ctx));
+    ASSERT_FALSE(topology_core_frequency_stable(&fixture_topology, 6));
+    ASSERT_TRUE(topology_core_frequency_stable(&fixture_topology, 7));
+}
+
+TEST(frequency_unstable_core_warns) {
+    probe_test_topology(&fixture_topology);
+    record_uniform_frequencies(3000);
+
+    /* Core 2 mean is fine, but it swings 3000 -> 3300 between samples */
+    core_frequency_sample_t burst = { .effective_mhz = 3300 };
+    topology_record_core_frequency(&fixture_topology, 2, &burst);
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+
+    ASSERT_TRUE(topology_core_frequency_spread(&fixture_topology, 2) > 20);
+    ASSERT_TRUE(context_has_error(&ctx, TOPOLOGY_WARN_FREQ_VARIATION));
+    ASSERT_FALSE(topology_core_frequency_stable(&fixture_topology, 2));
+}
+
+TEST(frequency_counters_preferred_for_mean) {
+    probe_test_topology(&fixture_topology);
+
+    core_frequency_sample_t sample = {
+        .effective_mhz = 2900,   /* Loop saw an interrupt */
+        .counter_mhz   = 3000,
+    };
+    ASSERT_TRUE(topology_record_core_frequency(&fixture_topology, 0, &sample));
+    ASSERT_EQ(topology_core_frequency_mhz(&fixture_topology, 0), 3000);
+
+    ASSERT_TRUE(seal_test_topology(&fixture_topology));
+    ASSERT_FALSE(topology_record_core_frequency(&fixture_topology, 0, &sample));
+}
+
+/* ========================================================================
+ * OS NOISE QUALIFICATION TESTS
+ * ========================================================================
+ */
+
+static core_noise_t quiet_noise(void) {
+    core_noise_t noise = { .window_ns = 100000000 };  /* 100 ms */
+    core_noise_record_gap(&noise, 2000);
+    return noise;
+}
+
+TEST(noise_gap_histogram_is_log2) {
+    core_noise_t noise = { 0 };
+
+    core_noise_record_gap(&noise, 1500);        /* [1 us, 2 us) */
+    core_noise_record_gap(&noise, 5000);        /* [4 us, 8 us) */
+    core_noise_record_gap(&noise, 1ULL << 40);  /* Clamped to last */
+
+    ASSERT_EQ(noise.gap_count, 3);
+    ASSERT_EQ(noise.histogram[0], 1);
+    ASSERT_EQ(noise.histogram[2], 1);
+    ASSERT_EQ(noise.histogram[NOISE_HISTOGRAM_BUCKETS - 1], 1);
+    ASSERT_EQ(noise.max_gap_ns, UINT32_MAX);
+    ASSERT_EQ(noise.stolen_ns, 6500 + (1ULL << 40));
+}
+
+TEST(noise_over_budget_core_is_demoted_at_seal) {
+    probe_test_topology(&fixture_topology);
+
+    for (core_id_t core = 0; core < 16; core++) {
+        core_noise_t noise = quiet_noise();
+        topology_record_core_noise(&fixture_topology, core, &noise);
+    }
+
+    /* Core 4 takes a 200 us interruption (timer tick left enabled) */
+    core_noise_t noisy = quiet_noise();
+    core_noise_record_gap(&noisy, 200000);
+    topology_record_core_noise(&fixture_topology, 4, &noisy);
+
+    ASSERT_FALSE(topology_core_noise_within_budget(&fixture_topology, 4));
+    ASSERT_TRUE(topology_core_noise_within_budget(&fixture_topology, 5));
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+    ASSERT_TRUE(context_has_error(&ctx, TOPOLOGY_WARN_CORE_NOISY));
+    ASSERT_TRUE(topology_validation_allows_boot(&ctx));
+
+    ASSERT_TRUE(topology_seal(&fixture_topology));
+    ASSERT_FALSE(fixture_topology.cores[4].isolated);
+    ASSERT_TRUE(fixture_topology.cores[5].isolated);
+}
+
+TEST(noise_failed_measurement_loses_isolation) {
+    probe_test_topology(&fixture_topology);
+
+    for (core_id_t core = 0; core < 16; core++) {
+        core_noise_t noise = quiet_noise();
+        topology_record_core_noise(&fixture_topology, core, &noise);
+    }
+
+    /* Core 6 could not be pinned while the others were measured */
+    fixture_topology.cores[6].noise = (core_noise_t){ .failed = true };
+
+    ASSERT_FALSE(topology_core_noise_within_budget(&fixture_topology, 6));
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+    ASSERT_TRUE(context_has_error(&ctx, TOPOLOGY_WARN_CORE_NOISY));
+
+    ASSERT_TRUE(topology_seal(&fixture_topology));
+    ASSERT_FALSE(fixture_topology.cores[6].isolated);
+    ASSERT_TRUE(fixture_topology.cores[7].isolated);
+}
+
+TEST(noise_failing_on_every_core_keeps_isolation) {
+    probe_test_topology(&fixture_topology);
+
+    /* Pinning refused everywhere (cpuset-restricted container) */
+    for (core_id_t core = 0; core < 16; core++) {
+        fixture_topology.cores[core].noise = (core_noise_t){ .failed = true };
+    }
+
+    ASSERT_FALSE(fixture_topology.noise_measured);
+    ASSERT_TRUE(topology_core_noise_within_budget(&fixture_topology, 6));
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+    ASSERT_FALSE(context_has_error(&ctx, TOPOLOGY_WARN_CORE_NOISY));
+    ASSERT_TRUE(topology_validation_allows_boot(&ctx));
+
+    ASSERT_TRUE(topology_seal(&fixture_topology));
+    ASSERT_TRUE(fixture_topology.cores[6].isolated);
+}
+
+TEST(noise_rejects_when_no_core_qualifies) {
+    probe_test_topology(&fixture_topology);
+
+    /* 1 ms stolen in 100 ms (1%) exceeds the 0.1% default budget */
+    for (core_id_t core = 0; core < 16; core++) {
+        core_noise_t noise = quiet_noise();
+        for (uint32_t i = 0; i < 50; i++) {
+            core_noise_record_gap(&noise, 20000);
+        }
+        topology_record_core_noise(&fixture_topology, core, &noise);
+    }
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+
+    ASSERT_TRUE(context_has_error(&ctx, TOPOLOGY_ERROR_NO_ISOLATED_CORES));
+    ASSERT_FALSE(topology_validation_allows_boot(&ctx));
+}
+
+/* ========================================================================
+ * NUMA MEMBERSHIP TESTS
+ * ========================================================================
+ */
+
+TEST(numa_membership_indexed_as_masks) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    ASSERT_EQ(topology->numa_nodes[0].core_count, 8);
+    ASSERT_EQ(topology->numa_nodes[1].core_count, 8);
+    ASSERT_TRUE(core_mask_test(&topology->numa_nodes[0].cores, 7));
+    ASSERT_FALSE(core_mask_test(&topology->numa_nodes[0].cores, 8));
+
+    ASSERT_TRUE(topology_same_numa_node(topology, 8, 15));
+    ASSERT_FALSE(topology_same_numa_node(topology, 7, 8));
+    ASSERT_FALSE(topology_same_numa_node(topology, 0, 16));
+}
+
+TEST(numa_membership_mask_within_one_node) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    core_mask_t mask = { 0 };
+    ASSERT_EQ(topology_core_mask_numa_node(topology, &mask), NUMA_NODE_INVALID);
+
+    core_mask_set(&mask, 9);
+    core_mask_set(&mask, 14);
+    ASSERT_EQ(topology_core_mask_numa_node(topology, &mask), 1);
+
+    core_mask_set(&mask, 3);
+    ASSERT_EQ(topology_core_mask_numa_node(topology, &mask), NUMA_NODE_INVALID);
+}
+
+/* ========================================================================
+ * NUMA MEMORY TIER TESTS
+ * ========================================================================
+ */
+
+/**
+ * Add two memory-only nodes to the probed fixture:
+ *   node 2: HBM-like (bandwidth above DRAM), near node 0
+ *   node 3: CXL-like (bandwidth below DRAM), near node 1
+ */
+static void add_memory_only_nodes(topology_state_t *topology) {
+    static const uint32_t distance[4][4] = {
+        { 10, 20, 15, 40 },
+        { 20, 10, 25, 30 },
+        { 15, 25, 10, 45 },
+        { 40, 30, 45, 10 },
+    };
+
+    topology->numa_node_count = 4;
+
+    for (uint32_t n = 0; n < 4; n++) {
+        numa_node_info_t *node = &topology->numa_nodes[n];
+        node->id = n;
+        node->cpu_less = (n >= 2);
+        node->bandwidth_mbps = (n == 2) ? 400000 : (n == 3) ? 60000 : 100000;
+        node->memory_mb = (n == 3) ? 262144 : 65536;
+        for (uint32_t m = 0; m < 4; m++) {
+            node->distance[m] = distance[n][m];
+        }
+    }
+
+    for (core_id_t core = 0; core < 16; core++) {
+        for (uint32_t m = 0; m < 4; m++) {
+            topology->cores[core].numa_distance[m] = distance[core / 8][m];
+        }
+    }
+}
+
+TEST(memory_tiers_classify_cpu_less_nodes) {
+    probe_test_topology(&fixture_topology);
+    add_memory_only_nodes(&fixture_topology);
+    ASSERT_TRUE(seal_test_topology(&fixture_topology));
+
+    ASSERT_EQ(fixture_topology.numa_nodes[0].tier, NUMA_TIER_DRAM);
+    ASSERT_EQ(fixture_topology.numa_nodes[1].tier, NUMA_TIER_DRAM);
+    ASSERT_EQ(fixture_topology.numa_nodes[2].tier, NUMA_TIER_HBM);
+    ASSERT_EQ(fixture_topology.numa_nodes[3].tier, NUMA_TIER_FAR);
+}
+
+TEST(memory_tiers_nearest_node_per_core) {
+    probe_test_topology(&fixture_topology);
+    add_memory_only_nodes(&fixture_topology);
+    ASSERT_TRUE(seal_test_topology(&fixture_topology));
+
+    ASSERT_EQ(topology_nearest_memory_node(&fixture_topology, 0, NUMA_TIER_DRAM), 0);
+    ASSERT_EQ(topology_nearest_memory_node(&fixture_topology, 9, NUMA_TIER_DRAM), 1);
+    ASSERT_EQ(topology_nearest_memory_node(&fixture_topology, 9, NUMA_TIER_HBM), 2);
+    ASSERT_EQ(topology_nearest_memory_node(&fixture_topology, 0, NUMA_TIER_FAR), 3);
+}
+
+TEST(memory_tiers_absent_tier_is_invalid) {
+    topology_state_t *topology = create_sealed_topology();
+    ASSERT_TRUE(topology != NULL);
+
+    ASSERT_EQ(topology_nearest_memory_node(topology, 0, NUMA_TIER_FAR),
+              NUMA_NODE_INVALID);
+}
+
+TEST(memory_tiers_reject_cores_on_cpu_less_node) {
+    probe_test_topology(&fixture_topology);
+    add_memory_only_nodes(&fixture_topology);
+    fixture_topology.cores[15].numa_node = 3;
+
+    topology_validation_context_t ctx;
+    topology_validate(&fixture_topology, &ctx);
+
+    ASSERT_TRUE(context_has_error(&ctx, TOPOLOGY_ERROR_NUMA_TIER_INCONSISTENT));
+    ASSERT_FALSE(topology_validation_allows_boot(&ctx));
+}
+
+/* ========================================================================
+ * TEST RUNNER
+ * ========================================================================
+ */
+
+int main(void) {
+    printf("=================================================\n");
+    printf("UCQCF Phase-1 Topology Query Invariant Tests\n");
+    printf("=================================================\n\n");
+
+    /* Nearest-core ranking tests */
+    run_test_nearest_cores_requires_sealed_topology();
+    run_test_nearest_cores_orders_by_cache_sharing_then_distance();
+    run_test_nearest_cores_filters_by_isolation_level();
+    run_test_nearest_cores_skips_excluded_cores();
+    run_test_nearest_cores_uses_measured_latency_as_tie_break();
+
+    /* Topology tree tests */
+    run_test_tree_levels_are_breadth_first();
+    run_test_tree_cpus_under_l3_are_contiguous();
+    run_test_tree_siblings_match_cache_domains();
+    run_test_tree_requires_sealed_topology();
+
+    /* Frequency calibration tests */
+    run_test_frequency_uniform_cores_do_not_warn();
+    run_test_frequency_throttled_core_warns();
+    run_test_frequency_unstable_core_warns();
+    run_test_frequency_counters_preferred_for_mean();
+
+    /* OS noise qualification tests */
+    run_test_noise_gap_histogram_is_log2();
+    run_test_noise_over_budget_core_is_demoted_at_seal();
+    run_test_noise_failed_measurement_loses_isolation();
+    run_test_noise_failing_on_every_core_keeps_isolation();
+    run_test_noise_rejects_when_no_core_qualifies();
+
+    /* NUMA membership tests */
+    run_test_numa_membership_indexed_as_masks();
+    run_test_numa_membership_mask_within_one_node();
+
+    /* NUMA memory tier tests */
+    run_test_memory_tiers_classify_cpu_less_nodes();
+    run_test_memory_tiers_nearest_node_per_core();
+    run_test_memory_tiers_absent_tier_is_invalid();
+    run_test_memory_tiers_reject_cores_on_cpu_less_node();
+
+    /* Summary */
+    printf("\n=================================================\n");
+    printf("Tests run:    %u\n", tests_run);
+    printf("Tests passed: %u\n", tests_passed);
+    printf("Tests failed: %u\n", tests_failed);
+    printf("=================================================\n");
+
+    if (tests_failed == 0) {
+        printf("✓ ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("✗ SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,375 @@
+/**
+ * tests/topology/topology_generator.c
+ *
+ * Synthetic topology generator
+ *
+ * APPROACH:
+ *   1. Lay out physical cores socket-major (socket, die, CCX, core)
+ *   2. Number logical CPUs, either siblings adjacent (0,1 = core 0) or
+ *      split the way Linux enumerates most servers (n, n + cores)
+ *   3. Fill geometry, cache sharing masks and NUMA distances
+ *
+ * Cache domain IDs are global: L1 = physical core, L2 = L2 instance,
+ * L3 = CCX. All are dense and below the logical CPU count.
+ */
+
+#include "topology_generator.h"
+#include <string.h>
+
+#define GEN_NODE_MEMORY_MB  65536
+
+/* ========================================================================
+ * PRESETS
+ * ======================================================================== */
+
+topology_gen_spec_t topology_gen_preset(topology_gen_preset_t preset) {
+    topology_gen_spec_t spec = {
+        .sockets               = 2,
+        .dies_per_socket       = 1,
+        .ccx_per_die           = 1,
+        .cores_per_ccx         = 8,
+        .threads_per_core      = 1,
+        .cores_per_l2          = 2,
+        .nodes_per_socket      = 1,
+        .local_distance        = 10,
+        .intra_socket_distance = 12,
+        .inter_socket_distance = 20,
+        .isolated              = true,
+    };
+
+    switch (preset) {
+        case TOPOLOGY_GEN_SERVER_2S_NPS1:
+        case TOPOLOGY_GEN_SERVER_2S_NPS4:
+            spec.dies_per_socket = 4;
+            spec.threads_per_core = 2;
+            spec.cores_per_l2 = 1;
+            spec.split_smt_numbering = true;
+            spec.inter_socket_distance = 32;
+            spec.nodes_per_socket = (preset == TOPOLOGY_GEN_SERVER_2S_NPS4) ? 4 : 1;
+            break;
+
+        case TOPOLOGY_GEN_CLIENT_HYBRID:
+            spec.sockets = 1;
+            spec.efficiency_cores_per_ccx = 16;
+            spec.threads_per_core = 2;
+            spec.cores_per_l2 = 1;
+            spec.nodes_per_socket = 0;
+            break;
+
+        case TOPOLOGY_GEN_ASYMMETRIC_4S:
+            spec.sockets = 4;
+            spec.ccx_per_die = 2;
+            spec.threads_per_core = 2;
+            spec.cores_per_l2 = 1;
+            spec.split_smt_numbering = true;
+            spec.inter_socket_distance = 21;
+            spec.asymmetry = 2;
+            break;
+
+        case TOPOLOGY_GEN_MAX:
+            spec.ccx_per_die = MAX_CORES / 64;
+            spec.cores_per_ccx = 16;
+            spec.threads_per_core = 2;
+            spec.cores_per_l2 = 1;
+            spec.split_smt_numbering = true;
+            spec.inter_socket_distance = 32;
+            break;
+
+        case TOPOLOGY_GEN_TOY_16:
+        default:
+            break;
+    }
+
+    return spec;
+}
+
+const char* topology_gen_preset_string(topology_gen_preset_t preset) {
+    switch (preset) {
+        case TOPOLOGY_GEN_TOY_16:          return "toy-16";
+        case TOPOLOGY_GEN_SERVER_2S_NPS1:  return "server-2s-nps1";
+        case TOPOLOGY_GEN_SERVER_2S_NPS4:  return "server-2s-nps4";
+        case TOPOLOGY_GEN_CLIENT_HYBRID:   return "client-hybrid";
+        case TOPOLOGY_GEN_ASYMMETRIC_4S:   return "asymmetric-4s";
+        case TOPOLOGY_GEN_MAX:             return "max";
+        default:                           return "unknown";
+    }
+}
+
+/* ========================================================================
+ * SHAPE
+ * ======================================================================== */
+
+static bool spec_is_wellformed(const topology_gen_spec_t *spec) {
+    if (spec->sockets == 0 || spec->dies_per_socket == 0 ||
+        spec->ccx_per_die == 0) {
+        return false;
+    }
+
+    if (spec->cores_per_ccx + spec->efficiency_cores_per_ccx == 0) {
+        return false;
+    }
+
+    if (spec->threads_per_core == 0 || spec->threads_per_core > 2) {
+        return false;
+    }
+
+    if (spec->cores_per_l2 == 0 || spec->cores_per_ccx % spec->cores_per_l2 != 0) {
+        return false;
+    }
+
+    if (spec->efficiency_cores_per_ccx % TOPOLOGY_GEN_ECORE_CLUSTER != 0) {
+        return false;
+    }
+
+    /* NUMA nodes split a socket's CCXs evenly */
+    uint32_t ccx_per_socket = spec->dies_per_socket * spec->ccx_per_die;
+    if (spec->nodes_per_socket != 0 && ccx_per_socket % spec->nodes_per_socket != 0) {
+        return false;
+    }
+
+    return true;
+}
+
+uint32_t topology_gen_cpu_count(const topology_gen_spec_t *spec) {
+    if (!spec_is_wellformed(spec)) {
+        return 0;
+    }
+
+    uint32_t per_ccx = spec->cores_per_ccx * spec->threads_per_core +
+                       spec->efficiency_cores_per_ccx;
+
+    return spec->sockets * spec->dies_per_socket * spec->ccx_per_die * per_ccx;
+}
+
+uint32_t topology_gen_node_count(const topology_gen_spec_t *spec) {
+    if (spec->nodes_per_socket == 0) {
+        return 1;
+    }
+    return spec->sockets * spec->nodes_per_socket;
+}
+
+/* ========================================================================
+ * GENERATION
+ * ======================================================================== */
+
+typedef struct {
+    uint32_t  socket;
+    uint32_t  die;          /* Within socket */
+    uint32_t  ccx;          /* Global */
+    uint32_t  l2;           /* Global L2 instance */
+    uint32_t  node;
+    uint32_t  threads;
+    bool      efficiency;
+    core_id_t cpu[2];       /* Logical CPU per thread */
+} gen_physical_t;
+
+/* Scratch (tests are single-threaded) */
+static gen_physical_t gen_physical[MAX_CORES];
+static core_mask_t    gen_domain_masks[MAX_CORES];
+static bool           gen_cpu_efficiency[MAX_CORES];
+
+static uint32_t node_distance(
+    const topology_gen_spec_t *spec,
+    uint32_t from,
+    uint32_t to
+) {
+    if (from == to) {
+        return spec->local_distance;
+    }
+
+    uint32_t per_socket = spec->nodes_per_socket ? spec->nodes_per_socket : 1;
+    uint32_t socket_from = from / per_socket;
+    uint32_t socket_to = to / per_socket;
+    uint32_t distance;
+
+    if (socket_from == socket_to) {
+        distance = spec->intra_socket_distance;
+    } else {
+        uint32_t hops = socket_from > socket_to ? socket_from - socket_to
+                                                : socket_to - socket_from;
+        distance = spec->inter_socket_distance + 10 * (hops - 1);
+    }
+
+    return from > to ? distance + spec->asymmetry : distance;
+}
+
+static uint32_t layout_physical_cores(const topology_gen_spec_t *spec) {
+    uint32_t ccx_per_socket = spec->dies_per_socket * spec->ccx_per_die;
+    uint32_t count = 0;
+    uint32_t l2 = 0;
+    uint32_t ccx = 0;
+
+    for (uint32_t s = 0; s < spec->sockets; s++) {
+        for (uint32_t d = 0; d < spec->dies_per_socket; d++) {
+            for (uint32_t c = 0; c < spec->ccx_per_die; c++, ccx++) {
+                uint32_t local_ccx = d * spec->ccx_per_die + c;
+                uint32_t node = 0;
+
+                if (spec->nodes_per_socket != 0) {
+                    node = s * spec->nodes_per_socket +
+                           local_ccx * spec->nodes_per_socket / ccx_per_socket;
+                }
+
+                uint32_t cores = spec->cores_per_ccx + spec->efficiency_cores_per_ccx;
+
+                for (uint32_t k = 0; k < cores; k++) {
+                    gen_physical_t *p = &gen_physical[count++];
+                    bool efficiency = k >= spec->cores_per_ccx;
+
+                    /* New L2 at each P-core group / E-core cluster start */
+                    uint32_t group = efficiency ? TOPOLOGY_GEN_ECORE_CLUSTER
+                                                : spec->cores_per_l2;
+                    uint32_t index = efficiency ? k - spec->cores_per_ccx : k;
+                    if (index % group == 0 && count > 1) {
+                        l2++;
+                    }
+
+                    p->socket = s;
+                    p->die = d;
+                    p->ccx = ccx;
+                    p->l2 = l2;
+                    p->node = node;
+                    p->efficiency = efficiency;
+                    p->threads = efficiency ? 1 : spec->threads_per_core;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+static void number_logical_cpus(const topology_gen_spec_t *spec, uint32_t physical) {
+    core_id_t cpu = 0;
+
+    if (spec->split_smt_numbering) {
+        for (uint32_t t = 0; t < spec->threads_per_core; t++) {
+            for (uint32_t p = 0; p < physical; p++) {
+                if (t < gen_physical[p].threads) {
+                    gen_physical[p].cpu[t] = cpu++;
+                }
+            }
+        }
+    } else {
+        for (uint32_t p = 0; p < physical; p++) {
+            for (uint32_t t = 0; t < gen_physical[p].threads; t++) {
+                gen_physical[p].cpu[t] = cpu++;
+            }
+        }
+    }
+}
+
+static void fill_cache_level(
+    topology_state_t *topology,
+    uint32_t level,
+    cache_domain_t (*domain_of)(const core_geometry_t *),
+    uint32_t size_performance,
+    uint32_t size_efficiency
+) {
+    memset(gen_domain_masks, 0, sizeof(gen_domain_masks));
+
+    for (core_id_t cpu = 0; cpu < topology->core_count; cpu++) {
+        core_mask_set(&gen_domain_masks[domain_of(&topology->cores[cpu])], cpu);
+    }
+
+    for (core_id_t cpu = 0; cpu < topology->core_count; cpu++) {
+        core_geometry_t *geom = &topology->cores[cpu];
+        cache_level_t *cache = &geom->cache_hierarchy.levels[level];
+        const core_mask_t *mask = &gen_domain_masks[domain_of(geom)];
+
+        cache->type = (level == 0) ? CACHE_TYPE_DATA : CACHE_TYPE_UNIFIED;
+        cache->size_bytes = gen_cpu_efficiency[cpu] ? size_efficiency
+                                                    : size_performance;
+        cache->line_size = 64;
+        cache->associativity = (level == 2) ? 16 : 8;
+        cache->sharing_count = core_mask_count(mask, core_mask_words(topology->core_count));
+        cache->shared = cache->sharing_count > 1;
+        cache->shared_with = *mask;
+    }
+}
+
+static cache_domain_t l1_of(const core_geometry_t *g) { return g->l1_domain; }
+static cache_domain_t l2_of(const core_geometry_t *g) { return g->l2_domain; }
+static cache_domain_t l3_of(const core_geometry_t *g) { return g->l3_domain; }
+
+bool topology_generate(
+    const topology_gen_spec_t *spec,
+    boot_facts_t *boot,
+    topology_state_t *topology
+) {
+    uint32_t cpu_count = topology_gen_cpu_count(spec);
+    uint32_t node_count = topology_gen_node_count(spec);
+
+    if (cpu_count == 0 || cpu_count > MAX_CORES || node_count > MAX_NUMA_NODES) {
+        return false;
+    }
+
+    memset(boot, 0, sizeof(*boot));
+    boot->cpu_count = cpu_count;
+    boot->numa_nodes = node_count;
+    boot->smt_enabled = spec->threads_per_core > 1;
+    boot->threads_per_core = spec->threads_per_core;
+    boot->total_memory_mb = (uint64_t)node_count * GEN_NODE_MEMORY_MB;
+    boot->constant_time_supported = true;
+
+    topology_init(topology, boot);
+    if (!topology_probe_all_cores(topology)) {
+        return false;
+    }
+    topology->numa_node_count = node_count;
+
+    uint32_t physical = layout_physical_cores(spec);
+    number_logical_cpus(spec, physical);
+
+    /* Geometry */
+    for (uint32_t p = 0; p < physical; p++) {
+        const gen_physical_t *phys = &gen_physical[p];
+
+        for (uint32_t t = 0; t < phys->threads; t++) {
+            core_geometry_t *geom = &topology->cores[phys->cpu[t]];
+            gen_cpu_efficiency[phys->cpu[t]] = phys->efficiency;
+
+            geom->physical_core = p;
+            geom->online = true;
+            geom->isolated = spec->isolated;
+            geom->socket_id = phys->socket;
+            geom->package_id = phys->socket;
+            geom->die_id = phys->die;
+
+            geom->l1_domain = p;
+            geom->l2_domain = phys->l2;
+            geom->l3_domain = phys->ccx;
+            geom->cache_hierarchy.level_count = 3;
+
+            geom->numa_node = phys->node;
+            for (uint32_t n = 0; n < node_count; n++) {
+                geom->numa_distance[n] = node_distance(spec, phys->node, n);
+            }
+
+            geom->has_smt = phys->threads > 1;
+            geom->smt_sibling = phys->threads > 1 ? phys->cpu[1 - t] : phys->cpu[t];
+
+            geom->base_freq_mhz = phys->efficiency ? 2200 : 3000;
+            geom->max_freq_mhz = phys->efficiency ? 3300 : 4500;
+            geom->freq_scaling_disabled = true;
+            geom->supports_constant_time = true;
+        }
+    }
+
+    /* Cache hierarchy: L1d 48K/32K, L2 2M/4M per cluster, L3 32M */
+    fill_cache_level(topology, 0, l1_of, 48 * 1024, 32 * 1024);
+    fill_cache_level(topology, 1, l2_of, 2 * 1024 * 1024, 4 * 1024 * 1024);
+    fill_cache_level(topology, 2, l3_of, 32 * 1024 * 1024, 32 * 1024 * 1024);
+
+    /* NUMA nodes */
+    for (uint32_t n = 0; n < node_count; n++) {
+        numa_node_info_t *node = &topology->numa_nodes[n];
+        node->id = n;
+        node->memory_mb = GEN_NODE_MEMORY_MB;
+        for (uint32_t m = 0; m < node_count; m++) {
+            node->distance[m] = node_distance(spec, n, m);
+        }
+    }
+
+    return true;
+}
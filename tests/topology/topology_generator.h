@@ -0,0 +1,117 @@
+/**
+ * tests/topology/topology_generator.h
+ *
+ * Synthetic topology generator (tests and benchmarks)
+ *
+ * PURPOSE:
+ *   Produce realistic, parameterized machine topologies so validation
+ *   and query paths are exercised at the scales we actually run:
+ *   sockets x dies x CCX x cores x SMT, NUMA per socket or NPS2/NPS4,
+ *   asymmetric distances and hybrid (performance + efficiency) cores.
+ *
+ * OUTPUT:
+ *   A probed, unvalidated topology and matching boot facts. Callers run
+ *   topology_validate() / topology_seal() exactly as on real hardware.
+ *
+ * GUARANTEES:
+ *   - Deterministic: the same spec always yields the same topology
+ *   - Cache domain IDs are dense and below the generated core count
+ *   - No dynamic allocation
+ */
+
+#ifndef UCQCF_TOPOLOGY_GENERATOR_H
+#define UCQCF_TOPOLOGY_GENERATOR_H
+
+#include "../../topology/topology_contract.h"
+
+/* ========================================================================
+ * SPECIFICATION
+ * ======================================================================== */
+
+/**
+ * Machine shape
+ *
+ * Performance cores: threads_per_core threads, L2 shared by
+ * cores_per_l2 cores. Efficiency cores: one thread, L2 shared by
+ * clusters of TOPOLOGY_GEN_ECORE_CLUSTER. Every CCX has its own L3.
+ */
+#define TOPOLOGY_GEN_ECORE_CLUSTER  4
+
+typedef struct {
+    uint32_t sockets;
+    uint32_t dies_per_socket;
+    uint32_t ccx_per_die;
+    uint32_t cores_per_ccx;             /* Performance cores */
+    uint32_t efficiency_cores_per_ccx;  /* Hybrid: 0 = none */
+    uint32_t threads_per_core;          /* 1 or 2 */
+    uint32_t cores_per_l2;              /* Performance cores per L2 */
+    bool     split_smt_numbering;       /* Siblings at n and n + cores */
+
+    /* NUMA: 0 = one node for the whole machine (NPS0) */
+    uint32_t nodes_per_socket;
+    uint32_t local_distance;
+    uint32_t intra_socket_distance;
+    uint32_t inter_socket_distance;     /* Plus 10 per extra socket hop */
+    uint32_t asymmetry;                 /* Added to distance when i > j */
+
+    bool     isolated;                  /* Mark every core isolated */
+} topology_gen_spec_t;
+
+/**
+ * Preset shapes
+ */
+typedef enum {
+    TOPOLOGY_GEN_TOY_16 = 0,        /* 2 nodes x 8 cores, L2 pairs */
+    TOPOLOGY_GEN_SERVER_2S_NPS1,    /* 2 sockets, 4 CCDs each, SMT-2 */
+    TOPOLOGY_GEN_SERVER_2S_NPS4,    /* As above, 4 nodes per socket */
+    TOPOLOGY_GEN_CLIENT_HYBRID,     /* 8 P-cores (SMT-2) + 16 E-cores */
+    TOPOLOGY_GEN_ASYMMETRIC_4S,     /* 4 sockets, asymmetric SLIT */
+    TOPOLOGY_GEN_MAX,               /* Exactly MAX_CORES logical CPUs */
+    TOPOLOGY_GEN_PRESET_COUNT
+} topology_gen_preset_t;
+
+/* ========================================================================
+ * API
+ * ======================================================================== */
+
+/**
+ * Get a preset specification
+ *
+ * RETURNS: Spec for preset (TOY_16 for unknown values)
+ */
+topology_gen_spec_t topology_gen_preset(topology_gen_preset_t preset);
+
+/**
+ * Get a printable preset name
+ */
+const char* topology_gen_preset_string(topology_gen_preset_t preset);
+
+/**
+ * Count logical CPUs a spec describes
+ *
+ * RETURNS: Logical CPU count (0 if the spec is malformed)
+ */
+uint32_t topology_gen_cpu_count(const topology_gen_spec_t *spec);
+
+/**
+ * Count NUMA nodes a spec describes
+ */
+uint32_t topology_gen_node_count(const topology_gen_spec_t *spec);
+
+/**
+ * Generate topology
+ *
+ * REQUIRES: boot and topology non-NULL; boot outlives topology
+ * ENSURES:  boot describes the machine; topology is initialized from
+ *           boot and probed, with full geometry, cache hierarchy and
+ *           NUMA distances filled in
+ * RETURNS:  false if the spec exceeds MAX_CORES or MAX_NUMA_NODES,
+ *           or does not divide into NUMA nodes evenly
+ */
+bool topology_generate(
+    const topology_gen_spec_t *spec,
+    boot_facts_t *boot,
+    topology_state_t *topology
+);
+
+#endif /* UCQCF_TOPOLOGY_GENERATOR_H */
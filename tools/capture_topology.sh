@@ -0,0 +1,58 @@
+#!/bin/sh
+# tools/capture_topology.sh
+#
+# Capture the sysfs facts topology_import_snapshot() reads into an
+# uncompressed tar image for offline validation (tools/topology_import).
+#
+# USAGE:
+#   capture_topology.sh [output.tar]      (default: topology-$(hostname).tar)
+#
+# sysfs files report a fixed size, so they are copied with cat into a
+# staging directory rather than archived in place.
+
+set -eu
+
+out=${1:-topology-$(hostname).tar}
+stage=$(mktemp -d)
+trap 'rm -rf "$stage"' EXIT
+
+root="$stage/system"
+mkdir -p "$root"
+
+copy() {
+    [ -r "$1" ] || return 0
+    dest="$root/${1#/sys/devices/system/}"
+    mkdir -p "$(dirname "$dest")"
+    cat "$1" > "$dest" 2>/dev/null || rm -f "$dest"
+}
+
+for f in /sys/devices/system/cpu/online /sys/devices/system/cpu/isolated \
+         /sys/devices/system/node/online; do
+    copy "$f"
+done
+
+for cpu in /sys/devices/system/cpu/cpu[0-9]*; do
+    for f in "$cpu"/topology/physical_package_id "$cpu"/topology/die_id \
+             "$cpu"/topology/thread_siblings_list \
+             "$cpu"/cache/index*/level "$cpu"/cache/index*/type \
+             "$cpu"/cache/index*/size "$cpu"/cache/index*/coherency_line_size \
+             "$cpu"/cache/index*/ways_of_associativity \
+             "$cpu"/cache/index*/shared_cpu_list \
+             "$cpu"/cpufreq/cpuinfo_max_freq "$cpu"/cpufreq/base_frequency \
+             "$cpu"/cpufreq/scaling_min_freq "$cpu"/cpufreq/scaling_max_freq; do
+        copy "$f"
+    done
+done
+
+for node in /sys/devices/system/node/node[0-9]*; do
+    for f in "$node"/cpulist "$node"/distance "$node"/meminfo \
+             "$node"/access0/initiators/read_latency \
+             "$node"/access0/initiators/read_bandwidth; do
+        copy "$f"
+    done
+done
+
+cp /proc/cpuinfo "$root/cpuinfo"
+
+tar --format=ustar -cf "$out" -C "$stage" system
+echo "$out"
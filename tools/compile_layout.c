@@ -0,0 +1,94 @@
+/**
+ * tools/compile_layout.c
+ *
+ * Build-time domain layout compiler
+ *
+ * PURPOSE:
+ *   Move parsing and every hardware-independent check off the boot
+ *   path: parse config/domain_layout.yaml, run
+ *   domain_graph_validate_structure(), and write a C header whose
+ *   static table boot loads with domain_graph_validate_compiled().
+ *   Structural errors fail the build here instead of on a machine.
+ *
+ * USAGE:
+ *   compile_layout <domain_layout.yaml> <domain_layout_table.h>
+ *
+ * EXIT STATUS:
+ *   0 if the header was written; 1 on parse or structural errors
+ *   (nothing written); 2 on usage errors
+ */
+
+#include "../domains/domain_contract.h"
+#include "../config/config_contract.h"
+#include "tool_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Large tables: keep them off the stack */
+static domain_graph_t graph;
+
+static bool load_layout(const char *path) {
+    size_t size;
+    char *text = tool_read_file(path, &size);
+
+    if (!text) {
+        fprintf(stderr, "%s: cannot read\n", path);
+        return false;
+    }
+
+    /* No boot facts or topology: only structure is checked here */
+    domain_graph_init(&graph, NULL, NULL);
+
+    config_parse_status_t status;
+    bool parsed = config_parse_domains(text, size, &graph, &status);
+    free(text);
+
+    if (!parsed) {
+        fprintf(stderr, "%s:%u:%u: %s\n", path, status.line, status.column,
+                config_error_string(status.error));
+        return false;
+    }
+
+    validation_context_t ctx;
+    if (domain_graph_validate_structure(&graph, &ctx) == VALIDATION_HARD_FAIL) {
+        validation_context_print(&ctx);
+        fprintf(stderr, "%s: structural validation failed\n", path);
+        return false;
+    }
+
+    return true;
+}
+
+static bool write_header(const char *source, const char *path) {
+    size_t size = config_compile_domains(&graph, source, NULL, 0);
+    char *text = malloc(size + 1);
+    if (!text) {
+        return false;
+    }
+    config_compile_domains(&graph, source, text, size + 1);
+
+    FILE *file = fopen(path, "wb");
+    bool written = file && fwrite(text, 1, size, file) == size;
+    if (file && fclose(file) != 0) {
+        written = false;
+    }
+    free(text);
+
+    if (!written) {
+        fprintf(stderr, "%s: cannot write\n", path);
+        return false;
+    }
+
+    printf("[COMPILE] %s -> %s: %u domains\n", source, path, graph.domain_count);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <domain_layout.yaml> <domain_layout_table.h>\n",
+                argv[0]);
+        return 2;
+    }
+
+    return (load_layout(argv[1]) && write_header(argv[1], argv[2])) ? 0 : 1;
+}
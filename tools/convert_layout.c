@@ -0,0 +1,152 @@
+/**
+ * tools/convert_layout.c
+ *
+ * Domain layout YAML <-> binary image converter
+ *
+ * PURPOSE:
+ *   Produce the binary image boot loads with config_binary_load(), and
+ *   turn a shipped image back into YAML for review. The image carries
+ *   its checksum in the header; it is printed here so images can be
+ *   compared across machines without copying them.
+ *
+ * USAGE:
+ *   convert_layout encode <domain_layout.yaml> <domain_layout.bin>
+ *   convert_layout decode <domain_layout.bin> <domain_layout.yaml>
+ *
+ * EXIT STATUS:
+ *   0 if the output was written; 1 on parse, structural or image
+ *   errors (nothing written); 2 on usage errors
+ *
+ * Encoding runs domain_graph_validate_structure() first, so an image
+ * never holds duplicate IDs, overlapping cores or dependency cycles.
+ */
+
+#include "../domains/domain_contract.h"
+#include "../config/config_contract.h"
+#include "tool_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Large tables: keep them off the stack */
+static domain_graph_t graph;
+
+static bool write_file(const char *path, const void *data, size_t size) {
+    FILE *file = fopen(path, "wb");
+    bool written = file && fwrite(data, 1, size, file) == size;
+    if (file && fclose(file) != 0) {
+        written = false;
+    }
+
+    if (!written) {
+        fprintf(stderr, "%s: cannot write\n", path);
+    }
+    return written;
+}
+
+static bool encode(const char *source, const char *path) {
+    size_t size;
+    char *text = tool_read_file(source, &size);
+
+    if (!text) {
+        fprintf(stderr, "%s: cannot read\n", source);
+        return false;
+    }
+
+    /* No boot facts or topology: only structure is checked here */
+    domain_graph_init(&graph, NULL, NULL);
+
+    config_parse_status_t parse;
+    bool parsed = config_parse_domains(text, size, &graph, &parse);
+    free(text);
+
+    if (!parsed) {
+        fprintf(stderr, "%s:%u:%u: %s\n", source, parse.line, parse.column,
+                config_error_string(parse.error));
+        return false;
+    }
+
+    validation_context_t ctx;
+    if (domain_graph_validate_structure(&graph, &ctx) == VALIDATION_HARD_FAIL) {
+        validation_context_print(&ctx);
+        fprintf(stderr, "%s: structural validation failed\n", source);
+        return false;
+    }
+
+    static uint8_t image[CONFIG_BINARY_MAX_SIZE];
+    config_binary_status_t status;
+    size_t length = config_binary_encode(&graph, image, sizeof(image), &status);
+
+    if (length == 0) {
+        fprintf(stderr, "%s: record %u: %s\n", source, status.record,
+                config_binary_error_string(status.error));
+        return false;
+    }
+
+    if (!write_file(path, image, length)) {
+        return false;
+    }
+
+    printf("[CONVERT] %s -> %s: %u domains, %zu bytes, checksum %08x\n",
+           source, path, graph.domain_count, length,
+           config_binary_checksum(image, length));
+    return true;
+}
+
+static bool decode(const char *source, const char *path) {
+    size_t size;
+    char *image = tool_read_file(source, &size);
+
+    if (!image) {
+        fprintf(stderr, "%s: cannot read\n", source);
+        return false;
+    }
+
+    domain_graph_init(&graph, NULL, NULL);
+
+    config_binary_status_t status;
+    bool loaded = config_binary_load(image, size, &graph, &status);
+    uint32_t checksum = loaded ? config_binary_checksum(image, size) : 0;
+    free(image);
+
+    if (!loaded) {
+        if (status.record != UINT32_MAX) {
+            fprintf(stderr, "%s: record %u: %s\n", source, status.record,
+                    config_binary_error_string(status.error));
+        } else {
+            fprintf(stderr, "%s: %s\n", source, config_binary_error_string(status.error));
+        }
+        return false;
+    }
+
+    size_t length = config_emit_domains(&graph, NULL, 0);
+    char *text = malloc(length + 1);
+    if (!text) {
+        return false;
+    }
+    config_emit_domains(&graph, text, length + 1);
+
+    bool written = write_file(path, text, length);
+    free(text);
+
+    if (written) {
+        printf("[CONVERT] %s -> %s: %u domains, checksum %08x\n",
+               source, path, graph.domain_count, checksum);
+    }
+    return written;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 4 && strcmp(argv[1], "encode") == 0) {
+        return encode(argv[2], argv[3]) ? 0 : 1;
+    }
+    if (argc == 4 && strcmp(argv[1], "decode") == 0) {
+        return decode(argv[2], argv[3]) ? 0 : 1;
+    }
+
+    fprintf(stderr,
+            "usage: %s encode <domain_layout.yaml> <domain_layout.bin>\n"
+            "       %s decode <domain_layout.bin> <domain_layout.yaml>\n",
+            argv[0], argv[0]);
+    return 2;
+}
@@ -0,0 +1,32 @@
+/**
+ * tools/tool_file.c
+ *
+ * File helpers shared by the offline tools
+ */
+
+#include "tool_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+char* tool_read_file(const char *path, size_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+
+    char *data = NULL;
+    long length;
+
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) >= 0 &&
+        fseek(file, 0, SEEK_SET) == 0) {
+        data = malloc((size_t)length + 1);
+        if (data && fread(data, 1, (size_t)length, file) != (size_t)length) {
+            free(data);
+            data = NULL;
+        }
+        *size = (size_t)length;
+    }
+
+    fclose(file);
+    return data;
+}
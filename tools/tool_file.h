@@ -0,0 +1,26 @@
+/**
+ * tools/tool_file.h
+ *
+ * File helpers shared by the offline tools
+ *
+ * PURPOSE:
+ *   compile_layout, convert_layout and topology_import all load whole
+ *   input files (layouts, images, snapshot tars). Boot never uses this:
+ *   it reads into static buffers without allocation.
+ */
+
+#ifndef UCQCF_TOOL_FILE_H
+#define UCQCF_TOOL_FILE_H
+
+#include <stddef.h>
+
+/**
+ * Read a whole file into a malloc'd buffer
+ *
+ * ENSURES: On success *size is the file length and the buffer has one
+ *          spare byte past it; the caller frees the buffer
+ * RETURNS: Buffer, or NULL if the file cannot be opened or read
+ */
+char* tool_read_file(const char *path, size_t *size);
+
+#endif /* UCQCF_TOOL_FILE_H */
@@ -0,0 +1,243 @@
+/**
+ * tools/topology_import.c
+ *
+ * Offline topology and domain layout validation
+ *
+ * PURPOSE:
+ *   Validate a domain configuration against a production machine
+ *   without booting on it: import a sysfs snapshot captured there
+ *   (tools/capture_topology.sh), run the same VALIDATE → SEAL steps as
+ *   Phase-1 boot, then validate the domain layout against the result.
+ *
+ *   With --place, domains that give "core_count" instead of "cores" are
+ *   placed by the solver (config/placement.c) first and then moved along
+ *   their dependency edges to cut cross-domain latency; the explicit layout
+ *   is written to the given file and that file's text is what gets
+ *   parsed again and validated.
+ *
+ * USAGE:
+ *   topology_import [--place placed.yaml] <snapshot-dir | snapshot.tar>
+ *                   [domain_layout.yaml]
+ *
+ * EXIT STATUS:
+ *   0 if the topology (and layout, when given) validates; 1 otherwise;
+ *   2 on usage errors
+ */
+
+#include "../topology/topology_contract.h"
+#include "../domains/domain_contract.h"
+#include "../config/config_contract.h"
+#include "tool_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+/* Large tables: keep them off the stack */
+static boot_facts_t     boot;
+static topology_state_t topology;
+static topology_tar_t   tar;
+static domain_graph_t   graph;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static bool open_snapshot(const char *path, topology_snapshot_t *snapshot,
+                          char **image) {
+    struct stat st;
+    *image = NULL;
+
+    if (stat(path, &st) != 0) {
+        fprintf(stderr, "%s: not found\n", path);
+        return false;
+    }
+
+    if (S_ISDIR(st.st_mode)) {
+        topology_snapshot_directory(snapshot, path);
+        return true;
+    }
+
+    size_t size;
+    *image = tool_read_file(path, &size);
+    if (!*image) {
+        fprintf(stderr, "%s: cannot read\n", path);
+        return false;
+    }
+
+    topology_import_status_t status;
+    if (!topology_snapshot_tar(snapshot, &tar, *image, size, &status)) {
+        fprintf(stderr, "%s: %s\n", path, topology_import_error_string(status.error));
+        return false;
+    }
+
+    printf("[IMPORT] %s: %u members under \"%s\"\n", path, tar.member_count, tar.prefix);
+    return true;
+}
+
+static bool import_topology(const topology_snapshot_t *snapshot) {
+    topology_import_status_t status;
+    uint64_t start = now_ns();
+
+    if (!topology_import_snapshot(snapshot, &boot, &topology, &status)) {
+        fprintf(stderr, "[IMPORT] %s: %s\n",
+                topology_import_error_string(status.error), status.path);
+        return false;
+    }
+
+    uint64_t imported = now_ns();
+
+    topology_validation_context_t ctx;
+    topology_validate(&topology, &ctx);
+
+    printf("[IMPORT] %u CPUs, %u NUMA nodes (%u with CPUs), %u threads/core\n",
+           topology.core_count, topology.numa_node_count, boot.numa_nodes,
+           boot.threads_per_core);
+    topology_validation_context_print(&ctx);
+
+    if (!topology_validation_allows_boot(&ctx) || !topology_seal(&topology)) {
+        fprintf(stderr, "[IMPORT] Topology rejected\n");
+        return false;
+    }
+
+    printf("[IMPORT] Topology sealed (import %lu us, validate+seal %lu us)\n",
+           (unsigned long)((imported - start) / 1000),
+           (unsigned long)((now_ns() - imported) / 1000));
+    return true;
+}
+
+static bool parse_layout(const char *path, const char *text, size_t size) {
+    domain_graph_init(&graph, &boot, &topology);
+
+    config_parse_status_t status;
+    if (!config_parse_domains(text, size, &graph, &status)) {
+        fprintf(stderr, "%s:%u:%u: %s\n", path, status.line, status.column,
+                config_error_string(status.error));
+        return false;
+    }
+
+    printf("[DOMAINS] %s: %u domains\n", path, status.domain_count);
+    return true;
+}
+
+/* Thousandths as a decimal */
+static void print_cost(const char *label, uint64_t cost, bool latency) {
+    printf("[PLACE] %s cross-domain cost: %lu.%03lu %s\n", label,
+           (unsigned long)(cost / 1000), (unsigned long)(cost % 1000),
+           latency ? "ns" : "(NUMA distance)");
+}
+
+static void print_refinement(const placement_refinement_t *refine) {
+    print_cost("Before", refine->cost_before, refine->latency_measured);
+
+    for (uint32_t i = 0; i < refine->swap_count && i < PLACEMENT_MAX_SWAPS; i++) {
+        const placement_swap_t *swap = &refine->swaps[i];
+        if (swap->other == DOMAIN_ID_INVALID) {
+            printf("[PLACE]   domain %u: core %u -> %u\n",
+                   swap->domain, swap->from, swap->to);
+        } else {
+            printf("[PLACE]   domain %u: core %u <-> %u (domain %u)\n",
+                   swap->domain, swap->from, swap->to, swap->other);
+        }
+    }
+
+    print_cost("After ", refine->cost_after, refine->latency_measured);
+}
+
+/* Solve, write the explicit layout, then reload graph from that text */
+static bool place_layout(const char *path) {
+    placement_status_t status;
+    uint64_t start = now_ns();
+
+    if (!config_place_domains(&graph, &topology, &status)) {
+        fprintf(stderr, "[PLACE] domain %u: %s\n", status.domain,
+                placement_error_string(status.error));
+        return false;
+    }
+
+    printf("[PLACE] %u domains placed, cost %lu (%lu us)\n", status.placed,
+           (unsigned long)status.cost, (unsigned long)((now_ns() - start) / 1000));
+
+    placement_refinement_t refine;
+    if (config_refine_placement(&graph, &topology, status.placed_mask, &refine)) {
+        print_refinement(&refine);
+    }
+
+    size_t size = config_emit_domains(&graph, NULL, 0);
+    char *text = malloc(size + 1);
+    if (!text) {
+        return false;
+    }
+    config_emit_domains(&graph, text, size + 1);
+
+    FILE *file = fopen(path, "wb");
+    bool written = file && fwrite(text, 1, size, file) == size;
+    if (file && fclose(file) != 0) {
+        written = false;
+    }
+
+    bool ok = written && parse_layout(path, text, size);
+    if (!written) {
+        fprintf(stderr, "%s: cannot write\n", path);
+    }
+
+    free(text);
+    return ok;
+}
+
+static bool validate_layout(const char *path, const char *place_path) {
+    size_t size;
+    char *text = tool_read_file(path, &size);
+
+    if (!text) {
+        fprintf(stderr, "%s: cannot read\n", path);
+        return false;
+    }
+
+    bool parsed = parse_layout(path, text, size);
+    free(text);
+
+    if (!parsed || (place_path && !place_layout(place_path))) {
+        return false;
+    }
+
+    validation_context_t ctx;
+    validation_result_t result = domain_graph_validate(&graph, &ctx);
+    validation_context_print(&ctx);
+
+    return result != VALIDATION_HARD_FAIL;
+}
+
+int main(int argc, char **argv) {
+    const char *program = argv[0];
+    const char *place_path = NULL;
+
+    if (argc >= 3 && strcmp(argv[1], "--place") == 0) {
+        place_path = argv[2];
+        argc -= 2;
+        argv += 2;
+    }
+
+    if (argc < 2 || argc > 3 || (place_path && argc < 3)) {
+        fprintf(stderr,
+                "usage: %s [--place placed.yaml] <snapshot-dir | snapshot.tar> "
+                "[domain_layout.yaml]\n",
+                program);
+        return 2;
+    }
+
+    topology_snapshot_t snapshot;
+    char *image;
+
+    bool ok = open_snapshot(argv[1], &snapshot, &image) &&
+              import_topology(&snapshot) &&
+              (argc < 3 || validate_layout(argv[2], place_path));
+
+    free(image);
+
+    printf("\n%s\n", ok ? "✓ VALID" : "✗ INVALID");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,265 @@
+/**
+ * topology/frequency.c
+ *
+ * Per-core frequency calibration
+ *
+ * PURPOSE:
+ *   Replace the assumed base/max frequency with measured facts, so
+ *   determinism-sensitive placement can avoid cores that are throttled
+ *   or turbo-binned differently from their peers.
+ *
+ * APPROACH:
+ *   - arch/ pins to each core and times a fixed dependent-ALU loop
+ *     against the TSC (plus APERF/MPERF when readable)
+ *   - Samples are accumulated per core (mean, min, max)
+ *   - Validation compares each core against its own spread and
+ *     against the median core
+ *
+ * GUARANTEES:
+ *   - Calibration only runs before sealing
+ *   - No memory allocation
+ */
+
+#include "topology_contract.h"
+#include <stddef.h>
+
+/* ========================================================================
+ * ARCHITECTURE HOOK
+ *
+ * Weak default. Overridden by arch/ with a pinned TSC measurement.
+ * ======================================================================== */
+
+__attribute__((weak))
+bool topology_measure_core_frequency(
+    core_id_t cpu,
+    uint32_t loop_iterations,
+    core_frequency_sample_t *sample
+) {
+    (void)cpu;
+    (void)loop_iterations;
+    (void)sample;
+    return false;
+}
+
+/* ========================================================================
+ * STATISTICS
+ * ======================================================================== */
+
+static uint32_t frequency_mean(const core_frequency_t *freq) {
+    /* Hardware counters see through interrupts; prefer them */
+    if (freq->counter_samples > 0) {
+        return (uint32_t)(freq->counter_sum_mhz / freq->counter_samples);
+    }
+
+    if (freq->sample_count > 0) {
+        return (uint32_t)(freq->sum_mhz / freq->sample_count);
+    }
+
+    return 0;
+}
+
+static uint32_t frequency_spread(const core_frequency_t *freq) {
+    if (freq->sample_count < 2) {
+        return 0;
+    }
+
+    /* Spread is over the loop samples, so normalize by their mean */
+    uint32_t mean = (uint32_t)(freq->sum_mhz / freq->sample_count);
+    if (mean == 0) {
+        return 0;
+    }
+
+    return (uint32_t)((uint64_t)(freq->max_mhz - freq->min_mhz) * 1000 / mean);
+}
+
+/* |a - b| / b in permille */
+static uint32_t frequency_deviation(uint32_t mhz, uint32_t reference) {
+    if (reference == 0) {
+        return 0;
+    }
+
+    uint32_t diff = mhz > reference ? mhz - reference : reference - mhz;
+    return (uint32_t)((uint64_t)diff * 1000 / reference);
+}
+
+/* ========================================================================
+ * CALIBRATION
+ * ======================================================================== */
+
+bool topology_record_core_frequency(
+    topology_state_t *topology,
+    core_id_t core_id,
+    const core_frequency_sample_t *sample
+) {
+    if (topology->sealed) {
+        return false;
+    }
+
+    if (core_id >= MAX_CORES || !sample || sample->effective_mhz == 0) {
+        return false;
+    }
+
+    core_geometry_t *core = &topology->cores[core_id];
+    core_frequency_t *freq = &core->frequency;
+
+    if (freq->sample_count == 0 || sample->effective_mhz < freq->min_mhz) {
+        freq->min_mhz = sample->effective_mhz;
+    }
+    if (sample->effective_mhz > freq->max_mhz) {
+        freq->max_mhz = sample->effective_mhz;
+    }
+
+    freq->sample_count++;
+    freq->sum_mhz += sample->effective_mhz;
+
+    if (sample->counter_mhz != 0) {
+        freq->counter_samples++;
+        freq->counter_sum_mhz += sample->counter_mhz;
+    }
+
+    core->base_freq_mhz = frequency_mean(freq);
+    core->max_freq_mhz = freq->max_mhz;
+
+    if (topology->freq_variation_permille == 0) {
+        topology->freq_variation_permille = TOPOLOGY_FREQ_VARIATION_PERMILLE_DEFAULT;
+    }
+    topology->frequency_calibrated = true;
+
+    return true;
+}
+
+uint32_t topology_calibrate_frequencies(
+    topology_state_t *topology,
+    const topology_frequency_config_t *config
+) {
+    static const topology_frequency_config_t defaults = {
+        .samples_per_core   = TOPOLOGY_FREQ_SAMPLES_DEFAULT,
+        .loop_iterations    = TOPOLOGY_FREQ_LOOP_ITERATIONS_DEFAULT,
+        .variation_permille = TOPOLOGY_FREQ_VARIATION_PERMILLE_DEFAULT,
+    };
+
+    if (!topology->probed || topology->sealed) {
+        return 0;
+    }
+
+    if (!config) {
+        config = &defaults;
+    }
+
+    topology->freq_variation_permille = config->variation_permille;
+
+    uint32_t calibrated = 0;
+
+    for (core_id_t cpu = 0; cpu < topology->core_count; cpu++) {
+        uint32_t recorded = 0;
+
+        for (uint32_t s = 0; s < config->samples_per_core; s++) {
+            core_frequency_sample_t sample;
+
+            if (!topology_measure_core_frequency(
+                    cpu, config->loop_iterations, &sample)) {
+                break;
+            }
+
+            if (topology_record_core_frequency(topology, cpu, &sample)) {
+                recorded++;
+            }
+        }
+
+        if (recorded > 0) {
+            calibrated++;
+        }
+    }
+
+    return calibrated;
+}
+
+void topology_summarize_frequencies(topology_state_t *topology) {
+    if (topology->sealed || !topology->frequency_calibrated) {
+        return;
+    }
+
+    uint32_t means[MAX_CORES];
+    uint32_t count = 0;
+
+    /* Insertion sort of calibrated core means (runs once at validation) */
+    for (core_id_t cpu = 0; cpu < topology->core_count; cpu++) {
+        uint32_t mean = frequency_mean(&topology->cores[cpu].frequency);
+        if (mean == 0) {
+            continue;
+        }
+
+        uint32_t pos = count++;
+        while (pos > 0 && means[pos - 1] > mean) {
+            means[pos] = means[pos - 1];
+            pos--;
+        }
+        means[pos] = mean;
+    }
+
+    topology->freq_reference_mhz = count ? means[count / 2] : 0;
+}
+
+/* ========================================================================
+ * QUERIES
+ * ======================================================================== */
+
+/* Frequency facts are usable as soon as they are recorded (validation
+ * itself consults them), so these gate on probing, not validation. */
+static const core_frequency_t* core_frequency(
+    const topology_state_t *topology,
+    core_id_t core_id
+) {
+    if (!topology->probed || core_id >= topology->core_count) {
+        return NULL;
+    }
+
+    return &topology->cores[core_id].frequency;
+}
+
+uint32_t topology_core_frequency_mhz(
+    const topology_state_t *topology,
+    core_id_t core_id
+) {
+    const core_frequency_t *freq = core_frequency(topology, core_id);
+
+    return freq ? frequency_mean(freq) : 0;
+}
+
+uint32_t topology_core_frequency_spread(
+    const topology_state_t *topology,
+    core_id_t core_id
+) {
+    const core_frequency_t *freq = core_frequency(topology, core_id);
+
+    return freq ? frequency_spread(freq) : 0;
+}
+
+bool topology_core_frequency_stable(
+    const topology_state_t *topology,
+    core_id_t core_id
+) {
+    const core_frequency_t *freq = core_frequency(topology, core_id);
+
+    if (!freq) {
+        return false;
+    }
+
+    /* Nothing measured: freq_scaling_disabled is the only evidence */
+    if (!topology->frequency_calibrated) {
+        return topology->cores[core_id].freq_scaling_disabled;
+    }
+
+    if (freq->sample_count == 0) {
+        return false;  /* Could not be measured */
+    }
+
+    uint32_t threshold = topology->freq_variation_permille;
+
+    if (frequency_spread(freq) > threshold) {
+        return false;
+    }
+
+    return frequency_deviation(frequency_mean(freq),
+                               topology->freq_reference_mhz) <= threshold;
+}
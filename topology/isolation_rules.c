@@ -0,0 +1,72 @@
+/**
+ * topology/isolation_rules.c
+ *
+ * Cache isolation rules (scalar reference)
+ *
+ * PURPOSE:
+ *   Define how a pair of cores maps to a cache_isolation_level_t.
+ *   This is the single definition of the rule; vectorized versions
+ *   in arch/ must produce byte-identical matrix rows.
+ *
+ * RULE:
+ *   The isolation level is determined by the first cache level the
+ *   two cores share:
+ *     - Shared L1                      -> CACHE_ISOLATED_L1
+ *     - Private L1, shared L2          -> CACHE_ISOLATED_L2
+ *     - Private L1/L2, shared L3       -> CACHE_ISOLATED_L3
+ *     - No shared cache (or same core) -> CACHE_ISOLATED_FULL
+ *
+ *   Only the core itself counts as "same core". SMT siblings share an
+ *   L1 and so map to CACHE_ISOLATED_L1.
+ */
+
+#include "topology_contract.h"
+
+/* ========================================================================
+ * ROW CONSTRUCTION
+ * ======================================================================== */
+
+void topology_build_isolation_row_scalar(
+    const cache_domain_t *l1,
+    const cache_domain_t *l2,
+    const cache_domain_t *l3,
+    uint32_t core_count,
+    uint32_t row,
+    uint8_t *out_row
+) {
+    const cache_domain_t row_l1 = l1[row];
+    const cache_domain_t row_l2 = l2[row];
+    const cache_domain_t row_l3 = l3[row];
+
+    /* Innermost shared level wins, so apply L3 -> L2 -> L1 in order */
+    for (uint32_t j = 0; j < core_count; j++) {
+        uint8_t level = CACHE_ISOLATED_FULL;
+
+        if (l3[j] == row_l3) level = CACHE_ISOLATED_L3;
+        if (l2[j] == row_l2) level = CACHE_ISOLATED_L2;
+        if (l1[j] == row_l1) level = CACHE_ISOLATED_L1;
+
+        out_row[j] = level;
+    }
+
+    /* Same core: no isolation needed */
+    out_row[row] = CACHE_ISOLATED_FULL;
+}
+
+/* ========================================================================
+ * ARCHITECTURE HOOK
+ *
+ * Weak default. Overridden by arch/ with a vectorized implementation.
+ * ======================================================================== */
+
+__attribute__((weak))
+void topology_build_isolation_row(
+    const cache_domain_t *l1,
+    const cache_domain_t *l2,
+    const cache_domain_t *l3,
+    uint32_t core_count,
+    uint32_t row,
+    uint8_t *out_row
+) {
+    topology_build_isolation_row_scalar(l1, l2, l3, core_count, row, out_row);
+}
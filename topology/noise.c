@@ -0,0 +1,189 @@
+/**
+ * topology/noise.c
+ *
+ * Per-core OS noise qualification
+ *
+ * PURPOSE:
+ *   "isolated" is a kernel configuration claim. Misconfigured timers,
+ *   RCU callbacks or IRQ affinity can leave an isolated core useless for
+ *   latency domains. This stage measures what the core actually sees
+ *   before the topology is sealed.
+ *
+ * APPROACH:
+ *   - arch/ pins to each candidate core and spins reading the TSC
+ *   - Any gap between reads above a threshold is an interruption
+ *   - Gaps are summarized as count, stolen time, max gap and a
+ *     log2 histogram, then judged against a budget
+ *
+ * GUARANTEES:
+ *   - Measurement only runs before sealing
+ *   - Unmeasured cores keep their configured isolation, unless their
+ *     own measurement failed while others succeeded
+ *   - No memory allocation
+ */
+
+#include "topology_contract.h"
+#include <stddef.h>
+
+/* ========================================================================
+ * ARCHITECTURE HOOK
+ *
+ * Weak default. Overridden by arch/ with a pinned TSC sampling loop.
+ * ======================================================================== */
+
+__attribute__((weak))
+topology_measure_result_t topology_measure_core_noise(
+    core_id_t cpu,
+    uint32_t window_us,
+    uint32_t gap_threshold_ns,
+    core_noise_t *noise
+) {
+    (void)cpu;
+    (void)window_us;
+    (void)gap_threshold_ns;
+    (void)noise;
+    return TOPOLOGY_MEASURE_UNSUPPORTED;
+}
+
+/* ========================================================================
+ * GAP ACCOUNTING
+ * ======================================================================== */
+
+static uint32_t noise_bucket(uint64_t gap_ns) {
+    if (gap_ns < (1ULL << NOISE_HISTOGRAM_SHIFT)) {
+        return 0;
+    }
+
+    uint32_t log2 = 63 - (uint32_t)__builtin_clzll(gap_ns);
+    uint32_t bucket = log2 - NOISE_HISTOGRAM_SHIFT;
+
+    return bucket < NOISE_HISTOGRAM_BUCKETS ? bucket : NOISE_HISTOGRAM_BUCKETS - 1;
+}
+
+void core_noise_record_gap(core_noise_t *noise, uint64_t gap_ns) {
+    noise->gap_count++;
+    noise->stolen_ns += gap_ns;
+
+    uint32_t gap = gap_ns > UINT32_MAX ? UINT32_MAX : (uint32_t)gap_ns;
+    if (gap > noise->max_gap_ns) {
+        noise->max_gap_ns = gap;
+    }
+
+    noise->histogram[noise_bucket(gap_ns)]++;
+}
+
+/* ========================================================================
+ * QUALIFICATION
+ * ======================================================================== */
+
+static const topology_noise_config_t noise_defaults = {
+    .window_us        = TOPOLOGY_NOISE_WINDOW_US_DEFAULT,
+    .gap_threshold_ns = TOPOLOGY_NOISE_GAP_NS_DEFAULT,
+    .budget_ppm       = TOPOLOGY_NOISE_BUDGET_PPM_DEFAULT,
+    .max_gap_ns       = TOPOLOGY_NOISE_MAX_GAP_NS_DEFAULT,
+};
+
+bool topology_record_core_noise(
+    topology_state_t *topology,
+    core_id_t core_id,
+    const core_noise_t *noise
+) {
+    if (topology->sealed) {
+        return false;
+    }
+
+    if (core_id >= MAX_CORES || !noise || noise->window_ns == 0) {
+        return false;
+    }
+
+    topology->cores[core_id].noise = *noise;
+    topology->cores[core_id].noise.measured = true;
+
+    if (!topology->noise_measured) {
+        if (topology->noise_budget.window_us == 0) {
+            topology->noise_budget = noise_defaults;
+        }
+        topology->noise_measured = true;
+    }
+
+    return true;
+}
+
+uint32_t topology_measure_noise(
+    topology_state_t *topology,
+    const topology_noise_config_t *config
+) {
+    if (!topology->probed || topology->sealed) {
+        return 0;
+    }
+
+    if (!config) {
+        config = &noise_defaults;
+    }
+
+    topology->noise_budget = *config;
+
+    uint32_t measured = 0;
+
+    /* Only candidate-isolated cores need qualifying */
+    for (core_id_t cpu = 0; cpu < topology->core_count; cpu++) {
+        if (!topology->cores[cpu].isolated) {
+            continue;
+        }
+
+        core_noise_t noise = { 0 };
+        topology_measure_result_t status = topology_measure_core_noise(
+            cpu, config->window_us, config->gap_threshold_ns, &noise);
+
+        if (status == TOPOLOGY_MEASURE_UNSUPPORTED) {
+            break;  /* Unavailable on this architecture */
+        }
+
+        if (status != TOPOLOGY_MEASURE_OK) {
+            topology->cores[cpu].noise.failed = true;
+            continue;
+        }
+
+        if (topology_record_core_noise(topology, cpu, &noise)) {
+            measured++;
+        }
+    }
+
+    return measured;
+}
+
+/* ========================================================================
+ * QUERIES
+ * ======================================================================== */
+
+bool topology_core_noise_within_budget(
+    const topology_state_t *topology,
+    core_id_t core_id
+) {
+    if (!topology->probed || core_id >= topology->core_count) {
+        return false;
+    }
+
+    const core_noise_t *noise = &topology->cores[core_id].noise;
+
+    /* Could not be qualified while measurement worked on other cores.
+     * If it failed everywhere (e.g. pinning refused by a cpuset), no
+     * core was measured and every core keeps its configured isolation. */
+    if (noise->failed) {
+        return !topology->noise_measured;
+    }
+
+    if (!noise->measured) {
+        return true;
+    }
+
+    const topology_noise_config_t *budget = &topology->noise_budget;
+
+    if (noise->max_gap_ns > budget->max_gap_ns) {
+        return false;
+    }
+
+    /* stolen / window <= budget_ppm / 10^6 */
+    return noise->stolen_ns * 1000000ULL <=
+           (uint64_t)budget->budget_ppm * noise->window_ns;
+}
@@ -0,0 +1,167 @@
+/**
+ * topology/numa_map.c
+ *
+ * NUMA memory tiers
+ *
+ * PURPOSE:
+ *   Model CPU-less memory nodes (CXL-attached, HBM) as their own tiers,
+ *   so memory domains can place bulk buffers on far memory and keep hot
+ *   state on local DRAM.
+ *
+ * FACTS USED:
+ *   - cpu_less: node has no CPUs (probed)
+ *   - distance: firmware NUMA distance (SLIT)
+ *   - latency_ns / bandwidth_mbps: measured access cost (optional)
+ *
+ * MEMBERSHIP:
+ *   Each node keeps its cores as a core_mask_t, so membership is a bit
+ *   test and "all these cores on one node" is a subset test over the
+ *   words that hold the topology's cores.
+ *
+ * GUARANTEES:
+ *   - Explicitly probed tiers are never overridden
+ *   - Deterministic (distance, latency, node ID ordering)
+ */
+
+#include "topology_contract.h"
+#include <string.h>
+
+/* ========================================================================
+ * MEMBERSHIP
+ * ======================================================================== */
+
+void topology_index_numa_nodes(topology_state_t *topology) {
+    if (topology->sealed) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < MAX_NUMA_NODES; i++) {
+        memset(&topology->numa_nodes[i].cores, 0, sizeof(core_mask_t));
+    }
+
+    /* A core on an unknown node belongs to no node mask */
+    for (core_id_t core = 0; core < topology->core_count; core++) {
+        numa_node_t node = topology->cores[core].numa_node;
+
+        if (node < topology->numa_node_count) {
+            core_mask_set(&topology->numa_nodes[node].cores, core);
+        }
+    }
+
+    for (uint32_t i = 0; i < MAX_NUMA_NODES; i++) {
+        numa_node_info_t *node = &topology->numa_nodes[i];
+        node->core_count = core_mask_count(&node->cores,
+                                           core_mask_words(topology->core_count));
+    }
+}
+
+/* ========================================================================
+ * CLASSIFICATION
+ * ======================================================================== */
+
+void topology_classify_memory_tiers(topology_state_t *topology) {
+    if (topology->sealed) {
+        return;
+    }
+
+    /* Best DRAM bandwidth is the bar a CPU-less node must clear for HBM */
+    uint32_t dram_bandwidth = 0;
+
+    for (uint32_t i = 0; i < topology->numa_node_count; i++) {
+        const numa_node_info_t *node = &topology->numa_nodes[i];
+
+        if (!node->cpu_less && node->bandwidth_mbps > dram_bandwidth) {
+            dram_bandwidth = node->bandwidth_mbps;
+        }
+    }
+
+    for (uint32_t i = 0; i < topology->numa_node_count; i++) {
+        numa_node_info_t *node = &topology->numa_nodes[i];
+
+        if (node->tier != NUMA_TIER_UNKNOWN) {
+            continue;
+        }
+
+        if (!node->cpu_less) {
+            node->tier = NUMA_TIER_DRAM;
+        } else if (dram_bandwidth != 0 && node->bandwidth_mbps > dram_bandwidth) {
+            node->tier = NUMA_TIER_HBM;
+        } else {
+            node->tier = NUMA_TIER_FAR;
+        }
+    }
+}
+
+/* ========================================================================
+ * QUERIES
+ * ======================================================================== */
+
+numa_node_t topology_nearest_memory_node(
+    const topology_state_t *topology,
+    core_id_t core_id,
+    numa_memory_tier_t tier
+) {
+    const core_geometry_t *core = topology_get_core_geometry(topology, core_id);
+
+    if (!core || tier == NUMA_TIER_UNKNOWN || tier >= NUMA_TIER_COUNT) {
+        return NUMA_NODE_INVALID;
+    }
+
+    numa_node_t best = NUMA_NODE_INVALID;
+    uint32_t best_distance = UINT32_MAX;
+    uint32_t best_latency = UINT32_MAX;
+
+    /* Ascending node order makes node ID the final tie-break */
+    for (uint32_t i = 0; i < topology->numa_node_count; i++) {
+        const numa_node_info_t *node = &topology->numa_nodes[i];
+
+        if (node->tier != tier) {
+            continue;
+        }
+
+        uint32_t distance = core->numa_distance[i];
+        uint32_t latency = node->latency_ns ? node->latency_ns : UINT32_MAX;
+
+        if (distance < best_distance ||
+            (distance == best_distance && latency < best_latency)) {
+            best = i;
+            best_distance = distance;
+            best_latency = latency;
+        }
+    }
+
+    return best;
+}
+
+numa_node_t topology_core_mask_numa_node(
+    const topology_state_t *topology,
+    const core_mask_t *mask
+) {
+    if (!topology->validated) {
+        return NUMA_NODE_INVALID;
+    }
+
+    uint32_t words = core_mask_words(topology->core_count);
+
+    /* The lowest core names the only node that could contain the mask */
+    for (uint32_t w = 0; w < words; w++) {
+        if (mask->bits[w] == 0) {
+            continue;
+        }
+
+        core_id_t first = w * 64 + (core_id_t)__builtin_ctzll(mask->bits[w]);
+        if (first >= topology->core_count) {
+            return NUMA_NODE_INVALID;
+        }
+
+        numa_node_t node = topology->cores[first].numa_node;
+        if (node >= topology->numa_node_count ||
+            !core_mask_is_subset(mask, &topology->numa_nodes[node].cores, words)) {
+            return NUMA_NODE_INVALID;
+        }
+
+        return node;
+    }
+
+    return NUMA_NODE_INVALID;
+}
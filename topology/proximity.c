@@ -0,0 +1,263 @@
+/**
+ * topology/proximity.c
+ *
+ * Core proximity index and nearest-core queries
+ *
+ * PURPOSE:
+ *   Answer "the K cores closest to core C that satisfy isolation level L
+ *   and are not in set S" without an O(N^2) scan at placement time, and
+ *   "is every pair in set S isolated at level L" for domain validation.
+ *
+ * APPROACH:
+ *   At seal time, each core's peers are sorted once by a packed 64-bit
+ *   key (isolation level, NUMA distance, latency, core ID). Because
+ *   isolation is the primary key, "isolation >= L" is a suffix of the
+ *   row and a query is a short forward scan from level_start[L].
+ *
+ * GUARANTEES:
+ *   - Deterministic ordering (core ID is the final tie-break)
+ *   - No memory allocation (in-place heapsort on a stack buffer)
+ *   - Queries are read-only on the sealed topology
+ */
+
+#include "topology_contract.h"
+
+/* ========================================================================
+ * SORT KEY
+ * ======================================================================== */
+
+/*
+ * Key layout (most significant first):
+ *   [63:56] isolation level
+ *   [55:40] NUMA distance (saturated)
+ *   [39:24] measured latency in ns (0 when not measured)
+ *   [23:0]  core ID
+ */
+#define KEY_LEVEL_SHIFT    56
+#define KEY_DISTANCE_SHIFT 40
+#define KEY_LATENCY_SHIFT  24
+#define KEY_CORE_MASK      0xFFFFFFULL
+
+static uint64_t proximity_key(
+    const topology_state_t *topology,
+    core_id_t from,
+    core_id_t to
+) {
+    const core_geometry_t *geom_from = &topology->cores[from];
+    const core_geometry_t *geom_to = &topology->cores[to];
+
+    uint64_t level = topology->cache_isolation.isolation[from][to];
+
+    uint64_t distance = 0xFFFF;
+    if (geom_to->numa_node < MAX_NUMA_NODES &&
+        geom_from->numa_distance[geom_to->numa_node] < 0xFFFF) {
+        distance = geom_from->numa_distance[geom_to->numa_node];
+    }
+
+    uint64_t latency = 0;
+    if (topology->core_latency.measured) {
+        latency = topology->core_latency.latency_ns[from][to];
+    }
+
+    return (level << KEY_LEVEL_SHIFT) |
+           (distance << KEY_DISTANCE_SHIFT) |
+           (latency << KEY_LATENCY_SHIFT) |
+           ((uint64_t)to & KEY_CORE_MASK);
+}
+
+/* ========================================================================
+ * HEAPSORT (in place, no allocation)
+ * ======================================================================== */
+
+static void sift_down(uint64_t *keys, uint32_t root, uint32_t count) {
+    for (;;) {
+        uint32_t child = 2 * root + 1;
+        if (child >= count) {
+            return;
+        }
+
+        if (child + 1 < count && keys[child + 1] > keys[child]) {
+            child++;
+        }
+
+        if (keys[root] >= keys[child]) {
+            return;
+        }
+
+        uint64_t tmp = keys[root];
+        keys[root] = keys[child];
+        keys[child] = tmp;
+        root = child;
+    }
+}
+
+static void sort_keys(uint64_t *keys, uint32_t count) {
+    if (count < 2) {
+        return;
+    }
+
+    for (uint32_t i = count / 2; i-- > 0;) {
+        sift_down(keys, i, count);
+    }
+
+    for (uint32_t end = count - 1; end > 0; end--) {
+        uint64_t tmp = keys[0];
+        keys[0] = keys[end];
+        keys[end] = tmp;
+        sift_down(keys, 0, end);
+    }
+}
+
+/* ========================================================================
+ * CONSTRUCTION
+ * ======================================================================== */
+
+bool topology_record_core_latency(
+    topology_state_t *topology,
+    core_id_t core_a,
+    core_id_t core_b,
+    uint32_t latency_ns
+) {
+    if (topology->sealed) {
+        return false;
+    }
+
+    if (core_a >= MAX_CORES || core_b >= MAX_CORES) {
+        return false;
+    }
+
+    uint16_t saturated = latency_ns > UINT16_MAX ? UINT16_MAX : (uint16_t)latency_ns;
+
+    topology->core_latency.latency_ns[core_a][core_b] = saturated;
+    topology->core_latency.latency_ns[core_b][core_a] = saturated;
+    topology->core_latency.measured = true;
+
+    return true;
+}
+
+bool topology_build_proximity_index(topology_state_t *topology) {
+    if (!topology->cache_isolation.computed) {
+        return false;
+    }
+
+    if (topology->sealed) {
+        return false;
+    }
+
+    core_proximity_index_t *index = &topology->proximity;
+    uint64_t keys[MAX_CORES];
+
+    for (core_id_t core = 0; core < topology->core_count; core++) {
+        uint32_t count = 0;
+
+        for (core_id_t peer = 0; peer < topology->core_count; peer++) {
+            if (peer != core) {
+                keys[count++] = proximity_key(topology, core, peer);
+            }
+        }
+
+        sort_keys(keys, count);
+
+        /* Emit order and record where each isolation level begins */
+        uint32_t level = 0;
+        for (uint32_t pos = 0; pos < count; pos++) {
+            uint32_t key_level = (uint32_t)(keys[pos] >> KEY_LEVEL_SHIFT);
+
+            while (level <= key_level) {
+                index->level_start[core][level++] = (uint16_t)pos;
+            }
+
+            index->order[core][pos] = (uint16_t)(keys[pos] & KEY_CORE_MASK);
+        }
+
+        while (level <= CACHE_ISOLATION_LEVEL_COUNT) {
+            index->level_start[core][level++] = (uint16_t)count;
+        }
+    }
+
+    index->computed = true;
+    return true;
+}
+
+/* ========================================================================
+ * QUERIES
+ * ======================================================================== */
+
+uint32_t topology_nearest_cores(
+    const topology_state_t *topology,
+    core_id_t core_id,
+    cache_isolation_level_t required_level,
+    const core_mask_t *exclude,
+    core_id_t *out_cores,
+    uint32_t max_cores
+) {
+    if (!topology->sealed || !topology->proximity.computed) {
+        return 0;
+    }
+
+    if (core_id >= topology->core_count || !out_cores || max_cores == 0) {
+        return 0;
+    }
+
+    if ((uint32_t)required_level >= CACHE_ISOLATION_LEVEL_COUNT) {
+        return 0;
+    }
+
+    const core_proximity_index_t *index = &topology->proximity;
+    const uint16_t *order = index->order[core_id];
+    uint32_t end = index->level_start[core_id][CACHE_ISOLATION_LEVEL_COUNT];
+
+    uint32_t count = 0;
+    for (uint32_t pos = index->level_start[core_id][required_level];
+         pos < end && count < max_cores; pos++) {
+        core_id_t peer = order[pos];
+
+        if (exclude && core_mask_test(exclude, peer)) {
+            continue;
+        }
+
+        out_cores[count++] = peer;
+    }
+
+    return count;
+}
+
+bool topology_core_mask_isolated(
+    const topology_state_t *topology,
+    const core_mask_t *mask,
+    cache_isolation_level_t required_level
+) {
+    if (!topology->sealed || !topology->proximity.computed) {
+        return false;
+    }
+
+    if ((uint32_t)required_level >= CACHE_ISOLATION_LEVEL_COUNT) {
+        return false;
+    }
+
+    const core_proximity_index_t *index = &topology->proximity;
+
+    uint32_t words = core_mask_words(topology->core_count);
+
+    for (uint32_t w = 0; w < words; w++) {
+        for (uint64_t bits = mask->bits[w]; bits; bits &= bits - 1) {
+            core_id_t core = w * 64 + (core_id_t)__builtin_ctzll(bits);
+
+            if (core >= topology->core_count) {
+                return false;
+            }
+
+            /* order[core][0 .. level_start) shares a cache below the level */
+            const uint16_t *order = index->order[core];
+            uint32_t end = index->level_start[core][required_level];
+
+            for (uint32_t pos = 0; pos < end; pos++) {
+                if (core_mask_test(mask, order[pos])) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
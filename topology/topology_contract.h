@@ -23,6 +23,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "../boot/boot_contract.h"
 
 /* ========================================================================
@@ -34,13 +35,71 @@ typedef uint32_t cache_domain_t;
 typedef uint32_t numa_node_t;
 
 #define CORE_ID_INVALID      0xFFFFFFFF
-#define CACHE_DOMAIN_INVALID 0xFFFFFFFF
+#define CACHE_DOMAIN_INVALID 0xFFFFFFFF   /* Valid IDs are < MAX_CORES */
 #define NUMA_NODE_INVALID    0xFFFFFFFF
 
-#define MAX_CORES            256
+#define MAX_CORES            MAX_CPU_COUNT   /* UCQCF_MAX_CPUS */
 #define MAX_CACHE_LEVELS     4
 #define MAX_NUMA_NODES       8
 
+/* ========================================================================
+ * CORE MASK
+ * ======================================================================== */
+
+#define CORE_MASK_WORDS      (MAX_CORES / 64)
+
+/**
+ * Fixed-width set of core IDs (one bit per core)
+ * 
+ * Whole-mask loops take a word bound (core_mask_words(core_count)), so
+ * a wide build (UCQCF_MAX_CPUS=1024) only visits the machine's words.
+ */
+typedef struct {
+    uint64_t bits[CORE_MASK_WORDS];
+} core_mask_t;
+
+static inline bool core_mask_test(const core_mask_t *mask, core_id_t core) {
+    if (core >= MAX_CORES) {
+        return false;
+    }
+    return (mask->bits[core / 64] >> (core % 64)) & 1;
+}
+
+static inline void core_mask_set(core_mask_t *mask, core_id_t core) {
+    if (core < MAX_CORES) {
+        mask->bits[core / 64] |= 1ULL << (core % 64);
+    }
+}
+
+/* Words needed for core IDs [0, core_count): bounds the loops below */
+static inline uint32_t core_mask_words(uint32_t core_count) {
+    uint32_t words = (core_count + 63) / 64;
+    return words < CORE_MASK_WORDS ? words : CORE_MASK_WORDS;
+}
+
+/* Members in the first words words */
+static inline uint32_t core_mask_count(const core_mask_t *mask, uint32_t words) {
+    uint32_t count = 0;
+    for (uint32_t w = 0; w < words; w++) {
+        count += (uint32_t)__builtin_popcountll(mask->bits[w]);
+    }
+    return count;
+}
+
+/* Every core of subset's first words words is also in superset */
+static inline bool core_mask_is_subset(
+    const core_mask_t *subset,
+    const core_mask_t *superset,
+    uint32_t words
+) {
+    for (uint32_t w = 0; w < words; w++) {
+        if (subset->bits[w] & ~superset->bits[w]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /* ========================================================================
  * CACHE TOPOLOGY
  * ======================================================================== */
@@ -62,7 +121,7 @@ typedef struct {
     uint32_t     associativity;
     bool         shared;          /* Shared with other cores? */
     uint32_t     sharing_count;   /* How many cores share this cache */
-    core_id_t    shared_with[MAX_CORES];  /* Which cores share it */
+    core_mask_t  shared_with;     /* Which cores share it */
 } cache_level_t;
 
 /**
@@ -73,6 +132,101 @@ typedef struct {
     uint32_t      level_count;
 } cache_hierarchy_t;
 
+/* ========================================================================
+ * CORE FREQUENCY (Determinism)
+ * ======================================================================== */
+
+#define TOPOLOGY_FREQ_SAMPLES_DEFAULT            5
+#define TOPOLOGY_FREQ_LOOP_ITERATIONS_DEFAULT    4000000
+#define TOPOLOGY_FREQ_VARIATION_PERMILLE_DEFAULT 20    /* 2% */
+
+/**
+ * One frequency measurement on one core
+ * 
+ * effective_mhz is derived from a fixed dependent-ALU loop timed
+ * against the TSC. counter_mhz is derived from APERF/MPERF and is 0
+ * when the counters are not readable.
+ */
+typedef struct {
+    uint32_t effective_mhz;
+    uint32_t counter_mhz;
+} core_frequency_sample_t;
+
+/**
+ * Accumulated frequency measurements for a core
+ * 
+ * Mean and spread are derived from these (see topology_core_frequency_*).
+ */
+typedef struct {
+    uint32_t sample_count;
+    uint64_t sum_mhz;
+    uint32_t min_mhz;
+    uint32_t max_mhz;
+    uint32_t counter_samples;    /* Samples that had APERF/MPERF */
+    uint64_t counter_sum_mhz;
+} core_frequency_t;
+
+/**
+ * Frequency calibration parameters
+ */
+typedef struct {
+    uint32_t samples_per_core;
+    uint32_t loop_iterations;     /* Dependent adds per sample (x4) */
+    uint32_t variation_permille;  /* Spread tolerated before warning */
+} topology_frequency_config_t;
+
+/* ========================================================================
+ * OS NOISE (Isolation Qualification)
+ * ======================================================================== */
+
+/*
+ * Gap histogram: bucket b counts gaps in [2^(b+SHIFT), 2^(b+SHIFT+1)) ns;
+ * the last bucket also takes everything longer.
+ */
+#define NOISE_HISTOGRAM_BUCKETS      16
+#define NOISE_HISTOGRAM_SHIFT        10      /* Bucket 0 starts at ~1 us */
+
+#define TOPOLOGY_NOISE_WINDOW_US_DEFAULT     100000  /* 100 ms per core */
+#define TOPOLOGY_NOISE_GAP_NS_DEFAULT        1000    /* Smallest gap counted */
+#define TOPOLOGY_NOISE_BUDGET_PPM_DEFAULT    1000    /* 0.1% time stolen */
+#define TOPOLOGY_NOISE_MAX_GAP_NS_DEFAULT    50000   /* 50 us worst case */
+
+/**
+ * Measured OS noise on one core
+ * 
+ * A gap is any interval between consecutive TSC reads in a tight loop
+ * that exceeds the gap threshold: time taken by timers, IRQs, RCU
+ * callbacks or other tasks.
+ */
+typedef struct {
+    uint64_t window_ns;          /* Sampling window actually observed */
+    uint64_t stolen_ns;          /* Sum of all gaps */
+    uint32_t gap_count;
+    uint32_t max_gap_ns;
+    uint32_t histogram[NOISE_HISTOGRAM_BUCKETS];
+    bool     measured;
+    bool     failed;             /* Measurement attempted and failed */
+} core_noise_t;
+
+/**
+ * Result of a per-core measurement hook
+ */
+typedef enum {
+    TOPOLOGY_MEASURE_OK = 0,
+    TOPOLOGY_MEASURE_FAILED,         /* This core only (e.g. cannot pin) */
+    TOPOLOGY_MEASURE_UNSUPPORTED     /* Architecture cannot measure */
+} topology_measure_result_t;
+
+/**
+ * Noise measurement parameters and budget
+ */
+typedef struct {
+    uint32_t window_us;          /* Sampling window per core */
+    uint32_t gap_threshold_ns;   /* Shorter intervals are loop overhead */
+    uint32_t budget_ppm;         /* Max stolen time per million ns */
+    uint32_t max_gap_ns;         /* Max single interruption */
+} topology_noise_config_t;
+
 /* ========================================================================
  * CORE GEOMETRY (Security-Critical)
  * ======================================================================== */
@@ -92,6 +246,7 @@ typedef struct {
     /* Socket/package information */
     uint32_t         socket_id;
     uint32_t         package_id;
+    uint32_t         die_id;          /* Die within package */
     
     /* Cache domains (security-critical) */
     cache_domain_t   l1_domain;       /* L1 cache sharing domain */
@@ -111,6 +266,10 @@ typedef struct {
     uint32_t         base_freq_mhz;
     uint32_t         max_freq_mhz;
     bool             freq_scaling_disabled;  /* Required for determinism */
+    core_frequency_t frequency;              /* Calibrated, if measured */
+    
+    /* OS noise (qualifies `isolated`) */
+    core_noise_t     noise;
     
     /* Capabilities (negative capabilities explicit) */
     bool             supports_constant_time;
@@ -129,12 +288,16 @@ typedef struct {
 
 /**
  * Cache isolation relationship between two cores
+ * 
+ * Levels L1..L3 name the lowest cache level the two cores share; every
+ * level above it is shared as well. Larger values mean more isolation.
+ * topology_get_cache_isolation() reports NONE for a core against itself.
  */
 typedef enum {
-    CACHE_ISOLATED_NONE = 0,    /* Cores share all caches */
-    CACHE_ISOLATED_L1,          /* Private L1, shared L2/L3 */
-    CACHE_ISOLATED_L2,          /* Private L1/L2, shared L3 */
-    CACHE_ISOLATED_L3,          /* Private L1/L2/L3 */
+    CACHE_ISOLATED_NONE = 0,    /* Same core: shares everything */
+    CACHE_ISOLATED_L1,          /* Shared L1 (SMT siblings) */
+    CACHE_ISOLATED_L2,          /* Private L1, shared L2 */
+    CACHE_ISOLATED_L3,          /* Private L1/L2, shared L3 */
     CACHE_ISOLATED_FULL         /* No shared cache at any level */
 } cache_isolation_level_t;
 
@@ -145,29 +308,165 @@ typedef enum {
  * Scheduler and domain validator use this for O(1) isolation checks.
  */
 typedef struct {
-    cache_isolation_level_t isolation[MAX_CORES][MAX_CORES];
+    uint8_t                 isolation[MAX_CORES][MAX_CORES];  /* cache_isolation_level_t */
     bool                    computed;
     bool                    sealed;
 } cache_isolation_matrix_t;
 
+/**
+ * Per-core cache domain columns (structure-of-arrays)
+ * 
+ * Copied out of cores[] before matrix construction so that each matrix
+ * row is three contiguous compare streams instead of N strided loads
+ * from core_geometry_t. Columns are 64-byte aligned for vector loads.
+ */
+typedef struct {
+    _Alignas(64) cache_domain_t l1[MAX_CORES];
+    _Alignas(64) cache_domain_t l2[MAX_CORES];
+    _Alignas(64) cache_domain_t l3[MAX_CORES];
+} cache_domain_columns_t;
+
+/* ========================================================================
+ * CORE PROXIMITY (Placement Queries)
+ * ======================================================================== */
+
+#define CACHE_ISOLATION_LEVEL_COUNT  (CACHE_ISOLATED_FULL + 1)
+
+/**
+ * Measured core-to-core latency
+ * 
+ * Optional. Recorded before sealing (e.g. by a cache-line ping-pong
+ * probe); used only as a tie-break in proximity ordering.
+ */
+typedef struct {
+    uint16_t latency_ns[MAX_CORES][MAX_CORES];
+    bool     measured;
+} core_latency_matrix_t;
+
+/**
+ * Precomputed per-core proximity ordering
+ * 
+ * order[c] lists every other core, closest first, ranked by:
+ *   1. Cache sharing (lowest isolation level first)
+ *   2. NUMA distance
+ *   3. Measured core-to-core latency (if measured)
+ *   4. Core ID (deterministic tie-break)
+ * 
+ * level_start[c][L] is the first position in order[c] whose isolation
+ * from c is >= L, so "at least level L" is a contiguous suffix.
+ * level_start[c][CACHE_ISOLATION_LEVEL_COUNT] is the row length.
+ */
+typedef struct {
+    uint16_t order[MAX_CORES][MAX_CORES];
+    uint16_t level_start[MAX_CORES][CACHE_ISOLATION_LEVEL_COUNT + 1];
+    bool     computed;
+} core_proximity_index_t;
+
+/* ========================================================================
+ * HIERARCHICAL TOPOLOGY TREE
+ * ======================================================================== */
+
+/**
+ * Tree levels (root to leaf)
+ * 
+ * A CORE node groups the hardware threads that share an L1 domain.
+ */
+typedef enum {
+    TOPOLOGY_LEVEL_MACHINE = 0,
+    TOPOLOGY_LEVEL_PACKAGE,
+    TOPOLOGY_LEVEL_DIE,
+    TOPOLOGY_LEVEL_L3,
+    TOPOLOGY_LEVEL_L2,
+    TOPOLOGY_LEVEL_CORE,
+    TOPOLOGY_LEVEL_THREAD,
+    TOPOLOGY_LEVEL_COUNT
+} topology_level_t;
+
+#define TOPOLOGY_NODE_INVALID  0xFFFFFFFF
+#define MAX_TOPOLOGY_NODES     (1 + (TOPOLOGY_LEVEL_COUNT - 1) * MAX_CORES)
+
+/**
+ * Tree node
+ * 
+ * Children of a node are contiguous in nodes[]. The CPUs of a node's
+ * entire subtree are contiguous in cpu_order[].
+ */
+typedef struct {
+    topology_level_t level;
+    uint32_t         id;           /* package/die/cache domain ID, or CPU */
+    uint32_t         parent;       /* TOPOLOGY_NODE_INVALID for machine */
+    uint32_t         first_child;
+    uint32_t         child_count;
+    uint32_t         first_cpu;    /* Index into cpu_order[] */
+    uint32_t         cpu_count;
+} topology_node_t;
+
+/**
+ * Flat breadth-first topology tree
+ * 
+ * machine -> package -> die -> L3 group -> L2 group -> core -> thread
+ * 
+ * Nodes of one level occupy nodes[level_start[l] .. level_start[l+1]).
+ */
+typedef struct {
+    topology_node_t nodes[MAX_TOPOLOGY_NODES];
+    uint32_t        node_count;
+    uint32_t        level_start[TOPOLOGY_LEVEL_COUNT + 1];
+    
+    core_id_t       cpu_order[MAX_CORES];  /* CPUs in subtree order */
+    uint32_t        cpu_leaf[MAX_CORES];   /* CPU -> THREAD node */
+    
+    bool            built;
+} topology_tree_t;
+
+/**
+ * Contiguous run of CPUs (subtree slice of cpu_order[])
+ */
+typedef struct {
+    const core_id_t *cpus;
+    uint32_t         count;
+} topology_cpu_range_t;
+
 /* ========================================================================
  * NUMA TOPOLOGY
  * ======================================================================== */
 
+/**
+ * NUMA memory tier
+ * 
+ * CXL-attached and HBM memory appears as CPU-less nodes at a higher
+ * distance. UNKNOWN tiers are classified during validation.
+ */
+typedef enum {
+    NUMA_TIER_UNKNOWN = 0,     /* Classify from facts */
+    NUMA_TIER_DRAM,            /* CPU-attached DRAM */
+    NUMA_TIER_HBM,             /* CPU-less, higher bandwidth than DRAM */
+    NUMA_TIER_FAR,             /* CPU-less far memory (CXL, remote) */
+    NUMA_TIER_COUNT
+} numa_memory_tier_t;
+
 /**
  * NUMA node information
  */
 typedef struct {
     numa_node_t  id;
-    uint32_t     memory_mb;
-    uint32_t     core_count;
-    core_id_t    cores[MAX_CORES];
+    uint32_t     memory_mb;       /* Capacity */
+    core_mask_t  cores;           /* Member cores (indexed at validation) */
+    uint32_t     core_count;      /* Population count of cores */
+    
+    /* Memory-only nodes (no CPUs, e.g. CXL or HBM) */
+    bool               cpu_less;
+    numa_memory_tier_t tier;
+    
+    /* Measured access cost (0 = not measured) */
+    uint32_t     latency_ns;
+    uint32_t     bandwidth_mbps;
     
     /* Distance matrix to other nodes (latency-based) */
     uint32_t     distance[MAX_NUMA_NODES];
     
     bool         validated;
-} numa_node_t;
+} numa_node_info_t;
 
 /* ========================================================================
  * TOPOLOGY STATE (Complete Hardware Model)
@@ -187,18 +486,33 @@ typedef struct {
     uint32_t        core_count;
     
     /* NUMA information */
-    numa_node_t     numa_nodes[MAX_NUMA_NODES];
-    uint32_t        numa_node_count;
+    numa_node_info_t numa_nodes[MAX_NUMA_NODES];
+    uint32_t        numa_node_count;  /* Includes CPU-less nodes */
     
     /* Cache isolation matrix (precomputed) */
+    cache_domain_columns_t   cache_domains;
     cache_isolation_matrix_t cache_isolation;
     
+    /* Placement support (proximity index built at seal) */
+    core_latency_matrix_t    core_latency;
+    core_proximity_index_t   proximity;
+    topology_tree_t          tree;
+    
     /* Global capabilities */
     bool            supports_smt;
     bool            supports_numa;
     bool            supports_cache_partitioning;
     bool            symmetric;        /* All cores identical? */
     
+    /* Frequency calibration */
+    bool            frequency_calibrated;
+    uint32_t        freq_variation_permille;
+    uint32_t        freq_reference_mhz;  /* Median of core means */
+    
+    /* OS noise qualification */
+    bool                    noise_measured;
+    topology_noise_config_t noise_budget;
+    
     /* Validation state */
     bool            probed;
     bool            validated;
@@ -228,6 +542,7 @@ typedef enum {
     TOPOLOGY_ERROR_CORE_NOT_PROBED,
     TOPOLOGY_ERROR_CACHE_HIERARCHY_INCOMPLETE,
     TOPOLOGY_ERROR_NUMA_DISTANCE_INVALID,
+    TOPOLOGY_ERROR_NUMA_TIER_INCONSISTENT,
     TOPOLOGY_ERROR_SMT_SIBLING_INVALID,
     
     /* Consistency errors */
@@ -243,6 +558,7 @@ typedef enum {
     TOPOLOGY_WARN_SMT_ENABLED,
     TOPOLOGY_WARN_NUMA_ASYMMETRIC,
     TOPOLOGY_WARN_FREQ_VARIATION,
+    TOPOLOGY_WARN_CORE_NOISY,
     
 } topology_error_t;
 
@@ -309,6 +625,205 @@ bool topology_probe_all_cores(topology_state_t *topology);
  */
 bool topology_build_cache_isolation_matrix(topology_state_t *topology);
 
+/**
+ * Compute one row of the cache isolation matrix
+ * 
+ * REQUIRES: l1/l2/l3 hold core_count cache domain IDs
+ * ENSURES:  out_row[j] = isolation level between core `row` and core j
+ * 
+ * The weak default in topology/isolation_rules.c is the scalar reference.
+ * arch/ overrides it with a vectorized version (AVX2/AVX-512 on x86_64)
+ * that must produce identical rows.
+ */
+void topology_build_isolation_row(
+    const cache_domain_t *l1,
+    const cache_domain_t *l2,
+    const cache_domain_t *l3,
+    uint32_t core_count,
+    uint32_t row,
+    uint8_t *out_row
+);
+
+/**
+ * Scalar reference for topology_build_isolation_row()
+ * 
+ * Always available; arch/ implementations fall back to it.
+ */
+void topology_build_isolation_row_scalar(
+    const cache_domain_t *l1,
+    const cache_domain_t *l2,
+    const cache_domain_t *l3,
+    uint32_t core_count,
+    uint32_t row,
+    uint8_t *out_row
+);
+
+/**
+ * Record measured latency between two cores
+ * 
+ * REQUIRES: topology not sealed
+ * ENSURES:  Latency is used as a proximity tie-break after NUMA distance
+ * 
+ * Latencies are saturated to 65535 ns. Symmetric: records both directions.
+ */
+bool topology_record_core_latency(
+    topology_state_t *topology,
+    core_id_t core_a,
+    core_id_t core_b,
+    uint32_t latency_ns
+);
+
+/**
+ * Build per-core proximity ordering
+ * 
+ * REQUIRES: Cache isolation matrix computed
+ * ENSURES:  topology_nearest_cores() answers in O(K + excluded)
+ * 
+ * Called by topology_seal(); cost is O(N^2 log N) once.
+ */
+bool topology_build_proximity_index(topology_state_t *topology);
+
+/**
+ * Measure effective frequency of one core (architecture hook)
+ * 
+ * REQUIRES: cpu is online
+ * ENSURES:  sample holds one measurement taken while pinned to cpu
+ * RETURNS:  false if the architecture cannot measure (weak default)
+ * 
+ * The caller's CPU affinity is restored before returning.
+ */
+bool topology_measure_core_frequency(
+    core_id_t cpu,
+    uint32_t loop_iterations,
+    core_frequency_sample_t *sample
+);
+
+/**
+ * Record one frequency sample for a core
+ * 
+ * REQUIRES: topology not sealed
+ * ENSURES:  base_freq_mhz = mean sample, max_freq_mhz = highest sample
+ * 
+ * APERF/MPERF is preferred for the mean when the sample carries it.
+ */
+bool topology_record_core_frequency(
+    topology_state_t *topology,
+    core_id_t core_id,
+    const core_frequency_sample_t *sample
+);
+
+/**
+ * Calibrate per-core frequencies
+ * 
+ * REQUIRES: All cores probed, topology not sealed
+ * ENSURES:  Every measurable core has samples_per_core samples
+ * RETURNS:  Number of cores calibrated (0 if measurement is unavailable)
+ * 
+ * config may be NULL for defaults. Sets the variation threshold used
+ * by topology validation (TOPOLOGY_WARN_FREQ_VARIATION).
+ */
+uint32_t topology_calibrate_frequencies(
+    topology_state_t *topology,
+    const topology_frequency_config_t *config
+);
+
+/**
+ * Measure OS noise on one core (architecture hook)
+ * 
+ * REQUIRES: cpu is online
+ * ENSURES:  noise holds every gap >= gap_threshold_ns seen in window_us
+ * RETURNS:  TOPOLOGY_MEASURE_UNSUPPORTED if the architecture cannot
+ *           measure (weak default), TOPOLOGY_MEASURE_FAILED if this
+ *           core could not be measured
+ * 
+ * The caller's CPU affinity is restored before returning.
+ */
+topology_measure_result_t topology_measure_core_noise(
+    core_id_t cpu,
+    uint32_t window_us,
+    uint32_t gap_threshold_ns,
+    core_noise_t *noise
+);
+
+/**
+ * Add one interruption gap to a noise record
+ * 
+ * Used by arch/ measurement loops; updates count, stolen time, max gap
+ * and histogram.
+ */
+void core_noise_record_gap(core_noise_t *noise, uint64_t gap_ns);
+
+/**
+ * Record a noise measurement for a core
+ * 
+ * REQUIRES: topology not sealed
+ */
+bool topology_record_core_noise(
+    topology_state_t *topology,
+    core_id_t core_id,
+    const core_noise_t *noise
+);
+
+/**
+ * Qualify candidate-isolated cores by OS noise
+ * 
+ * REQUIRES: All cores probed, topology not sealed
+ * ENSURES:  Every core marked `isolated` has a noise measurement, or
+ *           noise.failed if its own measurement failed
+ * RETURNS:  Number of cores measured (0 if measurement is unavailable)
+ * 
+ * config may be NULL for defaults; it also becomes the noise budget.
+ * Validation refuses to count a core over budget as isolated, and
+ * topology_seal() clears `isolated` on such cores.
+ */
+uint32_t topology_measure_noise(
+    topology_state_t *topology,
+    const topology_noise_config_t *config
+);
+
+/**
+ * Compute the reference (median core) frequency
+ * 
+ * REQUIRES: topology not sealed
+ * ENSURES:  freq_reference_mhz is the median of calibrated core means
+ * 
+ * Called by topology_validate(); a no-op if nothing was calibrated.
+ */
+void topology_summarize_frequencies(topology_state_t *topology);
+
+/**
+ * Index NUMA node membership
+ * 
+ * REQUIRES: topology not sealed
+ * ENSURES:  Each node's cores mask holds exactly the cores whose
+ *           numa_node is that node; core_count is its population
+ * 
+ * Called by topology_validate() before NUMA validation.
+ */
+void topology_index_numa_nodes(topology_state_t *topology);
+
+/**
+ * Classify NUMA memory tiers
+ * 
+ * REQUIRES: topology not sealed
+ * ENSURES:  Every node has a tier other than NUMA_TIER_UNKNOWN
+ * 
+ * Nodes with CPUs are DRAM. CPU-less nodes with more measured bandwidth
+ * than every CPU node are HBM; other CPU-less nodes are FAR.
+ * Called by topology_validate(); explicitly probed tiers are kept.
+ */
+void topology_classify_memory_tiers(topology_state_t *topology);
+
+/**
+ * Build hierarchical topology tree
+ * 
+ * REQUIRES: All cores probed
+ * ENSURES:  Subtree queries are contiguous slices
+ * 
+ * Called by topology_seal().
+ */
+bool topology_build_tree(topology_state_t *topology);
+
 /**
  * Validate topology
  * 
@@ -360,7 +875,8 @@ const core_geometry_t* topology_get_core_geometry(
  * Check cache isolation between two cores
  * 
  * REQUIRES: topology sealed
- * RETURNS:  Cache isolation level (O(1) lookup)
+ * RETURNS:  Cache isolation level (O(1) lookup); CACHE_ISOLATED_NONE
+ *           for a core against itself
  */
 cache_isolation_level_t topology_get_cache_isolation(
     const topology_state_t *topology,
@@ -404,6 +920,19 @@ bool topology_same_numa_node(
     core_id_t core_b
 );
 
+/**
+ * Find the NUMA node containing a set of cores
+ * 
+ * REQUIRES: topology validated; mask holds no core past the word of
+ *           the topology's last core
+ * RETURNS:  Node whose membership is a superset of mask, or
+ *           NUMA_NODE_INVALID if mask is empty or spans nodes
+ */
+numa_node_t topology_core_mask_numa_node(
+    const topology_state_t *topology,
+    const core_mask_t *mask
+);
+
 /**
  * Get NUMA distance between cores
  * 
@@ -416,6 +945,20 @@ uint32_t topology_get_numa_distance(
     core_id_t core_b
 );
 
+/**
+ * Get the nearest memory node of a tier
+ * 
+ * REQUIRES: topology validated
+ * RETURNS:  Node with the lowest distance from core_id's node, ties
+ *           broken by measured latency then node ID, or
+ *           NUMA_NODE_INVALID if no node has that tier
+ */
+numa_node_t topology_nearest_memory_node(
+    const topology_state_t *topology,
+    core_id_t core_id,
+    numa_memory_tier_t tier
+);
+
 /**
  * Check if core has SMT sibling
  * 
@@ -427,6 +970,139 @@ bool topology_has_smt_sibling(
     core_id_t core_id
 );
 
+/**
+ * Get mean calibrated frequency of a core
+ * 
+ * REQUIRES: topology probed
+ * RETURNS:  Mean MHz, or 0 if the core was not calibrated
+ */
+uint32_t topology_core_frequency_mhz(
+    const topology_state_t *topology,
+    core_id_t core_id
+);
+
+/**
+ * Get frequency spread of a core across samples
+ * 
+ * REQUIRES: topology probed
+ * RETURNS:  (max - min) / mean in permille, or 0 if not calibrated
+ */
+uint32_t topology_core_frequency_spread(
+    const topology_state_t *topology,
+    core_id_t core_id
+);
+
+/**
+ * Check if a core runs at a stable, representative frequency
+ * 
+ * REQUIRES: topology probed
+ * RETURNS:  false if the core's own spread, or its deviation from
+ *           freq_reference_mhz, exceeds the variation threshold
+ * 
+ * Determinism-sensitive placement should avoid cores that fail this
+ * (throttled or turbo-binned differently from their peers).
+ */
+bool topology_core_frequency_stable(
+    const topology_state_t *topology,
+    core_id_t core_id
+);
+
+/**
+ * Check a core's measured OS noise against the budget
+ * 
+ * REQUIRES: topology probed
+ * RETURNS:  true if unmeasured, or stolen time and max gap are in budget;
+ *           false if its measurement failed while another core's succeeded
+ */
+bool topology_core_noise_within_budget(
+    const topology_state_t *topology,
+    core_id_t core_id
+);
+
+/**
+ * Get the K cores closest to a core
+ * 
+ * REQUIRES: topology sealed
+ * RETURNS:  Number of cores written to out_cores (<= max_cores)
+ * 
+ * Candidates are ordered by the proximity index and filtered to those
+ * whose isolation from core_id is >= required_level and which are not
+ * in exclude (NULL = no exclusions).
+ */
+uint32_t topology_nearest_cores(
+    const topology_state_t *topology,
+    core_id_t core_id,
+    cache_isolation_level_t required_level,
+    const core_mask_t *exclude,
+    core_id_t *out_cores,
+    uint32_t max_cores
+);
+
+/**
+ * Check that every pair of cores in a mask is cache-isolated
+ * 
+ * REQUIRES: topology sealed
+ * REQUIRES: topology sealed; mask holds no core past the word of the
+ *           topology's last core (core_set_is_valid is checked first)
+ * RETURNS:  true if isolation between each two members is >= required_level;
+ *           false otherwise, or if mask holds a core >= core_count
+ * 
+ * Answered from the proximity index: the members' prefixes below
+ * required_level (their cache neighbours at that level) must not meet
+ * the mask, so cost follows cache sharing rather than member pairs.
+ */
+bool topology_core_mask_isolated(
+    const topology_state_t *topology,
+    const core_mask_t *mask,
+    cache_isolation_level_t required_level
+);
+
+/**
+ * Get tree node by index
+ * 
+ * REQUIRES: topology sealed
+ * RETURNS:  Node or NULL if index is out of range
+ */
+const topology_node_t* topology_tree_node(
+    const topology_state_t *topology,
+    uint32_t node
+);
+
+/**
+ * Get the ancestor of a CPU at a tree level
+ * 
+ * REQUIRES: topology sealed
+ * RETURNS:  Node index or TOPOLOGY_NODE_INVALID
+ */
+uint32_t topology_cpu_ancestor(
+    const topology_state_t *topology,
+    core_id_t cpu,
+    topology_level_t level
+);
+
+/**
+ * Get all CPUs under a tree node (e.g. "all cores under this L3")
+ * 
+ * REQUIRES: topology sealed
+ * RETURNS:  Contiguous CPU slice (count = 0 if node is invalid)
+ */
+topology_cpu_range_t topology_node_cpus(
+    const topology_state_t *topology,
+    uint32_t node
+);
+
+/**
+ * Get all CPUs sharing a CPU's ancestor at a level (includes the CPU)
+ * 
+ * Example: level = TOPOLOGY_LEVEL_CORE yields SMT siblings,
+ *          level = TOPOLOGY_LEVEL_L3 yields the CCX / L3 group.
+ */
+topology_cpu_range_t topology_cpu_siblings(
+    const topology_state_t *topology,
+    core_id_t cpu,
+    topology_level_t level
+);
+
 /**
  * Get cores that share cache at level
  * 
@@ -442,6 +1118,119 @@ uint32_t topology_get_cache_sharing_cores(
     uint32_t max_cores
 );
 
+/* ========================================================================
+ * OFFLINE IMPORT (sysfs snapshots)
+ * ======================================================================== */
+
+/*
+ * A snapshot is a copy of /sys/devices/system (its cpu/ and node/
+ * trees), plus an optional copy of /proc/cpuinfo named "cpuinfo" at
+ * the snapshot root. It can be read from a directory or from an
+ * uncompressed tar image held in memory.
+ */
+
+#define TOPOLOGY_SNAPSHOT_FILE_MAX  4096              /* Largest file read */
+#define TOPOLOGY_TAR_INDEX_SIZE     (1u << 16)        /* Power of two */
+
+/**
+ * Snapshot file reader
+ * 
+ * path is relative to the snapshot root (e.g. "cpu/online").
+ * RETURNS: true and the file contents (NUL-terminated, truncated to
+ *          size - 1) if the file exists
+ */
+typedef bool (*topology_snapshot_read_fn)(
+    const void *source,
+    const char *path,
+    char *buf,
+    uint32_t size
+);
+
+typedef struct {
+    topology_snapshot_read_fn read;
+    const void               *source;
+} topology_snapshot_t;
+
+/**
+ * In-memory tar image (ustar)
+ * 
+ * Member names are hashed into a fixed open-addressing index once, so
+ * each lookup is O(1) regardless of how many files the snapshot holds.
+ */
+typedef struct {
+    const uint8_t *data;
+    size_t         size;
+    char           prefix[256];     /* Leading path before "cpu/" */
+    uint32_t       member_count;
+    uint32_t       index[TOPOLOGY_TAR_INDEX_SIZE];  /* Header offset / 512 + 1 */
+} topology_tar_t;
+
+typedef enum {
+    TOPOLOGY_IMPORT_OK = 0,
+    TOPOLOGY_IMPORT_ERROR_NO_CPUS,          /* cpu/online missing or empty */
+    TOPOLOGY_IMPORT_ERROR_CPU_NUMBERING,    /* Online CPUs are not 0..N-1 */
+    TOPOLOGY_IMPORT_ERROR_TOO_MANY_CPUS,    /* Above MAX_CORES */
+    TOPOLOGY_IMPORT_ERROR_NODE_NUMBERING,   /* Nodes are not 0..N-1 */
+    TOPOLOGY_IMPORT_ERROR_TOO_MANY_NODES,   /* Above MAX_NUMA_NODES */
+    TOPOLOGY_IMPORT_ERROR_MISSING_FILE,     /* Required file absent */
+    TOPOLOGY_IMPORT_ERROR_MALFORMED,        /* Unparseable contents */
+    TOPOLOGY_IMPORT_ERROR_TAR_INVALID,      /* Bad header or checksum */
+    TOPOLOGY_IMPORT_ERROR_TAR_TOO_LARGE     /* Index full */
+} topology_import_error_t;
+
+/**
+ * Import outcome (path names the offending file, if any)
+ */
+typedef struct {
+    topology_import_error_t error;
+    char                    path[128];
+} topology_import_status_t;
+
+/**
+ * Open a snapshot directory
+ * 
+ * REQUIRES: root outlives snapshot
+ */
+void topology_snapshot_directory(topology_snapshot_t *snapshot, const char *root);
+
+/**
+ * Open a tar image
+ * 
+ * REQUIRES: data and tar outlive snapshot
+ * ENSURES:  Every member is indexed; names are made relative to the
+ *           directory that holds cpu/
+ * RETURNS:  false (status set) if the image is not a valid ustar
+ *           archive or holds no cpu/online
+ */
+bool topology_snapshot_tar(
+    topology_snapshot_t *snapshot,
+    topology_tar_t *tar,
+    const void *data,
+    size_t size,
+    topology_import_status_t *status
+);
+
+/**
+ * Import topology from a snapshot
+ * 
+ * REQUIRES: boot outlives topology
+ * ENSURES:  boot holds the facts a snapshot can supply (CPU and node
+ *           counts, SMT, memory, constant-time flags from cpuinfo);
+ *           topology is initialized from boot and probed, with cache
+ *           domains, SMT siblings, NUMA membership and distances,
+ *           frequencies and isolation filled in
+ * RETURNS:  false (status set) on the first missing or malformed fact
+ * 
+ * The result is unvalidated: run topology_validate() and
+ * topology_seal() exactly as at boot.
+ */
+bool topology_import_snapshot(
+    const topology_snapshot_t *snapshot,
+    boot_facts_t *boot,
+    topology_state_t *topology,
+    topology_import_status_t *status
+);
+
 /* ========================================================================
  * ERROR REPORTING
  * ======================================================================== */
@@ -451,6 +1240,11 @@ uint32_t topology_get_cache_sharing_cores(
  */
 const char* topology_error_string(topology_error_t error);
 
+/**
+ * Convert import error code to string
+ */
+const char* topology_import_error_string(topology_import_error_t error);
+
 /**
  * Print validation context
  */
@@ -469,13 +1263,19 @@ bool topology_validation_allows_boot(
  * COMPILE-TIME GUARANTEES
  * ======================================================================== */
 
-_Static_assert(MAX_CORES <= 256, 
-    "MAX_CORES must fit in uint8_t for compact representation");
+_Static_assert(MAX_CORES % 64 == 0,
+    "Core masks must be whole 64-bit words");
+
+_Static_assert(MAX_CORES <= UINT16_MAX,
+    "Proximity index stores core IDs as uint16_t");
 
 _Static_assert(MAX_NUMA_NODES <= 8,
     "MAX_NUMA_NODES must be reasonable for distance matrix");
 
-_Static_assert(sizeof(cache_isolation_matrix_t) <= 256 * 256,
-    "Cache isolation matrix must be cache-friendly");
+_Static_assert(sizeof(((cache_isolation_matrix_t *)0)->isolation) == MAX_CORES * MAX_CORES,
+    "Cache isolation matrix must use one byte per core pair");
+
+_Static_assert(CACHE_ISOLATED_FULL <= UINT8_MAX,
+    "Cache isolation levels must fit in a matrix byte");
 
 #endif /* UCQCF_TOPOLOGY_CONTRACT_H */
\ No newline at end of file
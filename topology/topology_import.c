@@ -0,0 +1,947 @@
+/**
+ * topology/topology_import.c
+ *
+ * Offline topology import from sysfs snapshots
+ *
+ * PURPOSE:
+ *   Build a topology_state_t from a captured copy of
+ *   /sys/devices/system/{cpu,node} so a domain configuration can be
+ *   validated against a production SKU without booting it.
+ *
+ * FACTS READ (paths relative to the snapshot root):
+ *   cpu/online, cpu/isolated
+ *   cpu/cpuN/topology/{physical_package_id,die_id,thread_siblings_list}
+ *   cpu/cpuN/cache/indexK/{level,type,size,coherency_line_size,
+ *                          ways_of_associativity,shared_cpu_list}
+ *   cpu/cpuN/cpufreq/{cpuinfo_max_freq,base_frequency,
+ *                     scaling_min_freq,scaling_max_freq}
+ *   node/online, node/nodeN/{cpulist,distance,meminfo}
+ *   node/nodeN/access0/initiators/{read_latency,read_bandwidth}
+ *   cpuinfo (copy of /proc/cpuinfo, for constant-time flags)
+ *
+ * MAPPING:
+ *   - Cache domain ID = lowest CPU in shared_cpu_list, so IDs are
+ *     below the CPU count; a missing level is private to the CPU
+ *   - physical_core = lowest CPU in thread_siblings_list
+ *   - No cpufreq directory means no scaling driver (fixed frequency)
+ *   - No node/ directory means a single node holding every CPU
+ *
+ * GUARANTEES:
+ *   - No dynamic allocation (tar image is caller-owned)
+ *   - First missing or malformed fact stops the import with its path
+ *   - Result is probed, never validated: the boot-time validators run
+ *     unchanged
+ */
+
+#include "topology_contract.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================
+ * DIRECTORY SOURCE
+ * ======================================================================== */
+
+static bool directory_read(
+    const void *source,
+    const char *path,
+    char *buf,
+    uint32_t size
+) {
+    char full[512];
+    int written = snprintf(full, sizeof(full), "%s/%s", (const char *)source, path);
+    if (written < 0 || (size_t)written >= sizeof(full)) {
+        return false;
+    }
+
+    FILE *file = fopen(full, "r");
+    if (!file) {
+        return false;
+    }
+
+    size_t length = fread(buf, 1, size - 1, file);
+    fclose(file);
+
+    buf[length] = '\0';
+    return true;
+}
+
+void topology_snapshot_directory(topology_snapshot_t *snapshot, const char *root) {
+    snapshot->read = directory_read;
+    snapshot->source = root;
+}
+
+/* ========================================================================
+ * TAR SOURCE (ustar, uncompressed)
+ * ======================================================================== */
+
+#define TAR_BLOCK         512
+#define TAR_NAME_OFFSET   0
+#define TAR_SIZE_OFFSET   124
+#define TAR_CHKSUM_OFFSET 148
+#define TAR_TYPE_OFFSET   156
+#define TAR_PREFIX_OFFSET 345
+
+static const char tar_anchor[] = "cpu/online";
+
+static uint64_t tar_octal(const uint8_t *field, uint32_t width) {
+    uint64_t value = 0;
+
+    for (uint32_t i = 0; i < width && field[i] >= '0' && field[i] <= '7'; i++) {
+        value = value * 8 + (uint64_t)(field[i] - '0');
+    }
+
+    return value;
+}
+
+static bool tar_header_valid(const uint8_t *header) {
+    uint64_t stored = tar_octal(header + TAR_CHKSUM_OFFSET, 8);
+    uint64_t sum = 0;
+
+    for (uint32_t i = 0; i < TAR_BLOCK; i++) {
+        bool in_chksum = i >= TAR_CHKSUM_OFFSET && i < TAR_CHKSUM_OFFSET + 8;
+        sum += in_chksum ? (uint8_t)' ' : header[i];
+    }
+
+    return sum == stored;
+}
+
+static bool tar_header_empty(const uint8_t *header) {
+    for (uint32_t i = 0; i < TAR_BLOCK; i++) {
+        if (header[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Full member name (prefix "/" name), leading "./" removed */
+static const char* tar_member_name(const uint8_t *header, char *out, size_t size) {
+    char name[101];
+    char prefix[156];
+
+    memcpy(name, header + TAR_NAME_OFFSET, 100);
+    name[100] = '\0';
+    memcpy(prefix, header + TAR_PREFIX_OFFSET, 155);
+    prefix[155] = '\0';
+
+    if (prefix[0] != '\0') {
+        snprintf(out, size, "%s/%s", prefix, name);
+    } else {
+        snprintf(out, size, "%s", name);
+    }
+
+    while (out[0] == '.' && out[1] == '/') {
+        memmove(out, out + 2, strlen(out + 2) + 1);
+    }
+
+    return out;
+}
+
+static uint32_t tar_hash(const char *path) {
+    uint32_t hash = 2166136261u;   /* FNV-1a */
+
+    for (; *path; path++) {
+        hash = (hash ^ (uint8_t)*path) * 16777619u;
+    }
+
+    return hash & (TOPOLOGY_TAR_INDEX_SIZE - 1);
+}
+
+/* Walks every regular-file member; visit returns false to stop */
+typedef bool (*tar_visit_fn)(
+    topology_tar_t *tar, size_t offset, const char *name, bool *found);
+
+static bool tar_walk(topology_tar_t *tar, tar_visit_fn visit, bool *found) {
+    char name[260];
+    size_t offset = 0;
+
+    while (offset + TAR_BLOCK <= tar->size) {
+        const uint8_t *header = tar->data + offset;
+
+        if (tar_header_empty(header)) {
+            return true;   /* End-of-archive marker */
+        }
+
+        if (!tar_header_valid(header)) {
+            return false;
+        }
+
+        uint64_t size = tar_octal(header + TAR_SIZE_OFFSET, 12);
+        uint64_t blocks = (size + TAR_BLOCK - 1) / TAR_BLOCK;
+
+        if (size > tar->size || offset + TAR_BLOCK + blocks * TAR_BLOCK > tar->size) {
+            return false;
+        }
+
+        char type = (char)header[TAR_TYPE_OFFSET];
+        if (type == '0' || type == '\0') {
+            if (!visit(tar, offset, tar_member_name(header, name, sizeof(name)),
+                       found)) {
+                return true;
+            }
+        }
+
+        offset += TAR_BLOCK + blocks * TAR_BLOCK;
+    }
+
+    /* Archives without the trailing zero blocks are still accepted */
+    return offset == tar->size;
+}
+
+static bool tar_find_prefix(
+    topology_tar_t *tar,
+    size_t offset,
+    const char *name,
+    bool *found
+) {
+    (void)offset;
+    size_t length = strlen(name);
+    size_t anchor = sizeof(tar_anchor) - 1;
+
+    if (length < anchor || strcmp(name + length - anchor, tar_anchor) != 0) {
+        return true;
+    }
+
+    size_t prefix = length - anchor;
+    if (prefix > 0 && name[prefix - 1] != '/') {
+        return true;   /* e.g. "foocpu/online" */
+    }
+
+    if (prefix >= sizeof(tar->prefix)) {
+        return true;
+    }
+
+    memcpy(tar->prefix, name, prefix);
+    tar->prefix[prefix] = '\0';
+    *found = true;
+    return false;
+}
+
+static bool tar_index_member(
+    topology_tar_t *tar,
+    size_t offset,
+    const char *name,
+    bool *found
+) {
+    (void)found;
+    size_t prefix = strlen(tar->prefix);
+
+    if (strncmp(name, tar->prefix, prefix) != 0) {
+        return true;   /* Outside the snapshot root */
+    }
+
+    if (tar->member_count >= TOPOLOGY_TAR_INDEX_SIZE / 2) {
+        tar->member_count = UINT32_MAX;   /* Keep load factor <= 0.5 */
+        return false;
+    }
+
+    uint32_t slot = tar_hash(name + prefix);
+    while (tar->index[slot] != 0) {
+        slot = (slot + 1) & (TOPOLOGY_TAR_INDEX_SIZE - 1);
+    }
+
+    tar->index[slot] = (uint32_t)(offset / TAR_BLOCK) + 1;
+    tar->member_count++;
+    return true;
+}
+
+static bool tar_read(
+    const void *source,
+    const char *path,
+    char *buf,
+    uint32_t size
+) {
+    const topology_tar_t *tar = source;
+    char name[260];
+    size_t prefix = strlen(tar->prefix);
+
+    for (uint32_t slot = tar_hash(path); tar->index[slot] != 0;
+         slot = (slot + 1) & (TOPOLOGY_TAR_INDEX_SIZE - 1)) {
+        const uint8_t *header = tar->data + (size_t)(tar->index[slot] - 1) * TAR_BLOCK;
+
+        if (strcmp(tar_member_name(header, name, sizeof(name)) + prefix, path) != 0) {
+            continue;
+        }
+
+        uint64_t length = tar_octal(header + TAR_SIZE_OFFSET, 12);
+        if (length > size - 1) {
+            length = size - 1;
+        }
+
+        memcpy(buf, header + TAR_BLOCK, (size_t)length);
+        buf[length] = '\0';
+        return true;
+    }
+
+    return false;
+}
+
+bool topology_snapshot_tar(
+    topology_snapshot_t *snapshot,
+    topology_tar_t *tar,
+    const void *data,
+    size_t size,
+    topology_import_status_t *status
+) {
+    memset(tar, 0, sizeof(*tar));
+    tar->data = data;
+    tar->size = size;
+
+    memset(status, 0, sizeof(*status));
+
+    /* Pass 1: locate the snapshot root via cpu/online */
+    bool found = false;
+
+    if (!tar_walk(tar, tar_find_prefix, &found)) {
+        status->error = TOPOLOGY_IMPORT_ERROR_TAR_INVALID;
+        return false;
+    }
+
+    if (!found) {
+        status->error = TOPOLOGY_IMPORT_ERROR_NO_CPUS;
+        snprintf(status->path, sizeof(status->path), "%s", tar_anchor);
+        return false;
+    }
+
+    /* Pass 2: index every member under the root (pass 1 may stop early) */
+    if (!tar_walk(tar, tar_index_member, &found)) {
+        status->error = TOPOLOGY_IMPORT_ERROR_TAR_INVALID;
+        return false;
+    }
+
+    if (tar->member_count == UINT32_MAX) {
+        status->error = TOPOLOGY_IMPORT_ERROR_TAR_TOO_LARGE;
+        return false;
+    }
+
+    snapshot->read = tar_read;
+    snapshot->source = tar;
+    return true;
+}
+
+/* ========================================================================
+ * PARSING
+ * ======================================================================== */
+
+typedef struct {
+    const topology_snapshot_t *snapshot;
+    topology_import_status_t  *status;
+    char                       path[128];
+    char                       buf[TOPOLOGY_SNAPSHOT_FILE_MAX];
+} import_ctx_t;
+
+static bool import_fail(import_ctx_t *ctx, topology_import_error_t error) {
+    ctx->status->error = error;
+    snprintf(ctx->status->path, sizeof(ctx->status->path), "%s", ctx->path);
+    return false;
+}
+
+/* Read a snapshot file into ctx->buf; a missing required file fails */
+__attribute__((format(printf, 3, 4)))
+static bool import_read(import_ctx_t *ctx, bool required, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(ctx->path, sizeof(ctx->path), fmt, args);
+    va_end(args);
+
+    if (ctx->snapshot->read(ctx->snapshot->source, ctx->path,
+                            ctx->buf, sizeof(ctx->buf))) {
+        return true;
+    }
+
+    if (required) {
+        import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MISSING_FILE);
+    }
+    return false;
+}
+
+static const char* skip_space(const char *text) {
+    while (*text == ' ' || *text == '\t' || *text == '\n') {
+        text++;
+    }
+    return text;
+}
+
+static bool parse_u32_at(const char **text, uint32_t *value) {
+    const char *p = *text;
+    uint64_t v = 0;
+
+    if (*p < '0' || *p > '9') {
+        return false;
+    }
+
+    for (; *p >= '0' && *p <= '9'; p++) {
+        v = v * 10 + (uint64_t)(*p - '0');
+        if (v > UINT32_MAX) {
+            return false;
+        }
+    }
+
+    *value = (uint32_t)v;
+    *text = p;
+    return true;
+}
+
+/* Whole-file unsigned integer */
+static bool parse_u32(const char *text, uint32_t *value) {
+    text = skip_space(text);
+    return parse_u32_at(&text, value) && *skip_space(text) == '\0';
+}
+
+/* Cache size: "48K", "2048K", "32M" */
+static bool parse_size(const char *text, uint32_t *bytes) {
+    text = skip_space(text);
+
+    uint32_t value;
+    if (!parse_u32_at(&text, &value)) {
+        return false;
+    }
+
+    uint64_t scaled = value;
+    if (*text == 'K') {
+        scaled *= 1024;
+        text++;
+    } else if (*text == 'M') {
+        scaled *= 1024 * 1024;
+        text++;
+    }
+
+    if (scaled > UINT32_MAX || *skip_space(text) != '\0') {
+        return false;
+    }
+
+    *bytes = (uint32_t)scaled;
+    return true;
+}
+
+typedef enum {
+    LIST_OK = 0,
+    LIST_MALFORMED,
+    LIST_OUT_OF_RANGE
+} list_result_t;
+
+/* Kernel list format: "0-3,8,10-11" (empty allowed) */
+static list_result_t parse_list(const char *text, core_mask_t *mask, uint32_t limit) {
+    memset(mask, 0, sizeof(*mask));
+    text = skip_space(text);
+
+    while (*text != '\0') {
+        uint32_t first, last;
+
+        if (!parse_u32_at(&text, &first)) {
+            return LIST_MALFORMED;
+        }
+
+        last = first;
+        if (*text == '-') {
+            text++;
+            if (!parse_u32_at(&text, &last) || last < first) {
+                return LIST_MALFORMED;
+            }
+        }
+
+        if (last >= limit) {
+            return LIST_OUT_OF_RANGE;
+        }
+
+        for (uint32_t id = first; id <= last; id++) {
+            core_mask_set(mask, id);
+        }
+
+        if (*text == ',') {
+            text++;
+        } else if (*skip_space(text) != '\0') {
+            return LIST_MALFORMED;
+        } else {
+            break;
+        }
+    }
+
+    return LIST_OK;
+}
+
+static bool import_list(
+    import_ctx_t *ctx,
+    core_mask_t *mask,
+    uint32_t limit,
+    topology_import_error_t out_of_range
+) {
+    switch (parse_list(ctx->buf, mask, limit)) {
+        case LIST_OK:           return true;
+        case LIST_OUT_OF_RANGE: return import_fail(ctx, out_of_range);
+        default:                return import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MALFORMED);
+    }
+}
+
+static bool import_u32(import_ctx_t *ctx, uint32_t *value) {
+    return parse_u32(ctx->buf, value) ||
+           import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MALFORMED);
+}
+
+static core_id_t mask_first(const core_mask_t *mask) {
+    for (uint32_t w = 0; w < CORE_MASK_WORDS; w++) {
+        if (mask->bits[w] != 0) {
+            return w * 64 + (core_id_t)__builtin_ctzll(mask->bits[w]);
+        }
+    }
+    return CORE_ID_INVALID;
+}
+
+/* Mask is exactly {0 .. count-1} */
+static bool mask_is_prefix(const core_mask_t *mask, uint32_t *count) {
+    *count = core_mask_count(mask, CORE_MASK_WORDS);   /* core_count not known yet */
+    return *count == 0 ||
+           (core_mask_test(mask, *count - 1) && !core_mask_test(mask, *count) &&
+            mask_first(mask) == 0);
+}
+
+/* ========================================================================
+ * BOOT FACTS
+ * ======================================================================== */
+
+static bool cpuinfo_has_flag(const char *flags, const char *flag) {
+    size_t length = strlen(flag);
+
+    for (const char *p = strstr(flags, flag); p; p = strstr(p + 1, flag)) {
+        bool starts = p[-1] == ' ' || p[-1] == '\t';
+        bool ends = p[length] == ' ' || p[length] == '\n' || p[length] == '\0';
+        if (starts && ends) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void import_cpuinfo(import_ctx_t *ctx, boot_facts_t *boot) {
+    if (!import_read(ctx, false, "cpuinfo")) {
+        return;
+    }
+
+    const char *flags = strstr(ctx->buf, "\nflags");
+    if (!flags) {
+        return;
+    }
+
+    char *end = strchr(flags + 1, '\n');
+    if (end) {
+        *end = '\0';
+    }
+
+    constant_time_support_t *ct = &boot->constant_time;
+    ct->aes_ni = cpuinfo_has_flag(flags, "aes");
+    ct->rdrand = cpuinfo_has_flag(flags, "rdrand");
+    ct->rdseed = cpuinfo_has_flag(flags, "rdseed");
+    ct->constant_time_mul = true;
+    ct->constant_time_cmp = true;
+    ct->valid = true;
+
+    boot->constant_time_supported = ct->aes_ni && ct->rdrand;
+}
+
+/* ========================================================================
+ * PER-CPU FACTS
+ * ======================================================================== */
+
+static bool import_caches(import_ctx_t *ctx, core_geometry_t *geom, core_id_t cpu,
+                          uint32_t cpu_count) {
+    /* Absent levels are private */
+    geom->l1_domain = cpu;
+    geom->l2_domain = cpu;
+    geom->l3_domain = cpu;
+
+    cache_hierarchy_t *hierarchy = &geom->cache_hierarchy;
+
+    for (uint32_t index = 0; ; index++) {
+        if (!import_read(ctx, false, "cpu/cpu%u/cache/index%u/level", cpu, index)) {
+            break;
+        }
+
+        uint32_t level;
+        if (!import_u32(ctx, &level)) {
+            return false;
+        }
+
+        if (!import_read(ctx, true, "cpu/cpu%u/cache/index%u/type", cpu, index)) {
+            return false;
+        }
+
+        if (strncmp(ctx->buf, "Instruction", 11) == 0) {
+            continue;
+        }
+
+        cache_type_t type = strncmp(ctx->buf, "Data", 4) == 0
+                          ? CACHE_TYPE_DATA : CACHE_TYPE_UNIFIED;
+
+        core_mask_t shared;
+        if (!import_read(ctx, true, "cpu/cpu%u/cache/index%u/shared_cpu_list",
+                         cpu, index) ||
+            !import_list(ctx, &shared, cpu_count, TOPOLOGY_IMPORT_ERROR_MALFORMED)) {
+            return false;
+        }
+
+        if (!core_mask_test(&shared, cpu)) {
+            return import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MALFORMED);
+        }
+
+        cache_domain_t domain = mask_first(&shared);
+        switch (level) {
+            case 1: geom->l1_domain = domain; break;
+            case 2: geom->l2_domain = domain; break;
+            case 3: geom->l3_domain = domain; break;
+            default: break;
+        }
+
+        if (hierarchy->level_count >= MAX_CACHE_LEVELS) {
+            continue;
+        }
+
+        cache_level_t *cache = &hierarchy->levels[hierarchy->level_count++];
+        cache->type = type;
+        cache->shared_with = shared;
+        cache->sharing_count = core_mask_count(&shared,
+                                               core_mask_words(cpu_count));
+        cache->shared = cache->sharing_count > 1;
+
+        if (import_read(ctx, false, "cpu/cpu%u/cache/index%u/size", cpu, index) &&
+            !parse_size(ctx->buf, &cache->size_bytes)) {
+            return import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MALFORMED);
+        }
+
+        if (import_read(ctx, false, "cpu/cpu%u/cache/index%u/coherency_line_size",
+                        cpu, index) && !import_u32(ctx, &cache->line_size)) {
+            return false;
+        }
+
+        if (import_read(ctx, false, "cpu/cpu%u/cache/index%u/ways_of_associativity",
+                        cpu, index) && !import_u32(ctx, &cache->associativity)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool import_frequency(import_ctx_t *ctx, core_geometry_t *geom, core_id_t cpu) {
+    uint32_t max_khz = 0, base_khz = 0, min_scaling = 0, max_scaling = 0;
+
+    /* No cpufreq directory: no scaling driver, frequency is fixed */
+    if (!import_read(ctx, false, "cpu/cpu%u/cpufreq/cpuinfo_max_freq", cpu)) {
+        geom->freq_scaling_disabled = true;
+        return true;
+    }
+
+    if (!import_u32(ctx, &max_khz)) {
+        return false;
+    }
+
+    base_khz = max_khz;
+    if (import_read(ctx, false, "cpu/cpu%u/cpufreq/base_frequency", cpu) &&
+        !import_u32(ctx, &base_khz)) {
+        return false;
+    }
+
+    /* Scaling is disabled when the governor range is pinned */
+    bool pinned = import_read(ctx, false, "cpu/cpu%u/cpufreq/scaling_min_freq", cpu) &&
+                  import_u32(ctx, &min_scaling) &&
+                  import_read(ctx, false, "cpu/cpu%u/cpufreq/scaling_max_freq", cpu) &&
+                  import_u32(ctx, &max_scaling) &&
+                  min_scaling == max_scaling;
+
+    if (ctx->status->error != TOPOLOGY_IMPORT_OK) {
+        return false;
+    }
+
+    geom->max_freq_mhz = max_khz / 1000;
+    geom->base_freq_mhz = base_khz / 1000;
+    geom->freq_scaling_disabled = pinned;
+    return true;
+}
+
+static bool import_cpu(
+    import_ctx_t *ctx,
+    topology_state_t *topology,
+    core_id_t cpu,
+    const core_mask_t *isolated,
+    uint32_t *threads_per_core
+) {
+    core_geometry_t *geom = &topology->cores[cpu];
+    uint32_t package;
+
+    if (!import_read(ctx, true, "cpu/cpu%u/topology/physical_package_id", cpu) ||
+        !import_u32(ctx, &package)) {
+        return false;
+    }
+
+    geom->socket_id = package;
+    geom->package_id = package;
+
+    if (import_read(ctx, false, "cpu/cpu%u/topology/die_id", cpu) &&
+        !import_u32(ctx, &geom->die_id)) {
+        return false;
+    }
+
+    core_mask_t siblings;
+    if (!import_read(ctx, true, "cpu/cpu%u/topology/thread_siblings_list", cpu) ||
+        !import_list(ctx, &siblings, topology->core_count,
+                     TOPOLOGY_IMPORT_ERROR_MALFORMED)) {
+        return false;
+    }
+
+    if (!core_mask_test(&siblings, cpu)) {
+        return import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MALFORMED);
+    }
+
+    uint32_t threads = core_mask_count(&siblings, core_mask_words(topology->core_count));
+    if (threads > *threads_per_core) {
+        *threads_per_core = threads;
+    }
+
+    geom->physical_core = mask_first(&siblings);
+    geom->has_smt = threads > 1;
+    geom->smt_sibling = cpu;
+
+    if (geom->has_smt) {
+        core_mask_t others = siblings;
+        others.bits[cpu / 64] &= ~(1ULL << (cpu % 64));
+        geom->smt_sibling = mask_first(&others);
+    }
+
+    if (!import_caches(ctx, geom, cpu, topology->core_count) ||
+        !import_frequency(ctx, geom, cpu)) {
+        return false;
+    }
+
+    geom->online = true;
+    geom->isolated = core_mask_test(isolated, cpu);
+    geom->supports_constant_time = topology->boot_facts->constant_time_supported;
+
+    return true;
+}
+
+/* ========================================================================
+ * NUMA FACTS
+ * ======================================================================== */
+
+static bool import_single_node(topology_state_t *topology, boot_facts_t *boot) {
+    numa_node_info_t *node = &topology->numa_nodes[0];
+
+    topology->numa_node_count = 1;
+    node->id = 0;
+    node->distance[0] = 10;
+    node->memory_mb = (uint32_t)boot->total_memory_mb;
+
+    for (core_id_t cpu = 0; cpu < topology->core_count; cpu++) {
+        topology->cores[cpu].numa_node = 0;
+        topology->cores[cpu].numa_distance[0] = 10;
+    }
+
+    boot->numa_nodes = 1;
+    return true;
+}
+
+static bool import_node(
+    import_ctx_t *ctx,
+    topology_state_t *topology,
+    numa_node_t n,
+    uint32_t node_count
+) {
+    numa_node_info_t *node = &topology->numa_nodes[n];
+    node->id = n;
+
+    core_mask_t cpus;
+    if (!import_read(ctx, true, "node/node%u/cpulist", n) ||
+        !import_list(ctx, &cpus, topology->core_count,
+                     TOPOLOGY_IMPORT_ERROR_MALFORMED)) {
+        return false;
+    }
+
+    node->cpu_less = core_mask_count(&cpus, core_mask_words(topology->core_count)) == 0;
+
+    for (core_id_t cpu = 0; cpu < topology->core_count; cpu++) {
+        if (core_mask_test(&cpus, cpu)) {
+            topology->cores[cpu].numa_node = n;
+        }
+    }
+
+    /* SLIT row: exactly one distance per node */
+    if (!import_read(ctx, true, "node/node%u/distance", n)) {
+        return false;
+    }
+
+    const char *text = skip_space(ctx->buf);
+    for (uint32_t m = 0; m < node_count; m++) {
+        if (!parse_u32_at(&text, &node->distance[m])) {
+            return import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MALFORMED);
+        }
+        text = skip_space(text);
+    }
+
+    if (*text != '\0') {
+        return import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MALFORMED);
+    }
+
+    /* "Node 0 MemTotal:       65536000 kB" */
+    if (import_read(ctx, false, "node/node%u/meminfo", n)) {
+        const char *total = strstr(ctx->buf, "MemTotal:");
+        uint32_t kb;
+
+        if (total) {
+            text = skip_space(total + 9);
+            if (!parse_u32_at(&text, &kb)) {
+                return import_fail(ctx, TOPOLOGY_IMPORT_ERROR_MALFORMED);
+            }
+            node->memory_mb = kb / 1024;
+        }
+    }
+
+    /* HMAT access characteristics (optional) */
+    if (import_read(ctx, false, "node/node%u/access0/initiators/read_latency", n) &&
+        !import_u32(ctx, &node->latency_ns)) {
+        return false;
+    }
+
+    if (import_read(ctx, false, "node/node%u/access0/initiators/read_bandwidth", n) &&
+        !import_u32(ctx, &node->bandwidth_mbps)) {
+        return false;
+    }
+
+    return true;
+}
+
+static bool import_nodes(import_ctx_t *ctx, topology_state_t *topology,
+                         boot_facts_t *boot) {
+    if (!import_read(ctx, false, "node/online")) {
+        return import_single_node(topology, boot);
+    }
+
+    core_mask_t online;
+    uint32_t node_count;
+
+    if (!import_list(ctx, &online, MAX_NUMA_NODES,
+                     TOPOLOGY_IMPORT_ERROR_TOO_MANY_NODES)) {
+        return false;
+    }
+
+    if (!mask_is_prefix(&online, &node_count) || node_count == 0) {
+        return import_fail(ctx, TOPOLOGY_IMPORT_ERROR_NODE_NUMBERING);
+    }
+
+    topology->numa_node_count = node_count;
+    boot->numa_nodes = 0;
+    boot->total_memory_mb = 0;
+
+    for (numa_node_t n = 0; n < node_count; n++) {
+        if (!import_node(ctx, topology, n, node_count)) {
+            return false;
+        }
+
+        if (!topology->numa_nodes[n].cpu_less) {
+            boot->numa_nodes++;
+        }
+        boot->total_memory_mb += topology->numa_nodes[n].memory_mb;
+    }
+
+    for (core_id_t cpu = 0; cpu < topology->core_count; cpu++) {
+        core_geometry_t *geom = &topology->cores[cpu];
+
+        for (uint32_t m = 0; m < node_count; m++) {
+            geom->numa_distance[m] = topology->numa_nodes[geom->numa_node].distance[m];
+        }
+    }
+
+    return true;
+}
+
+/* ========================================================================
+ * IMPORT
+ * ======================================================================== */
+
+bool topology_import_snapshot(
+    const topology_snapshot_t *snapshot,
+    boot_facts_t *boot,
+    topology_state_t *topology,
+    topology_import_status_t *status
+) {
+    import_ctx_t ctx = { .snapshot = snapshot, .status = status };
+    memset(status, 0, sizeof(*status));
+    memset(boot, 0, sizeof(*boot));
+
+    /* CPU numbering must be dense: core IDs index every table */
+    core_mask_t online;
+    uint32_t cpu_count;
+
+    if (!import_read(&ctx, false, "cpu/online")) {
+        return import_fail(&ctx, TOPOLOGY_IMPORT_ERROR_NO_CPUS);
+    }
+
+    if (!import_list(&ctx, &online, MAX_CORES, TOPOLOGY_IMPORT_ERROR_TOO_MANY_CPUS)) {
+        return false;
+    }
+
+    if (!mask_is_prefix(&online, &cpu_count)) {
+        return import_fail(&ctx, TOPOLOGY_IMPORT_ERROR_CPU_NUMBERING);
+    }
+
+    if (cpu_count == 0) {
+        return import_fail(&ctx, TOPOLOGY_IMPORT_ERROR_NO_CPUS);
+    }
+
+    boot->cpu_count = cpu_count;
+    import_cpuinfo(&ctx, boot);
+
+    topology_init(topology, boot);
+    if (!topology_probe_all_cores(topology)) {
+        return import_fail(&ctx, TOPOLOGY_IMPORT_ERROR_NO_CPUS);
+    }
+
+    core_mask_t isolated = { 0 };
+    if (import_read(&ctx, false, "cpu/isolated") &&
+        !import_list(&ctx, &isolated, cpu_count, TOPOLOGY_IMPORT_ERROR_MALFORMED)) {
+        return false;
+    }
+
+    uint32_t threads_per_core = 1;
+    for (core_id_t cpu = 0; cpu < cpu_count; cpu++) {
+        if (!import_cpu(&ctx, topology, cpu, &isolated, &threads_per_core)) {
+            return false;
+        }
+    }
+
+    boot->threads_per_core = threads_per_core;
+    boot->smt_enabled = threads_per_core > 1;
+
+    return import_nodes(&ctx, topology, boot);
+}
+
+/* ========================================================================
+ * ERROR REPORTING
+ * ======================================================================== */
+
+const char* topology_import_error_string(topology_import_error_t error) {
+    switch (error) {
+        case TOPOLOGY_IMPORT_OK:
+            return "No error";
+        case TOPOLOGY_IMPORT_ERROR_NO_CPUS:
+            return "Snapshot has no online CPUs";
+        case TOPOLOGY_IMPORT_ERROR_CPU_NUMBERING:
+            return "Online CPUs are not numbered 0..N-1";
+        case TOPOLOGY_IMPORT_ERROR_TOO_MANY_CPUS:
+            return "Snapshot exceeds MAX_CORES";
+        case TOPOLOGY_IMPORT_ERROR_NODE_NUMBERING:
+            return "NUMA nodes are not numbered 0..N-1";
+        case TOPOLOGY_IMPORT_ERROR_TOO_MANY_NODES:
+            return "Snapshot exceeds MAX_NUMA_NODES";
+        case TOPOLOGY_IMPORT_ERROR_MISSING_FILE:
+            return "Required snapshot file missing";
+        case TOPOLOGY_IMPORT_ERROR_MALFORMED:
+            return "Malformed snapshot file";
+        case TOPOLOGY_IMPORT_ERROR_TAR_INVALID:
+            return "Invalid tar archive";
+        case TOPOLOGY_IMPORT_ERROR_TAR_TOO_LARGE:
+            return "Tar archive has too many members";
+        default:
+            return "Unknown error";
+    }
+}
@@ -0,0 +1,222 @@
+/**
+ * topology/topology_tree.c
+ *
+ * Hierarchical topology tree
+ *
+ * PURPOSE:
+ *   Turn the flat cores[] array and its scattered ID fields into a
+ *   sealed machine -> package -> die -> L3 -> L2 -> core -> thread tree,
+ *   so packing and spreading algorithms can walk subtrees directly.
+ *
+ * LAYOUT:
+ *   - nodes[] is breadth-first: each level is contiguous, and each
+ *     node's children are contiguous
+ *   - cpu_order[] lists CPUs grouped by subtree, so any node's CPUs
+ *     are a single slice (no ID comparisons at query time)
+ *
+ * GUARANTEES:
+ *   - Deterministic (CPUs ordered by hierarchy key, then CPU ID)
+ *   - No memory allocation
+ */
+
+#include "topology_contract.h"
+#include <stddef.h>
+
+/* ========================================================================
+ * HIERARCHY KEYS
+ * ======================================================================== */
+
+static uint32_t level_key(
+    const topology_state_t *topology,
+    core_id_t cpu,
+    topology_level_t level
+) {
+    const core_geometry_t *core = &topology->cores[cpu];
+
+    switch (level) {
+        case TOPOLOGY_LEVEL_PACKAGE: return core->package_id;
+        case TOPOLOGY_LEVEL_DIE:     return core->die_id;
+        case TOPOLOGY_LEVEL_L3:      return core->l3_domain;
+        case TOPOLOGY_LEVEL_L2:      return core->l2_domain;
+        case TOPOLOGY_LEVEL_CORE:    return core->l1_domain;
+        case TOPOLOGY_LEVEL_THREAD:  return cpu;
+        default:                     return 0;
+    }
+}
+
+/* Lexicographic comparison from package down to thread */
+static bool cpu_precedes(
+    const topology_state_t *topology,
+    core_id_t a,
+    core_id_t b
+) {
+    for (uint32_t level = TOPOLOGY_LEVEL_PACKAGE;
+         level < TOPOLOGY_LEVEL_COUNT; level++) {
+        uint32_t key_a = level_key(topology, a, (topology_level_t)level);
+        uint32_t key_b = level_key(topology, b, (topology_level_t)level);
+
+        if (key_a != key_b) {
+            return key_a < key_b;
+        }
+    }
+    return false;
+}
+
+/* ========================================================================
+ * CONSTRUCTION
+ * ======================================================================== */
+
+bool topology_build_tree(topology_state_t *topology) {
+    if (!topology->probed) {
+        return false;
+    }
+
+    if (topology->sealed) {
+        return false;
+    }
+
+    topology_tree_t *tree = &topology->tree;
+    uint32_t cpu_count = topology->core_count;
+
+    /* Order CPUs by hierarchy key (insertion sort; runs once at seal) */
+    for (core_id_t cpu = 0; cpu < cpu_count; cpu++) {
+        uint32_t pos = cpu;
+        while (pos > 0 && cpu_precedes(topology, cpu, tree->cpu_order[pos - 1])) {
+            tree->cpu_order[pos] = tree->cpu_order[pos - 1];
+            pos--;
+        }
+        tree->cpu_order[pos] = cpu;
+    }
+
+    /* Root covers every CPU */
+    tree->nodes[0] = (topology_node_t) {
+        .level       = TOPOLOGY_LEVEL_MACHINE,
+        .id          = 0,
+        .parent      = TOPOLOGY_NODE_INVALID,
+        .first_child = 0,
+        .child_count = 0,
+        .first_cpu   = 0,
+        .cpu_count   = cpu_count,
+    };
+    tree->node_count = 1;
+    tree->level_start[TOPOLOGY_LEVEL_MACHINE] = 0;
+
+    /* Split each parent's CPU slice into runs of equal key, level by level */
+    for (uint32_t level = TOPOLOGY_LEVEL_PACKAGE;
+         level < TOPOLOGY_LEVEL_COUNT; level++) {
+        uint32_t parents_begin = tree->level_start[level - 1];
+        uint32_t parents_end = tree->node_count;
+
+        tree->level_start[level] = tree->node_count;
+
+        for (uint32_t p = parents_begin; p < parents_end; p++) {
+            topology_node_t *parent = &tree->nodes[p];
+            uint32_t end = parent->first_cpu + parent->cpu_count;
+
+            parent->first_child = tree->node_count;
+            parent->child_count = 0;
+
+            for (uint32_t pos = parent->first_cpu; pos < end; pos++) {
+                core_id_t cpu = tree->cpu_order[pos];
+                uint32_t key = level_key(topology, cpu, (topology_level_t)level);
+
+                topology_node_t *last = &tree->nodes[tree->node_count - 1];
+                if (parent->child_count == 0 || last->id != key) {
+                    if (tree->node_count >= MAX_TOPOLOGY_NODES) {
+                        return false;
+                    }
+
+                    tree->nodes[tree->node_count++] = (topology_node_t) {
+                        .level       = (topology_level_t)level,
+                        .id          = key,
+                        .parent      = p,
+                        .first_child = 0,
+                        .child_count = 0,
+                        .first_cpu   = pos,
+                        .cpu_count   = 0,
+                    };
+                    parent->child_count++;
+                    last = &tree->nodes[tree->node_count - 1];
+                }
+
+                last->cpu_count++;
+
+                if (level == TOPOLOGY_LEVEL_THREAD) {
+                    tree->cpu_leaf[cpu] = tree->node_count - 1;
+                }
+            }
+        }
+    }
+
+    tree->level_start[TOPOLOGY_LEVEL_COUNT] = tree->node_count;
+    tree->built = true;
+
+    return true;
+}
+
+/* ========================================================================
+ * QUERIES
+ * ======================================================================== */
+
+const topology_node_t* topology_tree_node(
+    const topology_state_t *topology,
+    uint32_t node
+) {
+    if (!topology->sealed || !topology->tree.built) {
+        return NULL;
+    }
+
+    if (node >= topology->tree.node_count) {
+        return NULL;
+    }
+
+    return &topology->tree.nodes[node];
+}
+
+uint32_t topology_cpu_ancestor(
+    const topology_state_t *topology,
+    core_id_t cpu,
+    topology_level_t level
+) {
+    if (!topology->sealed || !topology->tree.built) {
+        return TOPOLOGY_NODE_INVALID;
+    }
+
+    if (cpu >= topology->core_count || level >= TOPOLOGY_LEVEL_COUNT) {
+        return TOPOLOGY_NODE_INVALID;
+    }
+
+    const topology_tree_t *tree = &topology->tree;
+    uint32_t node = tree->cpu_leaf[cpu];
+
+    while (tree->nodes[node].level > level) {
+        node = tree->nodes[node].parent;
+    }
+
+    return node;
+}
+
+topology_cpu_range_t topology_node_cpus(
+    const topology_state_t *topology,
+    uint32_t node
+) {
+    topology_cpu_range_t range = { .cpus = NULL, .count = 0 };
+
+    const topology_node_t *n = topology_tree_node(topology, node);
+    if (!n) {
+        return range;
+    }
+
+    range.cpus = &topology->tree.cpu_order[n->first_cpu];
+    range.count = n->cpu_count;
+    return range;
+}
+
+topology_cpu_range_t topology_cpu_siblings(
+    const topology_state_t *topology,
+    core_id_t cpu,
+    topology_level_t level
+) {
+    return topology_node_cpus(
+        topology, topology_cpu_ancestor(topology, cpu, level));
+}
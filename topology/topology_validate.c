@@ -131,31 +131,6 @@ bool topology_probe_all_cores(topology_state_t *topology) {
  * CACHE ISOLATION MATRIX COMPUTATION
  * ======================================================================== */
 
-static cache_isolation_level_t compute_cache_isolation(
-    const core_geometry_t *core_a,
-    const core_geometry_t *core_b
-) {
-    /* If same core, no isolation needed */
-    if (core_a->physical_core == core_b->physical_core) {
-        return CACHE_ISOLATED_FULL;
-    }
-    
-    /* Check L1 isolation */
-    if (core_a->l1_domain != core_b->l1_domain) {
-        /* Check L2 isolation */
-        if (core_a->l2_domain != core_b->l2_domain) {
-            /* Check L3 isolation */
-            if (core_a->l3_domain != core_b->l3_domain) {
-                return CACHE_ISOLATED_FULL;
-            }
-            return CACHE_ISOLATED_L3;
-        }
-        return CACHE_ISOLATED_L2;
-    }
-    
-    return CACHE_ISOLATED_L1;
-}
-
 bool topology_build_cache_isolation_matrix(topology_state_t *topology) {
     if (!topology->probed) {
         return false;
@@ -165,15 +140,23 @@ bool topology_build_cache_isolation_matrix(topology_state_t *topology) {
         return true;  /* Already computed */
     }
     
-    /* Compute pairwise cache isolation for all cores */
+    cache_domain_columns_t *columns = &topology->cache_domains;
+    
+    /* Gather cache domains into contiguous columns */
     for (uint32_t i = 0; i < topology->core_count; i++) {
-        for (uint32_t j = 0; j < topology->core_count; j++) {
-            const core_geometry_t *core_a = &topology->cores[i];
-            const core_geometry_t *core_b = &topology->cores[j];
-            
-            topology->cache_isolation.isolation[i][j] = 
-                compute_cache_isolation(core_a, core_b);
-        }
+        const core_geometry_t *core = &topology->cores[i];
+        
+        columns->l1[i] = core->l1_domain;
+        columns->l2[i] = core->l2_domain;
+        columns->l3[i] = core->l3_domain;
+    }
+    
+    /* Compute pairwise cache isolation one row at a time */
+    for (uint32_t i = 0; i < topology->core_count; i++) {
+        topology_build_isolation_row(
+            columns->l1, columns->l2, columns->l3,
+            topology->core_count, i,
+            topology->cache_isolation.isolation[i]);
     }
     
     topology->cache_isolation.computed = true;
@@ -204,8 +187,16 @@ static topology_validation_result_t validate_boot_consistency(
         result = TOPOLOGY_VALIDATION_HARD_FAIL;
     }
     
-    /* NUMA node count must match */
-    if (topology->numa_node_count != topology->boot_facts->numa_nodes) {
+    /* CPU-bearing NUMA node count must match (memory-only nodes,
+     * e.g. CXL or HBM, are topology facts that boot does not count) */
+    uint32_t cpu_nodes = 0;
+    for (uint32_t i = 0; i < topology->numa_node_count; i++) {
+        if (!topology->numa_nodes[i].cpu_less) {
+            cpu_nodes++;
+        }
+    }
+    
+    if (cpu_nodes != topology->boot_facts->numa_nodes) {
         topology_validation_context_add_error(
             ctx, TOPOLOGY_ERROR_NUMA_COUNT_MISMATCH, TOPOLOGY_VALIDATION_HARD_FAIL);
         result = TOPOLOGY_VALIDATION_HARD_FAIL;
@@ -259,10 +250,10 @@ static topology_validation_result_t validate_cache_hierarchy(
             result = TOPOLOGY_VALIDATION_HARD_FAIL;
         }
         
-        /* Verify cache domains are consistent */
-        if (core->l1_domain == CACHE_DOMAIN_INVALID ||
-            core->l2_domain == CACHE_DOMAIN_INVALID ||
-            core->l3_domain == CACHE_DOMAIN_INVALID) {
+        /* Verify cache domains are assigned (IDs are < MAX_CORES) */
+        if (core->l1_domain >= MAX_CORES ||
+            core->l2_domain >= MAX_CORES ||
+            core->l3_domain >= MAX_CORES) {
             topology_validation_context_add_error(
                 ctx, TOPOLOGY_ERROR_CACHE_DOMAIN_INCONSISTENT,
                 TOPOLOGY_VALIDATION_HARD_FAIL);
@@ -285,7 +276,7 @@ static topology_validation_result_t validate_numa_topology(
     
     /* Validate NUMA distances are sane */
     for (uint32_t i = 0; i < topology->numa_node_count; i++) {
-        const numa_node_t *node = &topology->numa_nodes[i];
+        const numa_node_info_t *node = &topology->numa_nodes[i];
         
         /* Distance to self should be lowest */
         uint32_t self_distance = node->distance[i];
@@ -302,6 +293,32 @@ static topology_validation_result_t validate_numa_topology(
         }
     }
     
+    /* Memory-only nodes must not host cores */
+    for (uint32_t i = 0; i < topology->numa_node_count; i++) {
+        const numa_node_info_t *node = &topology->numa_nodes[i];
+        
+        if (node->cpu_less && node->core_count != 0) {
+            topology_validation_context_add_error(
+                ctx, TOPOLOGY_ERROR_NUMA_TIER_INCONSISTENT,
+                TOPOLOGY_VALIDATION_HARD_FAIL);
+            result = TOPOLOGY_VALIDATION_HARD_FAIL;
+            break;
+        }
+    }
+    
+    /* CPU nodes are DRAM; HBM/FAR tiers are memory-only */
+    for (uint32_t i = 0; i < topology->numa_node_count; i++) {
+        const numa_node_info_t *node = &topology->numa_nodes[i];
+        
+        if (!node->cpu_less && node->tier != NUMA_TIER_DRAM) {
+            topology_validation_context_add_error(
+                ctx, TOPOLOGY_ERROR_NUMA_TIER_INCONSISTENT,
+                TOPOLOGY_VALIDATION_HARD_FAIL);
+            result = TOPOLOGY_VALIDATION_HARD_FAIL;
+            break;
+        }
+    }
+    
     /* Check for NUMA asymmetry (warning only) */
     if (topology->numa_node_count > 1) {
         bool asymmetric = false;
@@ -374,13 +391,20 @@ static topology_validation_result_t validate_security_requirements(
 ) {
     topology_validation_result_t result = TOPOLOGY_VALIDATION_ACCEPT;
     
-    /* Check that at least some cores can be isolated */
+    /* Check that at least some cores can be isolated
+     * (a core over its measured noise budget does not count) */
     bool has_isolatable_cores = false;
+    bool has_noisy_cores = false;
     
     for (uint32_t i = 0; i < topology->core_count; i++) {
-        if (topology->cores[i].isolated) {
+        if (!topology->cores[i].isolated) {
+            continue;
+        }
+        
+        if (topology_core_noise_within_budget(topology, i)) {
             has_isolatable_cores = true;
-            break;
+        } else {
+            has_noisy_cores = true;
         }
     }
     
@@ -391,6 +415,14 @@ static topology_validation_result_t validate_security_requirements(
         result = TOPOLOGY_VALIDATION_HARD_FAIL;
     }
     
+    if (has_noisy_cores) {
+        topology_validation_context_add_error(
+            ctx, TOPOLOGY_WARN_CORE_NOISY, TOPOLOGY_VALIDATION_WARN);
+        if (result == TOPOLOGY_VALIDATION_ACCEPT) {
+            result = TOPOLOGY_VALIDATION_WARN;
+        }
+    }
+    
     /* Check for frequency scaling (determinism requirement) */
     bool freq_scaling_disabled = true;
     
@@ -428,12 +460,38 @@ static topology_validation_result_t validate_security_requirements(
     return result;
 }
 
+/* ========================================================================
+ * VALIDATION - FREQUENCY VARIATION
+ * ======================================================================== */
+
+static topology_validation_result_t validate_frequency_variation(
+    const topology_state_t *topology,
+    topology_validation_context_t *ctx
+) {
+    /* Nothing measured: freq_scaling_disabled is checked above */
+    if (!topology->frequency_calibrated) {
+        return TOPOLOGY_VALIDATION_ACCEPT;
+    }
+    
+    /* Throttled, unstable or differently-binned cores (warning only) */
+    for (uint32_t i = 0; i < topology->core_count; i++) {
+        if (topology->cores[i].isolated &&
+            !topology_core_frequency_stable(topology, i)) {
+            topology_validation_context_add_error(
+                ctx, TOPOLOGY_WARN_FREQ_VARIATION, TOPOLOGY_VALIDATION_WARN);
+            return TOPOLOGY_VALIDATION_WARN;
+        }
+    }
+    
+    return TOPOLOGY_VALIDATION_ACCEPT;
+}
+
 /* ========================================================================
  * VALIDATION - TOPOLOGY SYMMETRY
  * ======================================================================== */
 
 static topology_validation_result_t validate_topology_symmetry(
-    const topology_state_t *topology,
+    topology_state_t *topology,
     topology_validation_context_t *ctx
 ) {
     topology_validation_result_t result = TOPOLOGY_VALIDATION_ACCEPT;
@@ -447,10 +505,12 @@ static topology_validation_result_t validate_topology_symmetry(
         for (uint32_t i = 1; i < topology->core_count; i++) {
             const core_geometry_t *core = &topology->cores[i];
             
-            /* Compare relevant fields */
+            /* Compare relevant fields (measured frequencies are never
+             * bit-identical; validate_frequency_variation judges them) */
             if (core->cache_hierarchy.level_count != first->cache_hierarchy.level_count ||
-                core->base_freq_mhz != first->base_freq_mhz ||
-                core->max_freq_mhz != first->max_freq_mhz) {
+                (!topology->frequency_calibrated &&
+                 (core->base_freq_mhz != first->base_freq_mhz ||
+                  core->max_freq_mhz != first->max_freq_mhz))) {
                 symmetric = false;
                 break;
             }
@@ -490,6 +550,13 @@ topology_validation_result_t topology_validate(
         return TOPOLOGY_VALIDATION_HARD_FAIL;
     }
     
+    /* Node membership masks and memory tiers before NUMA validation */
+    topology_index_numa_nodes(topology);
+    topology_classify_memory_tiers(topology);
+    
+    /* Median core frequency is the reference for variation checks */
+    topology_summarize_frequencies(topology);
+    
     /* Run all validation checks */
     validate_boot_consistency(topology, ctx);
     validate_core_probing(topology, ctx);
@@ -497,6 +564,7 @@ topology_validation_result_t topology_validate(
     validate_numa_topology(topology, ctx);
     validate_smt_configuration(topology, ctx);
     validate_security_requirements(topology, ctx);
+    validate_frequency_variation(topology, ctx);
     validate_topology_symmetry(topology, ctx);
     
     /* Mark topology as validated if successful */
@@ -520,11 +588,23 @@ bool topology_seal(topology_state_t *topology) {
         return false;  /* Already sealed */
     }
     
+    /* Build placement indexes from the final geometry */
+    if (!topology_build_proximity_index(topology)) {
+        return false;
+    }
+    
+    if (!topology_build_tree(topology)) {
+        return false;
+    }
+    
     /* Seal cache isolation matrix */
     topology->cache_isolation.sealed = true;
     
-    /* Mark all cores as validated */
+    /* Mark all cores as validated; noisy cores lose isolation for good */
     for (uint32_t i = 0; i < topology->core_count; i++) {
+        if (!topology_core_noise_within_budget(topology, i)) {
+            topology->cores[i].isolated = false;
+        }
         topology->cores[i].validated = true;
     }
     
@@ -571,7 +651,14 @@ cache_isolation_level_t topology_get_cache_isolation(
         return CACHE_ISOLATED_NONE;
     }
     
-    return topology->cache_isolation.isolation[core_a][core_b];
+    /* A core shares every cache with itself (the matrix diagonal is FULL
+     * only so row kernels never rank a core as its own neighbour) */
+    if (core_a == core_b) {
+        return CACHE_ISOLATED_NONE;
+    }
+    
+    return (cache_isolation_level_t)
+        topology->cache_isolation.isolation[core_a][core_b];
 }
 
 bool topology_can_isolate_cores(
@@ -605,11 +692,12 @@ bool topology_same_numa_node(
     core_id_t core_b
 ) {
     numa_node_t node_a = topology_get_numa_node(topology, core_a);
-    numa_node_t node_b = topology_get_numa_node(topology, core_b);
     
-    return (node_a != NUMA_NODE_INVALID && 
-            node_b != NUMA_NODE_INVALID && 
-            node_a == node_b);
+    if (node_a >= topology->numa_node_count || core_b >= topology->core_count) {
+        return false;
+    }
+    
+    return core_mask_test(&topology->numa_nodes[node_a].cores, core_b);
 }
 
 uint32_t topology_get_numa_distance(
@@ -666,9 +754,17 @@ uint32_t topology_get_cache_sharing_cores(
     
     const cache_level_t *cache = &core->cache_hierarchy.levels[cache_level];
     
+    /* Visit only the words that can hold probed cores */
+    uint32_t words = (topology->core_count + 63) / 64;
     uint32_t count = 0;
-    for (uint32_t i = 0; i < cache->sharing_count && count < max_cores; i++) {
-        out_cores[count++] = cache->shared_with[i];
+    
+    for (uint32_t w = 0; w < words && count < max_cores; w++) {
+        uint64_t bits = cache->shared_with.bits[w];
+        
+        while (bits && count < max_cores) {
+            out_cores[count++] = w * 64 + (core_id_t)__builtin_ctzll(bits);
+            bits &= bits - 1;
+        }
     }
     
     return count;
@@ -694,6 +790,8 @@ const char* topology_error_string(topology_error_t error) {
             return "Cache hierarchy incomplete";
         case TOPOLOGY_ERROR_NUMA_DISTANCE_INVALID:
             return "NUMA distance is invalid";
+        case TOPOLOGY_ERROR_NUMA_TIER_INCONSISTENT:
+            return "NUMA memory tier inconsistent with node CPUs";
         case TOPOLOGY_ERROR_SMT_SIBLING_INVALID:
             return "SMT sibling is invalid";
         case TOPOLOGY_ERROR_CACHE_DOMAIN_INCONSISTENT:
@@ -712,6 +810,8 @@ const char* topology_error_string(topology_error_t error) {
             return "Warning: NUMA topology is asymmetric";
         case TOPOLOGY_WARN_FREQ_VARIATION:
             return "Warning: Core frequencies vary";
+        case TOPOLOGY_WARN_CORE_NOISY:
+            return "Warning: Isolated core exceeds OS noise budget";
         default:
             return "Unknown error";
     }